@@ -242,9 +242,11 @@ HyperedgeWeight edge_weight(mt_kahypar_hypergraph_t hypergraph, HyperedgeID he)
 // ####################### Partitioned Hypergraph Generic Implementations #######################
 
 template<bool Throwing>
-void write_partition_to_file(mt_kahypar_partitioned_hypergraph_t p, const std::string& partition_file) {
+void write_partition_to_file(mt_kahypar_partitioned_hypergraph_t p,
+                             const std::string& partition_file,
+                             const FileFormat format = FileFormat::hMetis) {
   switch_phg<int, Throwing>(p, [&](auto& phg) {
-    io::writePartitionFile(phg, partition_file);
+    io::writePartitionFile(phg, partition_file, format);
     return 0;
   });
 }
@@ -26,15 +26,24 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 #include <string>
 #include <sstream>
 #include <type_traits>
+#include <vector>
+
+#include <tbb_kahypar/blocked_range.h>
+#include <tbb_kahypar/parallel_for.h>
 
 #include "mtkahypartypes.h"
+#include "lib_generic_impls.h"
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/conversion.h"
+#include "mt-kahypar/partition/memory_budget.h"
 #include "mt-kahypar/partition/partitioner_facade.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
 #include "mt-kahypar/partition/metrics.h"
@@ -42,9 +51,11 @@
 #include "mt-kahypar/io/hypergraph_factory.h"
 #include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
 #include "mt-kahypar/utils/exception.h"
 #include "mt-kahypar/io/command_line_options.h"
 #include "mt-kahypar/io/presets.h"
+#include "mt-kahypar/parallel/execution_context.h"
 
 
 using namespace mt_kahypar;
@@ -119,8 +130,10 @@ bool is_compatible(mt_kahypar_partitioned_hypergraph_t partitioned_hg, mt_kahypa
     case DEFAULT:
     case QUALITY:
     case DETERMINISTIC:
+      // The memory budget may select the large-k data structures for these presets
       return partitioned_hg.type == MULTILEVEL_GRAPH_PARTITIONING ||
-             partitioned_hg.type == MULTILEVEL_HYPERGRAPH_PARTITIONING;
+             partitioned_hg.type == MULTILEVEL_HYPERGRAPH_PARTITIONING ||
+             partitioned_hg.type == LARGE_K_PARTITIONING;
     case LARGE_K:
       return partitioned_hg.type == MULTILEVEL_GRAPH_PARTITIONING ||
              partitioned_hg.type == LARGE_K_PARTITIONING;
@@ -164,9 +177,9 @@ Context context_from_preset(PresetType preset) {
   return context;
 }
 
-void prepare_context(Context& context) {
-  context.shared_memory.original_num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
-  context.shared_memory.num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
+void prepare_context(Context& context, const size_t num_threads) {
+  context.shared_memory.original_num_threads = num_threads;
+  context.shared_memory.num_threads = num_threads;
   context.utility_id = mt_kahypar::utils::Utilities::instance().registerNewUtilityObjects();
 
   context.partition.perfect_balance_part_weights.clear();
@@ -270,8 +283,8 @@ std::string incompatibility_description(mt_kahypar_partitioned_hypergraph_t part
          << "HIGHEST_QUALITY"; break;
     case LARGE_K_PARTITIONING:
       ss << "The partitioned hypergraph uses the data structures for large k hypergraph partitioning "
-         << "which can be only used in combination with the following preset: "
-         << "LARGE_K"; break;
+         << "which can be only used in combination with the following presets: "
+         << "DEFAULT, QUALITY, DETERMINISTIC, and LARGE_K"; break;
     case NULLPTR_PARTITION:
       ss << "The hypergraph holds a nullptr. "
          << "Did you forgot to construct or load a hypergraph?"; break;
@@ -319,6 +332,38 @@ mt_kahypar_hypergraph_t create_hypergraph(const Context& context,
   throw InvalidParameterException("Invalid preset type.");
 }
 
+mt_kahypar_hypergraph_t create_hypergraph(const Context& context,
+                                          const mt_kahypar_hypernode_id_t num_vertices,
+                                          const mt_kahypar_hyperedge_id_t num_hyperedges,
+                                          const size_t* hyperedge_indices,
+                                          const HypernodeID* hyperedges,
+                                          const mt_kahypar_hyperedge_weight_t* hyperedge_weights,
+                                          const mt_kahypar_hypernode_weight_t* vertex_weights) {
+  switch ( context.partition.preset_type ) {
+    case PresetType::deterministic:
+    case PresetType::large_k:
+    case PresetType::default_preset:
+    case PresetType::quality:
+      return mt_kahypar_hypergraph_t {
+        reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::StaticHypergraph(
+          StaticHypergraphFactory::construct_from_csr(num_vertices, num_hyperedges,
+            hyperedge_indices, hyperedges, hyperedge_weights, vertex_weights, true))), STATIC_HYPERGRAPH };
+    case PresetType::highest_quality:
+      {
+        // The dynamic hypergraph can only be constructed from an adjacency list
+        vec<vec<HypernodeID>> edge_vector(num_hyperedges);
+        tbb_kahypar::parallel_for<HyperedgeID>(0, num_hyperedges, [&](const HyperedgeID he) {
+          edge_vector[he].assign(hyperedges + hyperedge_indices[he], hyperedges + hyperedge_indices[he + 1]);
+        });
+        return create_hypergraph(context, num_vertices, num_hyperedges,
+          edge_vector, hyperedge_weights, vertex_weights);
+      }
+    case PresetType::UNDEFINED:
+      break;
+  }
+  throw InvalidParameterException("Invalid preset type.");
+}
+
 mt_kahypar_hypergraph_t create_graph(const Context& context,
                                      const mt_kahypar_hypernode_id_t num_vertices,
                                      const mt_kahypar_hyperedge_id_t num_edges,
@@ -345,6 +390,44 @@ mt_kahypar_hypergraph_t create_graph(const Context& context,
   throw InvalidParameterException("Invalid preset type.");
 }
 
+// ! The two endpoints of edge e are stored in edges[2 * e] and edges[2 * e + 1]
+mt_kahypar_hypergraph_t create_graph(const Context& context,
+                                     const mt_kahypar_hypernode_id_t num_vertices,
+                                     const mt_kahypar_hyperedge_id_t num_edges,
+                                     const HypernodeID* edges,
+                                     const mt_kahypar_hyperedge_weight_t* edge_weights,
+                                     const mt_kahypar_hypernode_weight_t* vertex_weights) {
+  switch ( context.partition.preset_type ) {
+    case PresetType::deterministic:
+    case PresetType::large_k:
+    case PresetType::default_preset:
+    case PresetType::quality:
+      {
+        vec<size_t> edge_indices(num_edges + 1);
+        tbb_kahypar::parallel_for(UL(0), UL(num_edges) + 1, [&](const size_t e) {
+          edge_indices[e] = 2 * e;
+        });
+        return mt_kahypar_hypergraph_t {
+          reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::StaticGraph(
+            StaticGraphFactory::construct_from_csr(num_vertices, num_edges,
+              edge_indices.data(), edges, edge_weights, vertex_weights, true))), STATIC_GRAPH };
+      }
+    case PresetType::highest_quality:
+      {
+        // The dynamic graph can only be constructed from an edge list
+        vec<std::pair<HypernodeID, HypernodeID>> edge_vector(num_edges);
+        tbb_kahypar::parallel_for<HyperedgeID>(0, num_edges, [&](const HyperedgeID e) {
+          edge_vector[e] = std::make_pair(edges[2 * UL(e)], edges[2 * UL(e) + 1]);
+        });
+        return create_graph(context, num_vertices, num_edges,
+          edge_vector, edge_weights, vertex_weights);
+      }
+    case PresetType::UNDEFINED:
+      break;
+  }
+  throw InvalidParameterException("Invalid preset type.");
+}
+
 template<typename PartitionedHypergraph, typename Hypergraph>
 mt_kahypar_partitioned_hypergraph_t create_partitioned_hypergraph(Hypergraph& hg,
                                                                   const mt_kahypar_partition_id_t num_blocks,
@@ -413,22 +496,187 @@ void set_individual_block_weights(Context& context,
 
 // ####################### Partitioning #######################
 
-mt_kahypar_partitioned_hypergraph_t partition_impl(mt_kahypar_hypergraph_t hg, Context& context, TargetGraph* target_graph) {
+// ! Cancellation flag and progress callback of a partitioning call
+struct PartitioningCallbacks {
+  const int* cancellation_flag = nullptr;
+  utils::ProgressReporter::Callback progress_callback;
+};
+
+size_t num_threads_of(const parallel::ExecutionContext* execution_context) {
+  return execution_context ? execution_context->numThreads() :
+    mt_kahypar::TBBInitializer::instance().total_number_of_threads();
+}
+
+// ! Runs f in the given execution context or in the global task arena
+template<typename F>
+auto execute(parallel::ExecutionContext* execution_context, const F& f) -> decltype(f()) {
+  if ( execution_context ) {
+    return execution_context->execute(f);
+  } else {
+    return f();
+  }
+}
+
+void prepare_partitioning(mt_kahypar_hypergraph_t hg, Context& context, const size_t num_threads) {
   check_compatibility(hg, get_preset_c_type(context.partition.preset_type));
   check_if_all_relevant_parameters_are_set(context);
   context.partition.instance_type = get_instance_type(hg);
   context.partition.partition_type = to_partition_c_type(context.partition.preset_type, context.partition.instance_type);
-  prepare_context(context);
+  prepare_context(context, num_threads);
   context.partition.num_vcycles = 0;
-  return PartitionerFacade::partition(hg, context, target_graph);
+  apply_memory_budget(hg, context);
 }
 
-mt_kahypar_partitioned_hypergraph_t partition(mt_kahypar_hypergraph_t hg, const Context& context) {
+mt_kahypar_partitioned_hypergraph_t partition_impl(mt_kahypar_hypergraph_t hg,
+                                                   Context& context,
+                                                   TargetGraph* target_graph,
+                                                   parallel::ExecutionContext* execution_context,
+                                                   const PartitioningCallbacks* callbacks = nullptr) {
+  prepare_partitioning(hg, context, num_threads_of(execution_context));
+  if ( callbacks ) {
+    utils::Utilities& utils = utils::Utilities::instance();
+    utils.getTimeLimit(context.utility_id).setCancellationFlag(callbacks->cancellation_flag);
+    utils.getProgressReporter(context.utility_id).setCallback(callbacks->progress_callback);
+  }
+  return execute(execution_context, [&] {
+    return PartitionerFacade::partition(hg, context, target_graph);
+  });
+}
+
+mt_kahypar_partitioned_hypergraph_t partition(mt_kahypar_hypergraph_t hg,
+                                              const Context& context,
+                                              parallel::ExecutionContext* execution_context = nullptr,
+                                              const PartitioningCallbacks* callbacks = nullptr) {
+  Context partition_context(context);
+  return partition_impl(hg, partition_context, nullptr, execution_context, callbacks);
+}
+
+mt_kahypar_partitioned_hypergraph_t repartition_incrementally(mt_kahypar_partitioned_hypergraph_t phg,
+                                                              const HypergraphDelta& delta,
+                                                              const Context& context,
+                                                              mt_kahypar_hypergraph_t& updated_hg,
+                                                              parallel::ExecutionContext* execution_context = nullptr) {
   Context partition_context(context);
-  return partition_impl(hg, partition_context, nullptr);
+  check_compatibility(phg, get_preset_c_type(partition_context.partition.preset_type));
+  check_if_all_relevant_parameters_are_set(partition_context);
+  partition_context.partition.instance_type = get_instance_type(phg);
+  // The partition may use the large-k data structures selected by the memory budget
+  partition_context.partition.partition_type = phg.type;
+  prepare_context(partition_context, num_threads_of(execution_context));
+  return execute(execution_context, [&] {
+    return PartitionerFacade::repartitionIncrementally(phg, delta, partition_context, updated_hg);
+  });
 }
 
-mt_kahypar_partitioned_hypergraph_t map(mt_kahypar_hypergraph_t hg, TargetGraph& target_graph, const Context& context) {
+// ! Partitions many (small) hypergraphs with the same context. The instances are
+// ! processed concurrently in order of decreasing size (largest first) and each
+// ! instance runs in its own execution context, whose task arena gets a share of the
+// ! threads proportional to the number of pins of the instance. The execution contexts
+// ! are seeded with the seed of the context, such that the result of an instance does
+// ! not depend on the other instances of the batch.
+std::vector<mt_kahypar_partitioned_hypergraph_t> partition_batch(const std::vector<mt_kahypar_hypergraph_t>& hypergraphs,
+                                                                 const Context& context) {
+  const size_t num_instances = hypergraphs.size();
+  std::vector<Context> contexts(num_instances, context);
+  std::vector<size_t> num_pins(num_instances, 0);
+  size_t total_num_pins = 0;
+  for ( size_t i = 0; i < num_instances; ++i ) {
+    num_pins[i] = std::max(lib::num_pins<true>(hypergraphs[i]), ID(1));
+    total_num_pins += num_pins[i];
+  }
+
+  // Check all instances before we start partitioning. Partitioning modifies the
+  // input hypergraph, so each hypergraph must occur only once in the batch.
+  std::vector<const mt_kahypar_hypergraph_s*> handles(num_instances, nullptr);
+  for ( size_t i = 0; i < num_instances; ++i ) {
+    handles[i] = hypergraphs[i].hypergraph;
+  }
+  std::sort(handles.begin(), handles.end());
+  if ( std::adjacent_find(handles.begin(), handles.end()) != handles.end() ) {
+    throw InvalidInputException("A hypergraph occurs more than once in the batch!");
+  }
+  const size_t num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
+  std::vector<size_t> num_threads_of_instance(num_instances, 1);
+  for ( size_t i = 0; i < num_instances; ++i ) {
+    num_threads_of_instance[i] = std::clamp(
+      static_cast<size_t>(std::ceil(static_cast<double>(num_threads * num_pins[i]) / total_num_pins)),
+      UL(1), num_threads);
+    prepare_partitioning(hypergraphs[i], contexts[i], num_threads_of_instance[i]);
+  }
+
+  std::vector<size_t> order(num_instances, 0);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](const size_t lhs, const size_t rhs) {
+    return num_pins[lhs] > num_pins[rhs];
+  });
+
+  std::vector<mt_kahypar_partitioned_hypergraph_t> partitioned_hgs(
+    num_instances, mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION });
+  try {
+    tbb_kahypar::parallel_for(tbb_kahypar::blocked_range<size_t>(UL(0), num_instances, UL(1)),
+      [&](const tbb_kahypar::blocked_range<size_t>& range) {
+      for ( size_t j = range.begin(); j < range.end(); ++j ) {
+        const size_t i = order[j];
+        parallel::ExecutionContext execution_context(
+          static_cast<int>(num_threads_of_instance[i]), contexts[i].partition.seed);
+        partitioned_hgs[i] = execution_context.execute([&] {
+          return PartitionerFacade::partition(hypergraphs[i], contexts[i], nullptr);
+        });
+      }
+    }, tbb_kahypar::simple_partitioner());
+  } catch ( ... ) {
+    for ( mt_kahypar_partitioned_hypergraph_t& phg : partitioned_hgs ) {
+      utils::delete_partitioned_hypergraph(phg);
+    }
+    throw;
+  }
+  return partitioned_hgs;
+}
+
+// ! Partitions the hypergraph for several numbers of blocks. If 'epsilons' is empty,
+// ! all runs use the imbalance of the context. The hypergraph is coarsened only once
+// ! with the contraction limit of the largest k and all runs share that hierarchy.
+std::vector<mt_kahypar_partitioned_hypergraph_t> partition_for_multiple_k(mt_kahypar_hypergraph_t hg,
+                                                                          const Context& context,
+                                                                          const std::vector<PartitionID>& ks,
+                                                                          const std::vector<double>& epsilons) {
+  if ( !epsilons.empty() && epsilons.size() != ks.size() ) {
+    throw InvalidInputException("The number of imbalance factors must match the number of blocks!");
+  }
+  if ( context.partition.use_individual_part_weights ) {
+    throw InvalidInputException(
+      "Individual block weights are not supported when partitioning for multiple k!");
+  }
+  if ( ks.empty() ) {
+    return { };
+  }
+
+  // The memory budget and all other k-dependent parameters are
+  // determined for the largest k, which requires the most memory
+  const size_t max_k_idx = std::max_element(ks.begin(), ks.end()) - ks.begin();
+  Context prepared_context(context);
+  prepared_context.partition.k = ks[max_k_idx];
+  if ( !epsilons.empty() ) {
+    prepared_context.partition.epsilon = epsilons[max_k_idx];
+  }
+  prepare_partitioning(hg, prepared_context, num_threads_of(nullptr));
+
+  // All runs share the utility objects of the prepared context
+  vec<Context> contexts(ks.size(), prepared_context);
+  for ( size_t i = 0; i < ks.size(); ++i ) {
+    contexts[i].partition.k = ks[i];
+    if ( !epsilons.empty() ) {
+      contexts[i].partition.epsilon = epsilons[i];
+    }
+  }
+  return PartitionerFacade::partitionForMultipleK(hg, contexts);
+}
+
+mt_kahypar_partitioned_hypergraph_t map(mt_kahypar_hypergraph_t hg,
+                                        TargetGraph& target_graph,
+                                        const Context& context,
+                                        parallel::ExecutionContext* execution_context = nullptr,
+                                        const PartitioningCallbacks* callbacks = nullptr) {
   if (static_cast<PartitionID>(target_graph.graph().initialNumNodes()) != context.partition.k) {
     std::stringstream ss;
     ss << "Mismatched number of blocks: the context specifies " << context.partition.k
@@ -437,7 +685,7 @@ mt_kahypar_partitioned_hypergraph_t map(mt_kahypar_hypergraph_t hg, TargetGraph&
   }
   Context partition_context(context);
   partition_context.partition.objective = Objective::steiner_tree;
-  return partition_impl(hg, partition_context, &target_graph);
+  return partition_impl(hg, partition_context, &target_graph, execution_context, callbacks);
 }
 
 
@@ -446,28 +694,36 @@ mt_kahypar_partitioned_hypergraph_t map(mt_kahypar_hypergraph_t hg, TargetGraph&
 void improve_impl(mt_kahypar_partitioned_hypergraph_t phg,
                   Context& context,
                   const size_t num_vcycles,
-                  TargetGraph* target_graph) {
+                  TargetGraph* target_graph,
+                  parallel::ExecutionContext* execution_context) {
   check_compatibility(phg, get_preset_c_type(context.partition.preset_type));
   check_if_all_relevant_parameters_are_set(context);
   context.partition.instance_type = get_instance_type(phg);
-  context.partition.partition_type = to_partition_c_type(context.partition.preset_type, context.partition.instance_type);
-  prepare_context(context);
+  // The partition may use the large-k data structures selected by the memory budget
+  context.partition.partition_type = phg.type;
+  prepare_context(context, num_threads_of(execution_context));
   context.partition.num_vcycles = num_vcycles;
-  PartitionerFacade::improve(phg, context, target_graph);
+  execute(execution_context, [&] {
+    PartitionerFacade::improve(phg, context, target_graph);
+  });
 }
 
-void improve(mt_kahypar_partitioned_hypergraph_t phg, const Context& context, const size_t num_vcycles) {
+void improve(mt_kahypar_partitioned_hypergraph_t phg,
+             const Context& context,
+             const size_t num_vcycles,
+             parallel::ExecutionContext* execution_context = nullptr) {
   Context partition_context(context);
-  improve_impl(phg, partition_context, num_vcycles, nullptr);
+  improve_impl(phg, partition_context, num_vcycles, nullptr, execution_context);
 }
 
 void improve_mapping(mt_kahypar_partitioned_hypergraph_t phg,
                     TargetGraph& target_graph,
                     const Context& context,
-                    const size_t num_vcycles) {
+                    const size_t num_vcycles,
+                    parallel::ExecutionContext* execution_context = nullptr) {
   Context partition_context(context);
   partition_context.partition.objective = Objective::steiner_tree;
-  improve_impl(phg, partition_context, num_vcycles, &target_graph);
+  improve_impl(phg, partition_context, num_vcycles, &target_graph, execution_context);
 }
 
 } // namespace lib
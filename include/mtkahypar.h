@@ -129,6 +129,23 @@ MT_KAHYPAR_API void mt_kahypar_set_individual_target_block_weights(mt_kahypar_co
 MT_KAHYPAR_API void mt_kahypar_initialize(const size_t num_threads, const bool interleaved_allocations);
 
 
+// ####################### Execution Contexts #######################
+
+/**
+ * Creates an execution context that owns a task arena with at most 'num_threads' threads, a memory pool
+ * and random number generators seeded with 'seed'. Partitioning calls that run in different execution
+ * contexts do not share any mutable state and can therefore be issued concurrently from different threads.
+ *
+ * \note mt_kahypar_initialize(...) must be called before creating an execution context. The number of threads
+ *       of an execution context is bounded by the number of threads of the global thread pool.
+ * \note An execution context must not be used by more than one partitioning call at a time.
+ */
+MT_KAHYPAR_API mt_kahypar_execution_context_t* mt_kahypar_create_execution_context(const size_t num_threads,
+                                                                                   const size_t seed);
+
+MT_KAHYPAR_API void mt_kahypar_free_execution_context(mt_kahypar_execution_context_t* execution_context);
+
+
 // ####################### Error Handling #######################
 
 /**
@@ -140,7 +157,8 @@ MT_KAHYPAR_API void mt_kahypar_free_error_content(mt_kahypar_error_t* error);
 
 /**
  * Reads a (hyper)graph from a file for a given configuration (preset).
- * The file can be either in hMetis or Metis file format.
+ * The file can be either in hMetis, Metis or binary CSR file format.
+ * Fixed vertices stored in a binary file are not added automatically, see mt_kahypar_add_fixed_vertices.
  *
  * \note Note that we use different (hyper)graph data structures for different configurations.
  * Make sure that you partition the hypergraph with the same configuration as it is loaded.
@@ -374,6 +392,59 @@ MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition(mt_kahyp
                                                                         const mt_kahypar_context_t* context,
                                                                         mt_kahypar_error_t* error);
 
+/**
+ * Partitions a batch of (hyper)graphs with the same partitioning context and stores the i-th
+ * partitioned (hyper)graph in 'partitioned_hgs[i]'. The instances are partitioned concurrently, which
+ * maximizes throughput for many small instances (instead of the latency of a single instance).
+ *
+ * \note If an error occurs, no partitioned (hyper)graph is returned.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_partition_batch(const mt_kahypar_hypergraph_t* hypergraphs,
+                                                              const size_t num_hypergraphs,
+                                                              const mt_kahypar_context_t* context,
+                                                              mt_kahypar_partitioned_hypergraph_t* partitioned_hgs,
+                                                              mt_kahypar_error_t* error);
+
+/**
+ * Partitions a (hyper)graph into each number of blocks of 'ks' and stores the partition into
+ * 'ks[i]' blocks in 'partitioned_hgs[i]'. If 'epsilons' is not NULL, the i-th partition uses
+ * the imbalance factor 'epsilons[i]', otherwise the imbalance factor of the context.
+ * In multilevel mode, the (hyper)graph is coarsened only once (with the contraction limit of
+ * the largest k) and each partition only performs initial partitioning and refinement on the
+ * shared hierarchy. This is significantly faster than partitioning for each k separately.
+ *
+ * \note If an error occurs, no partitioned (hyper)graph is returned.
+ * \note Individual target block weights are not supported.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_partition_for_multiple_k(mt_kahypar_hypergraph_t hypergraph,
+                                                                      const mt_kahypar_context_t* context,
+                                                                      const mt_kahypar_partition_id_t* ks,
+                                                                      const double* epsilons,
+                                                                      const size_t num_ks,
+                                                                      mt_kahypar_partitioned_hypergraph_t* partitioned_hgs,
+                                                                      mt_kahypar_error_t* error);
+
+/**
+ * Partitions a (hyper)graph with the configuration specified in the partitioning context and
+ * allows to observe and cancel the partitioning run.
+ *
+ * If 'cancellation_flag' is not null, the partitioner checks the flag after each coarsening pass,
+ * initial partitioning run, refinement level and FM round. As soon as the flag is set to a non-zero
+ * value (e.g., from an other thread), all remaining coarsening, initial partitioning and refinement
+ * work is skipped and the partitioner returns the current (valid, but possibly low-quality) partition.
+ * The partitioner reads the flag atomically, so other threads must set it with an atomic store
+ * (e.g., atomic_store_explicit on an atomic_int or __atomic_store_n).
+ * If 'progress_callback' is not null, it is called with the current phase, level, number of nodes
+ * and objective after each coarsening pass, after initial partitioning and after each uncoarsening
+ * level. The callback is invoked by the thread that drives the partitioning run and receives 'user_data'.
+ */
+MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition_with_callbacks(mt_kahypar_hypergraph_t hypergraph,
+                                                                                       const mt_kahypar_context_t* context,
+                                                                                       const int* cancellation_flag,
+                                                                                       mt_kahypar_progress_callback_t progress_callback,
+                                                                                       void* user_data,
+                                                                                       mt_kahypar_error_t* error);
+
 /**
  * Maps a (hyper)graph onto a target graph with the configuration specified in the partitioning context.
  * The number of blocks of the output mapping/partition is the same as the number of nodes in the target graph
@@ -383,11 +454,11 @@ MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition(mt_kahyp
  * is able to acurately model wire-lengths in VLSI design or communication costs in a distributed system where some
  * processors do not communicate directly with each other or different speeds.
  *
- * \note Since computing Steiner trees is an NP-hard problem, we currently restrict the size of the target graph
- * to at most 64 nodes. If you want to map hypergraphs onto larger target graphs, you can use recursive multisectioning.
- * For example, if the target graph has 4096 nodes, you can first map the hypergraph onto a coarser approximation of the
- * target graph with 64 nodes, and subsequently map each block of the mapping to the corresponding subgraph of the
- * target graph each having 64 nodes.
+ * \note Since computing Steiner trees is an NP-hard problem, optimal Steiner trees are only precomputed for small
+ * connectivity sets (fewer for large target graphs). Larger ones are approximated via a 2-approximation. For very large
+ * target graphs, you can also use recursive multisectioning. For example, if the target graph has 4096 nodes, you can
+ * first map the hypergraph onto a coarser approximation of the target graph with 64 nodes, and subsequently map each
+ * block of the mapping to the corresponding subgraph of the target graph each having 64 nodes.
  */
 MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_map(mt_kahypar_hypergraph_t hypergraph,
                                                                   mt_kahypar_target_graph_t* target_graph,
@@ -413,6 +484,25 @@ MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_improve_partition(mt_kahypar_parti
                                                                 const size_t num_vcycles,
                                                                 mt_kahypar_error_t* error);
 
+/**
+ * Applies a small modification (e.g., an ECO) to the (hyper)graph of the given partition and
+ * repairs the partition without repartitioning from scratch: the remaining nodes keep their blocks,
+ * added nodes are placed greedily and label propagation and FM searches seeded from the modified
+ * region restore quality and balance.
+ *
+ * The updated (hyper)graph is stored in 'updated_hypergraph'. The remaining nodes keep their relative
+ * order (removed nodes are skipped) and the added nodes are appended to them.
+ *
+ * \note The updated (hyper)graph must be freed after the returned partitioned (hyper)graph.
+ * \note The number of blocks specified in the partitioning context must be equal to the
+ *       number of blocks of the given partition.
+ */
+MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_repartition_incrementally(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                                                       const mt_kahypar_hypergraph_delta_t* delta,
+                                                                                       const mt_kahypar_context_t* context,
+                                                                                       mt_kahypar_hypergraph_t* updated_hypergraph,
+                                                                                       mt_kahypar_error_t* error);
+
 /**
  * Improves a given mapping (using the V-cycle technique).
  *
@@ -426,6 +516,32 @@ MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_improve_mapping(mt_kahypar_partiti
                                                               const size_t num_vcycles,
                                                               mt_kahypar_error_t* error);
 
+/**
+ * Same as mt_kahypar_partition(...), but runs in the given execution context.
+ */
+MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition_in_execution_context(mt_kahypar_hypergraph_t hypergraph,
+                                                                                             const mt_kahypar_context_t* context,
+                                                                                             mt_kahypar_execution_context_t* execution_context,
+                                                                                             mt_kahypar_error_t* error);
+
+/**
+ * Same as mt_kahypar_map(...), but runs in the given execution context.
+ */
+MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_map_in_execution_context(mt_kahypar_hypergraph_t hypergraph,
+                                                                                       mt_kahypar_target_graph_t* target_graph,
+                                                                                       const mt_kahypar_context_t* context,
+                                                                                       mt_kahypar_execution_context_t* execution_context,
+                                                                                       mt_kahypar_error_t* error);
+
+/**
+ * Same as mt_kahypar_improve_partition(...), but runs in the given execution context.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_improve_partition_in_execution_context(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                                                     const mt_kahypar_context_t* context,
+                                                                                     const size_t num_vcycles,
+                                                                                     mt_kahypar_execution_context_t* execution_context,
+                                                                                     mt_kahypar_error_t* error);
+
 /**
  * Constructs a partitioned (hyper)graph out of the given partition.
  */
@@ -436,7 +552,8 @@ MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_create_partitioned
                                                                                             mt_kahypar_error_t* error);
 
 /**
- * Constructs a partitioned (hyper)graph from a given partition file.
+ * Constructs a partitioned (hyper)graph from a given partition file. The file can either
+ * contain one block ID per line or be in binary format (see mt_kahypar_write_partition_to_binary_file).
  */
 MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_read_partition_from_file(mt_kahypar_hypergraph_t hypergraph,
                                                                                        const mt_kahypar_context_t* context,
@@ -445,12 +562,20 @@ MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_read_partition_fro
                                                                                        mt_kahypar_error_t* error);
 
 /**
- * Writes a partition to a file.
+ * Writes a partition to a file (one block ID per line).
  */
 MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_write_partition_to_file(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                                                       const char* partition_file,
                                                                       mt_kahypar_error_t* error);
 
+/**
+ * Writes a partition to a file in binary format (a 24-byte header followed by one
+ * little-endian int32 block ID per node), which is much faster to write and read for large inputs.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_write_partition_to_binary_file(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                                             const char* partition_file,
+                                                                             mt_kahypar_error_t* error);
+
 // ####################### Partitioning Results #######################
 
 /**
@@ -56,6 +56,8 @@ struct mt_kahypar_context_s;
 typedef struct mt_kahypar_context_s mt_kahypar_context_t;
 struct mt_kahypar_target_graph_s;
 typedef struct mt_kahypar_target_graph_s mt_kahypar_target_graph_t;
+struct mt_kahypar_execution_context_s;
+typedef struct mt_kahypar_execution_context_s mt_kahypar_execution_context_t;
 
 typedef struct mt_kahypar_hypergraph_s mt_kahypar_hypergraph_s;
 typedef struct {
@@ -98,7 +100,15 @@ typedef enum {
   // number of V-cycles (integer)
   NUM_VCYCLES,
   // enables logging (bool: 1/0)
-  VERBOSE
+  VERBOSE,
+  // wall-clock time limit in seconds, 0 disables the time limit (integer)
+  TIME_LIMIT,
+  // number of seeds for which the hypergraph is coarsened and initially partitioned,
+  // only the run with the best initial partition is refined (integer)
+  PORTFOLIO_SIZE,
+  // memory budget in MB, 0 disables the budget (integer). If the estimated peak memory
+  // consumption exceeds the budget, memory-saving data structures and algorithms are used
+  MAX_MEMORY
 } mt_kahypar_context_parameter_type_t;
 
 /**
@@ -133,9 +143,58 @@ typedef enum {
   // Standard file format for graphs
   METIS,
   // Standard file format for hypergraphs
-  HMETIS
+  HMETIS,
+  // Binary CSR format of Mt-KaHyPar (can be memory-mapped, see tool HgrToBinary)
+  BINARY
 } mt_kahypar_file_format_type_t;
 
+/**
+ * Phases of a partitioning run (see mt_kahypar_partition_with_callbacks).
+ */
+typedef enum {
+  PHASE_COARSENING,
+  PHASE_INITIAL_PARTITIONING,
+  PHASE_REFINEMENT
+} mt_kahypar_phase_t;
+
+/**
+ * Progress of a partitioning run reported to the progress callback.
+ */
+typedef struct {
+  mt_kahypar_phase_t phase;
+  // coarsening: number of coarsening passes performed so far,
+  // initial partitioning: number of levels of the hierarchy,
+  // refinement: current level of the hierarchy (0 is the input (hyper)graph)
+  size_t level;
+  // number of nodes on the current level
+  mt_kahypar_hypernode_id_t num_nodes;
+  // current objective (0 during coarsening)
+  mt_kahypar_hyperedge_weight_t objective;
+} mt_kahypar_progress_t;
+
+typedef void (*mt_kahypar_progress_callback_t)(const mt_kahypar_progress_t* progress, void* user_data);
+
+/**
+ * Small modification of a (hyper)graph (see mt_kahypar_repartition_incrementally).
+ *
+ * The added hyperedges are given as adjacency array (same layout as in mt_kahypar_create_hypergraph).
+ * Their pins refer to node IDs of the original (hyper)graph and the i-th added node has ID
+ * 'num_nodes + i', where 'num_nodes' is the number of nodes of the original (hyper)graph.
+ * For graphs, each added edge must connect exactly two nodes. Weight arrays can be NULL (unit weights).
+ */
+typedef struct {
+  const mt_kahypar_hypernode_id_t* removed_nodes;
+  mt_kahypar_hypernode_id_t num_removed_nodes;
+  const mt_kahypar_hyperedge_id_t* removed_edges;
+  mt_kahypar_hyperedge_id_t num_removed_edges;
+  mt_kahypar_hypernode_id_t num_added_nodes;
+  const mt_kahypar_hypernode_weight_t* added_node_weights;
+  mt_kahypar_hyperedge_id_t num_added_edges;
+  const size_t* added_edge_indices;
+  const mt_kahypar_hyperedge_id_t* added_edges;
+  const mt_kahypar_hyperedge_weight_t* added_edge_weights;
+} mt_kahypar_hypergraph_delta_t;
+
 #ifndef MT_KAHYPAR_API
 #   if __GNUC__ >= 4
 #       define MT_KAHYPAR_API __attribute__ ((visibility("default")))
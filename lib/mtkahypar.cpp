@@ -26,6 +26,7 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <algorithm>
 #include <cstring>
 #include <type_traits>
 #include <charconv>
@@ -43,6 +44,7 @@
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/conversion.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
+#include "mt-kahypar/parallel/execution_context.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
 #include "mt-kahypar/io/hypergraph_io.h"
@@ -87,6 +89,15 @@ namespace {
     return static_cast<mt_kahypar_preset_type_t>(0);
   }
 
+  mt_kahypar_phase_t to_phase(utils::ProgressReporter::Phase phase) {
+    switch ( phase ) {
+      case utils::ProgressReporter::Phase::coarsening: return PHASE_COARSENING;
+      case utils::ProgressReporter::Phase::initial_partitioning: return PHASE_INITIAL_PARTITIONING;
+      case utils::ProgressReporter::Phase::refinement: return PHASE_REFINEMENT;
+    }
+    return PHASE_REFINEMENT;
+  }
+
   mt_kahypar_error_t to_error(mt_kahypar_status_t status, const char* msg) {
     mt_kahypar_error_t result;
     result.status = status;
@@ -161,6 +172,9 @@ mt_kahypar_status_t mt_kahypar_set_context_parameter(mt_kahypar_context_t* conte
     case NUM_BLOCKS: return parse_number(c.partition.k, "positive integer");
     case EPSILON: return parse_number(c.partition.epsilon, "floating point number");
     case NUM_VCYCLES: return parse_number(c.partition.num_vcycles, "positive integer");
+    case TIME_LIMIT: return parse_number(c.partition.time_limit, "positive integer");
+    case PORTFOLIO_SIZE: return parse_number(c.partition.portfolio_size, "positive integer");
+    case MAX_MEMORY: return parse_number(c.partition.max_memory, "positive integer");
     case OBJECTIVE: {
       std::string objective(value);
       if ( objective == "km1" ) {
@@ -249,6 +263,18 @@ void mt_kahypar_initialize(const size_t num_threads, const bool interleaved_allo
   lib::initialize(num_threads, interleaved_allocations, false);
 }
 
+mt_kahypar_execution_context_t* mt_kahypar_create_execution_context(const size_t num_threads,
+                                                                   const size_t seed) {
+  const size_t max_threads = TBBInitializer::instance().total_number_of_threads();
+  const int arena_threads = static_cast<int>(std::max(UL(1), std::min(num_threads, max_threads)));
+  return reinterpret_cast<mt_kahypar_execution_context_t*>(
+    new parallel::ExecutionContext(arena_threads, static_cast<int>(seed)));
+}
+
+void mt_kahypar_free_execution_context(mt_kahypar_execution_context_t* execution_context) {
+  delete reinterpret_cast<parallel::ExecutionContext*>(execution_context);
+}
+
 void mt_kahypar_free_error_content(mt_kahypar_error_t* error) {
   free(const_cast<char*>(error->msg));
   error->status = mt_kahypar_status_t::SUCCESS;
@@ -261,9 +287,16 @@ mt_kahypar_hypergraph_t mt_kahypar_read_hypergraph_from_file(const char* file_na
                                                              const mt_kahypar_file_format_type_t file_format,
                                                              mt_kahypar_error_t* error) {
   const Context& c = *reinterpret_cast<const Context*>(context);
-  const InstanceType instance = file_format == HMETIS ? InstanceType::hypergraph : InstanceType::graph;
-  const FileFormat format = file_format == HMETIS ? FileFormat::hMetis : FileFormat::Metis;
   try {
+    InstanceType instance = InstanceType::graph;
+    FileFormat format = FileFormat::Metis;
+    if ( file_format == HMETIS ) {
+      instance = InstanceType::hypergraph;
+      format = FileFormat::hMetis;
+    } else if ( file_format == BINARY ) {
+      instance = io::instanceTypeOfBinaryFile(file_name);
+      format = FileFormat::binary;
+    }
     return lib::hypergraph_from_file(file_name, c, instance, format);
   } catch ( std::exception& ex ) {
     *error = to_error(ex);
@@ -294,19 +327,17 @@ mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph(const mt_kahypar_context_t*
                                                      const mt_kahypar_hyperedge_weight_t* hyperedge_weights,
                                                      const mt_kahypar_hypernode_weight_t* vertex_weights,
                                                      mt_kahypar_error_t* error) {
-  // Transform adjacence array into adjacency list
-  vec<vec<HypernodeID>> edge_vector(num_hyperedges);
-  tbb_kahypar::parallel_for<HyperedgeID>(0, num_hyperedges, [&](const mt_kahypar::HyperedgeID& he) {
-    const size_t num_pins = hyperedge_indices[he + 1] - hyperedge_indices[he];
-    edge_vector[he].resize(num_pins);
-    for ( size_t i = 0; i < num_pins; ++i ) {
-      edge_vector[he][i] = hyperedges[hyperedge_indices[he] + i];
-    }
+  // The C interface uses 64-bit IDs, therefore we only convert the pins of the
+  // adjacency array into our ID type (no intermediate adjacency list)
+  vec<HypernodeID> pins(hyperedge_indices[num_hyperedges]);
+  tbb_kahypar::parallel_for(UL(0), pins.size(), [&](const size_t i) {
+    pins[i] = hyperedges[i];
   });
 
   const Context& c = *reinterpret_cast<const Context*>(context);
   try {
-    return lib::create_hypergraph(c, num_vertices, num_hyperedges, edge_vector, hyperedge_weights, vertex_weights);
+    return lib::create_hypergraph(c, num_vertices, num_hyperedges,
+      hyperedge_indices, pins.data(), hyperedge_weights, vertex_weights);
   } catch ( std::exception& ex ) {
     *error = to_error(ex);
   }
@@ -515,6 +546,76 @@ mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition(mt_kahypar_hypergraph_t
   return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
 }
 
+mt_kahypar_status_t mt_kahypar_partition_batch(const mt_kahypar_hypergraph_t* hypergraphs,
+                                               const size_t num_hypergraphs,
+                                               const mt_kahypar_context_t* context,
+                                               mt_kahypar_partitioned_hypergraph_t* partitioned_hgs,
+                                               mt_kahypar_error_t* error) {
+  try {
+    std::vector<mt_kahypar_partitioned_hypergraph_t> result = lib::partition_batch(
+      std::vector<mt_kahypar_hypergraph_t>(hypergraphs, hypergraphs + num_hypergraphs),
+      reinterpret_cast<const Context&>(*context));
+    std::copy(result.begin(), result.end(), partitioned_hgs);
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    std::fill(partitioned_hgs, partitioned_hgs + num_hypergraphs,
+      mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION });
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+mt_kahypar_status_t mt_kahypar_partition_for_multiple_k(mt_kahypar_hypergraph_t hypergraph,
+                                                       const mt_kahypar_context_t* context,
+                                                       const mt_kahypar_partition_id_t* ks,
+                                                       const double* epsilons,
+                                                       const size_t num_ks,
+                                                       mt_kahypar_partitioned_hypergraph_t* partitioned_hgs,
+                                                       mt_kahypar_error_t* error) {
+  try {
+    std::vector<mt_kahypar_partitioned_hypergraph_t> result = lib::partition_for_multiple_k(
+      hypergraph, reinterpret_cast<const Context&>(*context),
+      std::vector<PartitionID>(ks, ks + num_ks),
+      epsilons ? std::vector<double>(epsilons, epsilons + num_ks) : std::vector<double>());
+    std::copy(result.begin(), result.end(), partitioned_hgs);
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    std::fill(partitioned_hgs, partitioned_hgs + num_ks,
+      mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION });
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition_with_callbacks(mt_kahypar_hypergraph_t hypergraph,
+                                                                      const mt_kahypar_context_t* context,
+                                                                      const int* cancellation_flag,
+                                                                      mt_kahypar_progress_callback_t progress_callback,
+                                                                      void* user_data,
+                                                                      mt_kahypar_error_t* error) {
+  try {
+    lib::PartitioningCallbacks callbacks;
+    callbacks.cancellation_flag = cancellation_flag;
+    if ( progress_callback ) {
+      callbacks.progress_callback = [=](const utils::ProgressReporter::Phase phase,
+                                        const size_t level,
+                                        const uint64_t num_nodes,
+                                        const int64_t objective) {
+        mt_kahypar_progress_t progress;
+        progress.phase = to_phase(phase);
+        progress.level = level;
+        progress.num_nodes = num_nodes;
+        progress.objective = objective;
+        progress_callback(&progress, user_data);
+      };
+    }
+    return lib::partition(hypergraph, reinterpret_cast<const Context&>(*context), nullptr, &callbacks);
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+}
+
 mt_kahypar_partitioned_hypergraph_t mt_kahypar_map(mt_kahypar_hypergraph_t hypergraph,
                                                    mt_kahypar_target_graph_t* target_graph,
                                                    const mt_kahypar_context_t* context,
@@ -547,6 +648,37 @@ mt_kahypar_status_t mt_kahypar_improve_partition(mt_kahypar_partitioned_hypergra
   }
 }
 
+mt_kahypar_partitioned_hypergraph_t mt_kahypar_repartition_incrementally(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                                        const mt_kahypar_hypergraph_delta_t* delta,
+                                                                        const mt_kahypar_context_t* context,
+                                                                        mt_kahypar_hypergraph_t* updated_hypergraph,
+                                                                        mt_kahypar_error_t* error) {
+  *updated_hypergraph = mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+  try {
+    HypergraphDelta hg_delta;
+    hg_delta.removed_nodes.assign(delta->removed_nodes, delta->removed_nodes + delta->num_removed_nodes);
+    hg_delta.removed_edges.assign(delta->removed_edges, delta->removed_edges + delta->num_removed_edges);
+    if ( delta->added_node_weights ) {
+      hg_delta.added_node_weights.assign(delta->added_node_weights, delta->added_node_weights + delta->num_added_nodes);
+    } else {
+      hg_delta.added_node_weights.assign(delta->num_added_nodes, 1);
+    }
+    hg_delta.added_edges.resize(delta->num_added_edges);
+    for ( HyperedgeID he = 0; he < delta->num_added_edges; ++he ) {
+      hg_delta.added_edges[he].assign(delta->added_edges + delta->added_edge_indices[he],
+                                      delta->added_edges + delta->added_edge_indices[he + 1]);
+    }
+    if ( delta->added_edge_weights ) {
+      hg_delta.added_edge_weights.assign(delta->added_edge_weights, delta->added_edge_weights + delta->num_added_edges);
+    }
+    return lib::repartition_incrementally(partitioned_hg, hg_delta,
+      reinterpret_cast<const Context&>(*context), *updated_hypergraph);
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+}
+
 mt_kahypar_status_t mt_kahypar_improve_mapping(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                                mt_kahypar_target_graph_t* target_graph,
                                                const mt_kahypar_context_t* context,
@@ -564,6 +696,50 @@ mt_kahypar_status_t mt_kahypar_improve_mapping(mt_kahypar_partitioned_hypergraph
   }
 }
 
+mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition_in_execution_context(mt_kahypar_hypergraph_t hypergraph,
+                                                                            const mt_kahypar_context_t* context,
+                                                                            mt_kahypar_execution_context_t* execution_context,
+                                                                            mt_kahypar_error_t* error) {
+  try {
+    return lib::partition(hypergraph, reinterpret_cast<const Context&>(*context),
+                          reinterpret_cast<parallel::ExecutionContext*>(execution_context));
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+}
+
+mt_kahypar_partitioned_hypergraph_t mt_kahypar_map_in_execution_context(mt_kahypar_hypergraph_t hypergraph,
+                                                                      mt_kahypar_target_graph_t* target_graph,
+                                                                      const mt_kahypar_context_t* context,
+                                                                      mt_kahypar_execution_context_t* execution_context,
+                                                                      mt_kahypar_error_t* error) {
+  try {
+    return lib::map(hypergraph,
+                    reinterpret_cast<TargetGraph&>(*target_graph),
+                    reinterpret_cast<const Context&>(*context),
+                    reinterpret_cast<parallel::ExecutionContext*>(execution_context));
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+}
+
+mt_kahypar_status_t mt_kahypar_improve_partition_in_execution_context(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                                    const mt_kahypar_context_t* context,
+                                                                    const size_t num_vcycles,
+                                                                    mt_kahypar_execution_context_t* execution_context,
+                                                                    mt_kahypar_error_t* error) {
+  try {
+    lib::improve(partitioned_hg, reinterpret_cast<const Context&>(*context), num_vcycles,
+                 reinterpret_cast<parallel::ExecutionContext*>(execution_context));
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
 mt_kahypar_partitioned_hypergraph_t mt_kahypar_create_partitioned_hypergraph(mt_kahypar_hypergraph_t hypergraph,
                                                                              const mt_kahypar_context_t* context,
                                                                              const mt_kahypar_partition_id_t num_blocks,
@@ -606,6 +782,18 @@ mt_kahypar_status_t mt_kahypar_write_partition_to_file(const mt_kahypar_partitio
   }
 }
 
+mt_kahypar_status_t mt_kahypar_write_partition_to_binary_file(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                              const char* partition_file,
+                                                              mt_kahypar_error_t* error) {
+  try {
+    lib::write_partition_to_file<true>(partitioned_hg, partition_file, FileFormat::binary);
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
 
 mt_kahypar_partition_id_t mt_kahypar_num_blocks(const mt_kahypar_partitioned_hypergraph_t partitioned_hg) {
   return lib::num_blocks<false>(partitioned_hg);
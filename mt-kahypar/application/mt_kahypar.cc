@@ -30,8 +30,11 @@
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/io/command_line_options.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/io/presets.h"
+#include "mt-kahypar/parallel/large_allocation.h"
+#include "mt-kahypar/partition/memory_budget.h"
 #include "mt-kahypar/partition/partitioner_facade.h"
 #include "mt-kahypar/partition/registries/register_memory_pool.h"
 #include "mt-kahypar/partition/registries/registry.h"
@@ -62,7 +65,9 @@ int main(int argc, char* argv[]) {
 
   // Determine instance (graph or hypergraph) and partition type
   if ( context.partition.instance_type == InstanceType::UNDEFINED ) {
-    context.partition.instance_type = to_instance_type(context.partition.file_format);
+    context.partition.instance_type = context.partition.file_format == FileFormat::binary ?
+      io::instanceTypeOfBinaryFile(context.partition.graph_filename) :
+      to_instance_type(context.partition.file_format);
   }
   context.partition.partition_type = to_partition_c_type(
     context.partition.preset_type, context.partition.instance_type);
@@ -93,13 +98,24 @@ int main(int argc, char* argv[]) {
   TBBInitializer::instance(context.shared_memory.num_threads);
 
   #ifndef KAHYPAR_DISABLE_HWLOC
-    // We set the membind policy to interleaved allocations in order to
-    // distribute allocations evenly across NUMA nodes
     hwloc_cpuset_t cpuset = TBBInitializer::instance().used_cpuset();
-    parallel::HardwareTopology<>::instance().activate_interleaved_membind_policy(cpuset);
+    if ( context.shared_memory.interleaved_allocations ) {
+      // We set the membind policy to interleaved allocations in order to
+      // distribute allocations evenly across NUMA nodes
+      parallel::HardwareTopology<>::instance().activate_interleaved_membind_policy(cpuset);
+    } else {
+      // Pages are placed on the NUMA node of the thread that first touches them
+      // (see parallel::LargeAllocationPolicy)
+      parallel::HardwareTopology<>::instance().activate_first_touch_membind_policy(cpuset);
+      parallel::LargeAllocationPolicy::activate_first_touch();
+    }
     hwloc_bitmap_free(cpuset);
   #endif
 
+  if ( context.shared_memory.use_huge_pages ) {
+    parallel::LargeAllocationPolicy::activate_huge_pages();
+  }
+
   // Read Hypergraph
   utils::Timer& timer =
     utils::Utilities::instance().getTimer(context.utility_id);
@@ -127,8 +143,14 @@ int main(int argc, char* argv[]) {
     io::addFixedVerticesFromFile(hypergraph,
       context.partition.fixed_vertex_filename, context.partition.k);
     timer.stop_timer("read_fixed_vertices");
+  } else if ( context.partition.file_format == FileFormat::binary ) {
+    io::addFixedVerticesFromBinaryFile(hypergraph,
+      context.partition.graph_filename, context.partition.k);
   }
 
+  // Select data structures and algorithms that fit into the memory budget
+  apply_memory_budget(hypergraph, context);
+
   // Initialize Memory Pool and Algorithm/Policy Registries
   register_memory_pool(hypergraph, context);
   register_algorithms_and_policies();
@@ -156,7 +178,8 @@ int main(int argc, char* argv[]) {
 
   if (context.partition.write_partition_file) {
     PartitionerFacade::writePartitionFile(
-      partitioned_hypergraph, context.partition.graph_partition_filename);
+      partitioned_hypergraph, context.partition.graph_partition_filename,
+      context.partition.partition_file_format);
   }
 
   parallel::MemoryPool::instance().free_memory_chunks();
@@ -36,6 +36,7 @@
 #include <tbb_kahypar/parallel_invoke.h>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/large_allocation.h"
 #include "mt-kahypar/parallel/memory_pool.h"
 #include "mt-kahypar/parallel/stl/scalable_unique_ptr.h"
 #include "mt-kahypar/utils/exception.h"
@@ -371,6 +372,7 @@ class Array {
   void allocate_data(const size_type size) {
     _data = parallel::make_unique<value_type>(size);
     _underlying_data = _data.get();
+    parallel::LargeAllocationPolicy::advise_huge_pages(_underlying_data, sizeof(value_type) * size);
     _size = size;
   }
 
@@ -44,6 +44,7 @@
 #include "mt-kahypar/datastructures/contraction_tree.h"
 #include "mt-kahypar/datastructures/thread_safe_fast_reset_flag_array.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/partition/context_enum_classes.h"
 #include "mt-kahypar/utils/memory_tree.h"
 #include "mt-kahypar/utils/exception.h"
 
@@ -774,8 +775,11 @@ class DynamicHypergraph {
 
   // ####################### Contract / Uncontract #######################
 
-  DynamicHypergraph contract(parallel::scalable_vector<HypernodeID>&, bool deterministic = false) {
+  DynamicHypergraph contract(parallel::scalable_vector<HypernodeID>&,
+                             bool deterministic = false,
+                             IdenticalNetDetection identical_net_detection = IdenticalNetDetection::bucket_map) {
     unused(deterministic);
+    unused(identical_net_detection);
     throw UnsupportedOperationException(
       "contract(c, id) is not supported in dynamic hypergraph");
     return DynamicHypergraph();
@@ -34,6 +34,7 @@
 #include <tbb_kahypar/enumerable_thread_specific.h>
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/execution_context.h"
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/utils/timer.h"
@@ -143,7 +144,7 @@ namespace mt_kahypar::ds {
     auto get_cluster = [&](NodeID u) { assert(u < communities.size()); return communities[u]; };
     vec<NodeID> nodes_sorted_by_cluster(std::move(mapping));    // reuse memory from mapping since it's no longer needed
     auto cluster_bounds = parallel::counting_sort(nodes(), nodes_sorted_by_cluster, num_coarse_nodes,
-                                                  get_cluster, TBBInitializer::instance().total_number_of_threads());
+                                                  get_cluster, parallel::ExecutionContext::maxNumThreads());
 
     Graph coarse_graph;
     coarse_graph._num_nodes = num_coarse_nodes;
@@ -31,6 +31,7 @@
 #include <functional>
 #include <algorithm>
 #include <cassert>
+#include <type_traits>
 
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 
@@ -339,5 +340,352 @@ public:
 template<typename KeyT, typename IdT>
 using MaxHeap = Heap<KeyT, IdT, std::less<KeyT>, 2>;
 
+/*!
+ * Max priority queue for integral keys in the range [-max_key, max_key]. Each key has its
+ * own bucket and a pointer to the highest non-empty bucket is maintained, which gives
+ * O(1) insert, remove and key adjustments (deleteTop is amortized over the scan of the
+ * max pointer). Elements with equal keys are returned in LIFO order.
+ * Uses the same external position handles as Heap.
+ */
+template<typename KeyT, typename IdT>
+class BucketMaxQueue {
+  static_assert(std::is_integral<KeyT>::value);
+
+public:
+  explicit BucketMaxQueue(PosT* positions, size_t positions_size) :
+    elements(),
+    buckets(),
+    max_key(0),
+    top_bucket(0),
+    positions(positions),
+    positions_size(positions_size) { }
+
+  // ! Only allowed if the queue is empty
+  void setMaxKey(const KeyT key) {
+    ASSERT(empty() && key >= 0);
+    max_key = key;
+    buckets.resize(2 * static_cast<size_t>(key) + 1);
+    top_bucket = 0;
+  }
+
+  KeyT maxKey() const {
+    return max_key;
+  }
+
+  bool inRange(const KeyT key) const {
+    return key >= -max_key && key <= max_key;
+  }
+
+  IdT top() const {
+    ASSERT(!empty());
+    return elements[buckets[top_bucket].back()].id;
+  }
+
+  KeyT topKey() const {
+    ASSERT(!empty());
+    return static_cast<KeyT>(top_bucket) - max_key;
+  }
+
+  void deleteTop() {
+    ASSERT(!empty());
+    removeAtPos(buckets[top_bucket].back());
+  }
+
+  void insert(const IdT e, const KeyT k) {
+    ASSERT(!contains(e));
+    ASSERT(size() < positions_size);
+    ASSERT(inRange(k));
+    const PosT pos = size();
+    positions[e] = pos;
+    elements.push_back({k, e, 0});
+    addToBucket(pos);
+  }
+
+  void remove(const IdT e) {
+    ASSERT(contains(e));
+    removeAtPos(positions[e]);
+  }
+
+  void increaseKey(const IdT e, const KeyT newKey) {
+    adjustKey(e, newKey);
+  }
+
+  void decreaseKey(const IdT e, const KeyT newKey) {
+    adjustKey(e, newKey);
+  }
+
+  void adjustKey(const IdT e, const KeyT newKey) {
+    ASSERT(contains(e));
+    ASSERT(inRange(newKey));
+    const PosT pos = positions[e];
+    if ( elements[pos].key != newKey ) {
+      removeFromBucket(pos);
+      elements[pos].key = newKey;
+      addToBucket(pos);
+      updateTopBucket();
+    }
+  }
+
+  KeyT getKey(const IdT e) const {
+    ASSERT(contains(e));
+    return elements[positions[e]].key;
+  }
+
+  void insertOrAdjustKey(const IdT e, const KeyT newKey) {
+    if (contains(e)) {
+      adjustKey(e, newKey);
+    } else {
+      insert(e, newKey);
+    }
+  }
+
+  // ! Only touches non-empty buckets, such that the cost is linear in the queue size
+  void clear() {
+    for ( const Element& element : elements ) {
+      buckets[bucket(element.key)].clear();
+    }
+    elements.clear();
+    top_bucket = 0;
+  }
+
+  bool contains(const IdT e) const {
+    ASSERT(static_cast<size_t>(e) < positions_size);
+    return positions[e] < elements.size() && elements[positions[e]].id == e;
+  }
+
+  PosT size() const {
+    return static_cast<PosT>(elements.size());
+  }
+
+  bool empty() const {
+    return elements.empty();
+  }
+
+  KeyT keyAtPos(const PosT pos) const {
+    return elements[pos].key;
+  }
+
+  KeyT keyOf(const IdT id) const {
+    return elements[positions[id]].key;
+  }
+
+  IdT at(const PosT pos) const {
+    return elements[pos].id;
+  }
+
+  void setHandle(PosT* pos, size_t pos_size) {
+    clear();
+    positions = pos;
+    positions_size = pos_size;
+  }
+
+  size_t size_in_bytes() const {
+    size_t bucket_bytes = buckets.capacity() * sizeof(vec<PosT>);
+    for ( const vec<PosT>& b : buckets ) {
+      bucket_bytes += b.capacity() * sizeof(PosT);
+    }
+    return elements.capacity() * sizeof(Element) + bucket_bytes;
+  }
+
+private:
+  size_t bucket(const KeyT key) const {
+    return static_cast<size_t>(key + max_key);
+  }
+
+  void addToBucket(const PosT pos) {
+    const size_t b = bucket(elements[pos].key);
+    elements[pos].bucket_pos = static_cast<PosT>(buckets[b].size());
+    buckets[b].push_back(pos);
+    if ( b > top_bucket ) {
+      top_bucket = b;
+    }
+  }
+
+  void removeFromBucket(const PosT pos) {
+    vec<PosT>& b = buckets[bucket(elements[pos].key)];
+    const PosT bucket_pos = elements[pos].bucket_pos;
+    b[bucket_pos] = b.back();
+    elements[b[bucket_pos]].bucket_pos = bucket_pos;
+    b.pop_back();
+  }
+
+  void removeAtPos(const PosT pos) {
+    removeFromBucket(pos);
+    positions[elements[pos].id] = invalid_position;
+    const PosT last = size() - 1;
+    if ( pos != last ) {
+      elements[pos] = elements[last];
+      positions[elements[pos].id] = pos;
+      buckets[bucket(elements[pos].key)][elements[pos].bucket_pos] = pos;
+    }
+    elements.pop_back();
+    updateTopBucket();
+  }
+
+  // ! Moves the max pointer down to the highest non-empty bucket
+  void updateTopBucket() {
+    if ( empty() ) {
+      top_bucket = 0;
+    } else {
+      while ( buckets[top_bucket].empty() ) {
+        ASSERT(top_bucket > 0);
+        --top_bucket;
+      }
+    }
+  }
+
+  struct Element {
+    KeyT key;
+    IdT id;
+    PosT bucket_pos;
+  };
+
+  vec<Element> elements;
+  vec<vec<PosT>> buckets;
+  KeyT max_key;
+  size_t top_bucket;
+  PosT* positions;
+  size_t positions_size;
+};
+
+/*!
+ * Vertex priority queue of the localized FM searches. Uses a BucketMaxQueue if the
+ * gains are known to lie in a small range (see setMaxKey) and a MaxHeap otherwise.
+ * If a key outside of the bucket range is inserted, all elements are moved to the
+ * heap, which is used until the key range is configured again.
+ */
+template<typename KeyT, typename IdT>
+class AdaptiveMaxQueue {
+public:
+  explicit AdaptiveMaxQueue(PosT* positions, size_t positions_size) :
+    heap(positions, positions_size),
+    bucket_queue(positions, positions_size),
+    use_buckets(false) { }
+
+  // ! Uses the bucket queue for keys in [-key, key], or the heap if key is zero.
+  // ! Only allowed if the queue is empty.
+  void setMaxKey(const KeyT key) {
+    ASSERT(empty());
+    use_buckets = key > 0;
+    if ( use_buckets && key != bucket_queue.maxKey() ) {
+      bucket_queue.setMaxKey(key);
+    }
+  }
+
+  bool usesBuckets() const {
+    return use_buckets;
+  }
+
+  IdT top() const {
+    return use_buckets ? bucket_queue.top() : heap.top();
+  }
+
+  KeyT topKey() const {
+    return use_buckets ? bucket_queue.topKey() : heap.topKey();
+  }
+
+  void deleteTop() {
+    if ( use_buckets ) {
+      bucket_queue.deleteTop();
+    } else {
+      heap.deleteTop();
+    }
+  }
+
+  void insert(const IdT e, const KeyT k) {
+    if ( use_buckets && !bucket_queue.inRange(k) ) {
+      switchToHeap();
+    }
+    if ( use_buckets ) {
+      bucket_queue.insert(e, k);
+    } else {
+      heap.insert(e, k);
+    }
+  }
+
+  void remove(const IdT e) {
+    if ( use_buckets ) {
+      bucket_queue.remove(e);
+    } else {
+      heap.remove(e);
+    }
+  }
+
+  void adjustKey(const IdT e, const KeyT newKey) {
+    if ( use_buckets && !bucket_queue.inRange(newKey) ) {
+      switchToHeap();
+    }
+    if ( use_buckets ) {
+      bucket_queue.adjustKey(e, newKey);
+    } else {
+      heap.adjustKey(e, newKey);
+    }
+  }
+
+  void insertOrAdjustKey(const IdT e, const KeyT newKey) {
+    if (contains(e)) {
+      adjustKey(e, newKey);
+    } else {
+      insert(e, newKey);
+    }
+  }
+
+  KeyT getKey(const IdT e) const {
+    return use_buckets ? bucket_queue.getKey(e) : heap.getKey(e);
+  }
+
+  void clear() {
+    bucket_queue.clear();
+    heap.clear();
+  }
+
+  bool contains(const IdT e) const {
+    return use_buckets ? bucket_queue.contains(e) : heap.contains(e);
+  }
+
+  PosT size() const {
+    return use_buckets ? bucket_queue.size() : heap.size();
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  KeyT keyAtPos(const PosT pos) const {
+    return use_buckets ? bucket_queue.keyAtPos(pos) : heap.keyAtPos(pos);
+  }
+
+  KeyT keyOf(const IdT id) const {
+    return use_buckets ? bucket_queue.keyOf(id) : heap.keyOf(id);
+  }
+
+  IdT at(const PosT pos) const {
+    return use_buckets ? bucket_queue.at(pos) : heap.at(pos);
+  }
+
+  void setHandle(PosT* pos, size_t pos_size) {
+    heap.setHandle(pos, pos_size);
+    bucket_queue.setHandle(pos, pos_size);
+  }
+
+  size_t size_in_bytes() const {
+    return heap.size_in_bytes() + bucket_queue.size_in_bytes();
+  }
+
+private:
+  void switchToHeap() {
+    ASSERT(use_buckets && heap.empty());
+    for ( PosT pos = 0; pos < bucket_queue.size(); ++pos ) {
+      heap.insert(bucket_queue.at(pos), bucket_queue.keyAtPos(pos));
+    }
+    bucket_queue.clear();
+    use_buckets = false;
+  }
+
+  MaxHeap<KeyT, IdT> heap;
+  BucketMaxQueue<KeyT, IdT> bucket_queue;
+  bool use_buckets;
+};
+
 }
 }
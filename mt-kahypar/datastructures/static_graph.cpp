@@ -50,7 +50,9 @@ namespace mt_kahypar::ds {
    *
    * \param communities Community structure that should be contracted
    */
-  StaticGraph StaticGraph::contract(parallel::scalable_vector<HypernodeID>& communities, bool /*deterministic*/) {
+  StaticGraph StaticGraph::contract(parallel::scalable_vector<HypernodeID>& communities,
+                                    bool /*deterministic*/,
+                                    IdenticalNetDetection /*identical_net_detection*/) {
     ASSERT(communities.size() == _num_nodes);
 
     if ( !_tmp_contraction_buffer ) {
@@ -766,7 +766,9 @@ class StaticGraph {
    *
    * \param communities Community structure that should be contracted
    */
-  StaticGraph contract(parallel::scalable_vector<HypernodeID>& communities, bool deterministic = false);
+  StaticGraph contract(parallel::scalable_vector<HypernodeID>& communities,
+                       bool deterministic = false,
+                       IdenticalNetDetection identical_net_detection = IdenticalNetDetection::bucket_map);
 
   bool registerContraction(const HypernodeID, const HypernodeID) {
     throw UnsupportedOperationException(
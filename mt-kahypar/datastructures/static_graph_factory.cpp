@@ -73,19 +73,34 @@ namespace mt_kahypar::ds {
           const HypernodeWeight* node_weight,
           const bool stable_construction_of_incident_edges) {
     ASSERT(edge_vector.size() == num_edges);
-
-    EdgeVector edges;
-    edges.resize(num_edges);
     tbb_kahypar::parallel_for(UL(0), edge_vector.size(), [&](const size_t i) {
-      const auto& e = edge_vector[i];
-      if (e.size() != 2) {
+      if (edge_vector[i].size() != 2) {
+        throw InvalidInputException(
+          "Using graph data structure; but the input hypergraph is not a graph.");
+      }
+    });
+    return construct_impl(num_nodes, num_edges, [&](const size_t pos) {
+      return std::make_pair(edge_vector[pos][0], edge_vector[pos][1]);
+    }, edge_weight, node_weight, stable_construction_of_incident_edges);
+  }
+
+  StaticGraph StaticGraphFactory::construct_from_csr(
+          const HypernodeID num_nodes,
+          const HyperedgeID num_edges,
+          const size_t* edge_indices,
+          const HypernodeID* edges,
+          const HyperedgeWeight* edge_weight,
+          const HypernodeWeight* node_weight,
+          const bool stable_construction_of_incident_edges) {
+    tbb_kahypar::parallel_for(UL(0), UI64(num_edges), [&](const size_t i) {
+      if (edge_indices[i + 1] - edge_indices[i] != 2) {
         throw InvalidInputException(
           "Using graph data structure; but the input hypergraph is not a graph.");
       }
-      edges[i] = std::make_pair(e[0], e[1]);
     });
-    return construct_from_graph_edges(num_nodes, num_edges, edges,
-      edge_weight, node_weight, stable_construction_of_incident_edges);
+    return construct_impl(num_nodes, num_edges, [&](const size_t pos) {
+      return std::make_pair(edges[edge_indices[pos]], edges[edge_indices[pos] + 1]);
+    }, edge_weight, node_weight, stable_construction_of_incident_edges);
   }
 
   StaticGraph StaticGraphFactory::construct_from_graph_edges(
@@ -95,6 +110,20 @@ namespace mt_kahypar::ds {
           const HyperedgeWeight* edge_weight,
           const HypernodeWeight* node_weight,
           const bool stable_construction_of_incident_edges) {
+    ASSERT(edge_vector.size() == num_edges);
+    return construct_impl(num_nodes, num_edges, [&](const size_t pos) -> const std::pair<HypernodeID, HypernodeID>& {
+      return edge_vector[pos];
+    }, edge_weight, node_weight, stable_construction_of_incident_edges);
+  }
+
+  template<typename EdgeFunc>
+  StaticGraph StaticGraphFactory::construct_impl(
+          const HypernodeID num_nodes,
+          const HyperedgeID num_edges,
+          const EdgeFunc& edge,
+          const HyperedgeWeight* edge_weight,
+          const HypernodeWeight* node_weight,
+          const bool stable_construction_of_incident_edges) {
     StaticGraph graph;
     graph._num_nodes = num_nodes;
     graph._num_edges = 2 * num_edges;
@@ -102,13 +131,12 @@ namespace mt_kahypar::ds {
     graph._edges.resize(2 * num_edges);
     graph._unique_edge_ids.resize(2 * num_edges);
 
-    ASSERT(edge_vector.size() == num_edges);
-
     // Compute degree for each vertex
     ThreadLocalCounter local_degree_per_vertex(num_nodes);
     tbb_kahypar::parallel_for(ID(0), num_edges, [&](const size_t pos) {
       Counter& num_degree_per_vertex = local_degree_per_vertex.local();
-      const HypernodeID pins[2] = {edge_vector[pos].first, edge_vector[pos].second};
+      const auto [u, v] = edge(pos);
+      const HypernodeID pins[2] = {u, v};
       for (const HypernodeID& pin : pins) {
         ASSERT(pin < num_nodes, V(pin) << V(num_nodes));
         ++num_degree_per_vertex[pin];
@@ -136,11 +164,10 @@ namespace mt_kahypar::ds {
 
     auto setup_edges = [&] {
       tbb_kahypar::parallel_for(ID(0), num_edges, [&](const size_t pos) {
-        const HypernodeID pin0 = edge_vector[pos].first;
+        const auto [pin0, pin1] = edge(pos);
         const HyperedgeID incident_edges_pos0 = degree_prefix_sum[pin0] + incident_edges_position[pin0]++;
         ASSERT(incident_edges_pos0 < graph._edges.size());
         StaticGraph::Edge& edge0 = graph._edges[incident_edges_pos0];
-        const HypernodeID pin1 = edge_vector[pos].second;
         const HyperedgeID incident_edges_pos1 = degree_prefix_sum[pin1] + incident_edges_position[pin1]++;
         ASSERT(incident_edges_pos1 < graph._edges.size());
         StaticGraph::Edge& edge1 = graph._edges[incident_edges_pos1];
@@ -63,6 +63,17 @@ class StaticGraphFactory {
                                                 const HypernodeWeight* node_weight = nullptr,
                                                 const bool stable_construction_of_incident_edges = false);
 
+  // ! Constructs the graph directly from an adjacency array, i.e. the two endpoints of
+  // ! edge e are stored in edges[edge_indices[e]] and edges[edge_indices[e] + 1].
+  // ! No backwards edges allowed, i.e. each edge is unique
+  static StaticGraph construct_from_csr(const HypernodeID num_nodes,
+                                        const HyperedgeID num_edges,
+                                        const size_t* edge_indices,
+                                        const HypernodeID* edges,
+                                        const HyperedgeWeight* edge_weight = nullptr,
+                                        const HypernodeWeight* node_weight = nullptr,
+                                        const bool stable_construction_of_incident_edges = false);
+
   static std::pair<StaticGraph, parallel::scalable_vector<HypernodeID> > compactify(const StaticGraph&) {
     throw UnsupportedOperationException(
       "Compactify not implemented for static graph.");
@@ -72,6 +83,15 @@ class StaticGraphFactory {
   StaticGraphFactory() { }
 
   static void sort_incident_edges(StaticGraph& graph);
+
+  // ! Shared construction routine. edge(e) must return the pair of endpoints of edge e.
+  template<typename EdgeFunc>
+  static StaticGraph construct_impl(const HypernodeID num_nodes,
+                                    const HyperedgeID num_edges,
+                                    const EdgeFunc& edge,
+                                    const HyperedgeWeight* edge_weight,
+                                    const HypernodeWeight* node_weight,
+                                    const bool stable_construction_of_incident_edges);
 };
 
 } // namespace ds
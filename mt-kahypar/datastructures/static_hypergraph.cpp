@@ -49,6 +49,29 @@ namespace mt_kahypar::ds {
     bool valid = false;
   };
 
+  /*!
+   * This struct is used by the sort-based detection of parallel hyperedges.
+   * After sorting all contracted hyperedges by (hash, size, first pin, id),
+   * parallel hyperedges are contained in a run of adjacent entries with
+   * equal hash, size and first pin. Single-pin and disabled hyperedges
+   * keep the default values and are therefore placed at the end.
+   */
+  struct SortedHyperedgeInformation {
+    size_t hash = std::numeric_limits<size_t>::max();
+    HypernodeID size = std::numeric_limits<HypernodeID>::max();
+    HypernodeID first_pin = kInvalidHypernode;
+    HyperedgeID he = kInvalidHyperedge;
+
+    bool operator< (const SortedHyperedgeInformation& other) const {
+      return std::tie(hash, size, first_pin, he) <
+        std::tie(other.hash, other.size, other.first_pin, other.he);
+    }
+
+    bool isInSameRunAs(const SortedHyperedgeInformation& other) const {
+      return hash == other.hash && size == other.size && first_pin == other.first_pin;
+    }
+  };
+
   /*!
    * Contracts a given community structure. All vertices with the same label
    * are collapsed into the same vertex. The resulting single-pin and parallel
@@ -57,8 +80,12 @@ namespace mt_kahypar::ds {
    * community label (given in 'communities') to a vertex in the coarse hypergraph.
    *
    * \param communities Community structure that should be contracted
+   * \param deterministic If true, the incident nets of high degree vertices are sorted
+   * \param identical_net_detection Algorithm used to detect identical (parallel) nets
    */
-  StaticHypergraph StaticHypergraph::contract(parallel::scalable_vector<HypernodeID>& communities, bool deterministic) {
+  StaticHypergraph StaticHypergraph::contract(parallel::scalable_vector<HypernodeID>& communities,
+                                              bool deterministic,
+                                              IdenticalNetDetection identical_net_detection) {
 
     ASSERT(communities.size() == _num_hypernodes);
 
@@ -145,8 +172,14 @@ namespace mt_kahypar::ds {
     // that parallel and single-pin hyperedges are not removed from the incident nets (will be done
     // in a postprocessing step).
     auto cs2 = [](const HypernodeID x) { return x * x; };
+    const bool sort_based_detection = identical_net_detection == IdenticalNetDetection::parallel_sort;
     ConcurrentBucketMap<ContractedHyperedgeInformation> hyperedge_hash_map;
-    hyperedge_hash_map.reserve_for_estimated_number_of_insertions(_num_hyperedges);
+    Array<SortedHyperedgeInformation> sorted_hyperedges;
+    if ( sort_based_detection ) {
+      sorted_hyperedges.resizeNoAssign(_num_hyperedges);
+    } else {
+      hyperedge_hash_map.reserve_for_estimated_number_of_insertions(_num_hyperedges);
+    }
     tbb_kahypar::parallel_invoke([&] {
       // Contract Hyperedges
       tbb_kahypar::parallel_for(ID(0), _num_hyperedges, [&](const HyperedgeID& he) {
@@ -187,15 +220,26 @@ namespace mt_kahypar::ds {
             for ( size_t pos = incidence_array_start; pos < incidence_array_start + contracted_size; ++pos ) {
               footprint += cs2(tmp_incidence_array[pos]);
             }
-            hyperedge_hash_map.insert(footprint,
-                                      ContractedHyperedgeInformation{ he, footprint, contracted_size, true });
+            if ( sort_based_detection ) {
+              sorted_hyperedges[he] = SortedHyperedgeInformation{ footprint,
+                static_cast<HypernodeID>(contracted_size), tmp_incidence_array[incidence_array_start], he };
+            } else {
+              hyperedge_hash_map.insert(footprint,
+                                        ContractedHyperedgeInformation{ he, footprint, contracted_size, true });
+            }
           } else {
             // Hyperedge becomes a single-pin hyperedge
             valid_hyperedges[he] = 0;
             tmp_hyperedges[he].disable();
+            if ( sort_based_detection ) {
+              sorted_hyperedges[he] = SortedHyperedgeInformation();
+            }
           }
         } else {
           valid_hyperedges[he] = 0;
+          if ( sort_based_detection ) {
+            sorted_hyperedges[he] = SortedHyperedgeInformation();
+          }
         }
       });
     }, [&] {
@@ -304,6 +348,10 @@ namespace mt_kahypar::ds {
     // after its hash. A bucket is processed by one thread and parallel
     // hyperedges are detected by comparing the pins of hyperedges with
     // the same hash.
+    // If the sort-based detection is used, we instead sort all contracted
+    // hyperedges in parallel. Parallel hyperedges are then adjacent to each other
+    // and each run of hyperedges with equal hash, size and first pin is processed
+    // by one thread. This avoids that skewed buckets are processed sequentially.
 
     // Helper function that checks if two hyperedges are parallel
     // Note, pins inside the hyperedges are sorted.
@@ -327,40 +375,77 @@ namespace mt_kahypar::ds {
       }
     };
 
-    tbb_kahypar::parallel_for(UL(0), hyperedge_hash_map.numBuckets(), [&](const size_t bucket) {
-      auto& hyperedge_bucket = hyperedge_hash_map.getBucket(bucket);
-      std::sort(hyperedge_bucket.begin(), hyperedge_bucket.end(),
-                [&](const ContractedHyperedgeInformation& lhs, const ContractedHyperedgeInformation& rhs) {
-                  return std::tie(lhs.hash, lhs.size, lhs.he) < std::tie(rhs.hash, rhs.size, rhs.he);
-                });
-
-      // Parallel Hyperedge Detection
-      for ( size_t i = 0; i < hyperedge_bucket.size(); ++i ) {
-        ContractedHyperedgeInformation& contracted_he_lhs = hyperedge_bucket[i];
-        if ( contracted_he_lhs.valid ) {
-          const HyperedgeID lhs_he = contracted_he_lhs.he;
-          HyperedgeWeight lhs_weight = tmp_hyperedges[lhs_he].weight();
-          for ( size_t j = i + 1; j < hyperedge_bucket.size(); ++j ) {
-            ContractedHyperedgeInformation& contracted_he_rhs = hyperedge_bucket[j];
-            const HyperedgeID rhs_he = contracted_he_rhs.he;
-            if ( contracted_he_rhs.valid &&
-                 contracted_he_lhs.hash == contracted_he_rhs.hash &&
-                 check_if_hyperedges_are_parallel(lhs_he, rhs_he) ) {
-              // Hyperedges are parallel
-              lhs_weight += tmp_hyperedges[rhs_he].weight();
-              contracted_he_rhs.valid = false;
-              valid_hyperedges[rhs_he] = false;
-            } else if ( contracted_he_lhs.hash != contracted_he_rhs.hash  ) {
-              // In case, hash of both are not equal we go to the next hyperedge
-              // because we compared it with all hyperedges that had an equal hash
-              break;
+    if ( sort_based_detection ) {
+      tbb_kahypar::parallel_sort(sorted_hyperedges.begin(), sorted_hyperedges.end());
+      tbb_kahypar::parallel_for(UL(0), sorted_hyperedges.size(), [&](const size_t run_start) {
+        const SortedHyperedgeInformation& first = sorted_hyperedges[run_start];
+        if ( first.he == kInvalidHyperedge ||
+             ( run_start > 0 && sorted_hyperedges[run_start - 1].isInSameRunAs(first) ) ) {
+          // Entry does not start a run of potentially parallel hyperedges
+          return;
+        }
+
+        size_t run_end = run_start + 1;
+        while ( run_end < sorted_hyperedges.size() && sorted_hyperedges[run_end].isInSameRunAs(first) ) {
+          ++run_end;
+        }
+        if ( run_end - run_start == 1 ) {
+          return;
+        }
+
+        // Parallel Hyperedge Detection
+        for ( size_t i = run_start; i < run_end; ++i ) {
+          const HyperedgeID lhs_he = sorted_hyperedges[i].he;
+          if ( valid_hyperedges[lhs_he] ) {
+            HyperedgeWeight lhs_weight = tmp_hyperedges[lhs_he].weight();
+            for ( size_t j = i + 1; j < run_end; ++j ) {
+              const HyperedgeID rhs_he = sorted_hyperedges[j].he;
+              if ( valid_hyperedges[rhs_he] && check_if_hyperedges_are_parallel(lhs_he, rhs_he) ) {
+                // Hyperedges are parallel
+                lhs_weight += tmp_hyperedges[rhs_he].weight();
+                valid_hyperedges[rhs_he] = false;
+              }
             }
+            tmp_hyperedges[lhs_he].setWeight(lhs_weight);
           }
-          tmp_hyperedges[lhs_he].setWeight(lhs_weight);
         }
-      }
-      hyperedge_hash_map.free(bucket);
-    });
+      });
+    } else {
+      tbb_kahypar::parallel_for(UL(0), hyperedge_hash_map.numBuckets(), [&](const size_t bucket) {
+        auto& hyperedge_bucket = hyperedge_hash_map.getBucket(bucket);
+        std::sort(hyperedge_bucket.begin(), hyperedge_bucket.end(),
+                  [&](const ContractedHyperedgeInformation& lhs, const ContractedHyperedgeInformation& rhs) {
+                    return std::tie(lhs.hash, lhs.size, lhs.he) < std::tie(rhs.hash, rhs.size, rhs.he);
+                  });
+
+        // Parallel Hyperedge Detection
+        for ( size_t i = 0; i < hyperedge_bucket.size(); ++i ) {
+          ContractedHyperedgeInformation& contracted_he_lhs = hyperedge_bucket[i];
+          if ( contracted_he_lhs.valid ) {
+            const HyperedgeID lhs_he = contracted_he_lhs.he;
+            HyperedgeWeight lhs_weight = tmp_hyperedges[lhs_he].weight();
+            for ( size_t j = i + 1; j < hyperedge_bucket.size(); ++j ) {
+              ContractedHyperedgeInformation& contracted_he_rhs = hyperedge_bucket[j];
+              const HyperedgeID rhs_he = contracted_he_rhs.he;
+              if ( contracted_he_rhs.valid &&
+                   contracted_he_lhs.hash == contracted_he_rhs.hash &&
+                   check_if_hyperedges_are_parallel(lhs_he, rhs_he) ) {
+                // Hyperedges are parallel
+                lhs_weight += tmp_hyperedges[rhs_he].weight();
+                contracted_he_rhs.valid = false;
+                valid_hyperedges[rhs_he] = false;
+              } else if ( contracted_he_lhs.hash != contracted_he_rhs.hash  ) {
+                // In case, hash of both are not equal we go to the next hyperedge
+                // because we compared it with all hyperedges that had an equal hash
+                break;
+              }
+            }
+            tmp_hyperedges[lhs_he].setWeight(lhs_weight);
+          }
+        }
+        hyperedge_hash_map.free(bucket);
+      });
+    }
 
     // #################### STAGE 4 ####################
     // Coarsened hypergraph is constructed here by writting data from temporary
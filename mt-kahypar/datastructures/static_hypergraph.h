@@ -737,8 +737,12 @@ class StaticHypergraph {
    * community label (given in 'communities') to a vertex in the coarse hypergraph.
    *
    * \param communities Community structure that should be contracted
+   * \param deterministic If true, the incident nets of high degree vertices are sorted
+   * \param identical_net_detection Algorithm used to detect identical (parallel) nets
    */
-  StaticHypergraph contract(parallel::scalable_vector<HypernodeID>& communities, bool deterministic = false);
+  StaticHypergraph contract(parallel::scalable_vector<HypernodeID>& communities,
+                            bool deterministic = false,
+                            IdenticalNetDetection identical_net_detection = IdenticalNetDetection::bucket_map);
 
   bool registerContraction(const HypernodeID, const HypernodeID) {
     throw UnsupportedOperationException(
@@ -31,6 +31,7 @@
 #include <tbb_kahypar/parallel_invoke.h>
 
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
+#include "mt-kahypar/utils/range.h"
 #include "mt-kahypar/utils/timer.h"
 
 namespace mt_kahypar::ds {
@@ -42,14 +43,42 @@ namespace mt_kahypar::ds {
           const HyperedgeWeight* hyperedge_weight,
           const HypernodeWeight* hypernode_weight,
           const bool stable_construction_of_incident_edges) {
+    ASSERT(edge_vector.size() == num_hyperedges);
+    return construct_impl(num_hypernodes, num_hyperedges,
+      [&](const HyperedgeID he) -> const parallel::scalable_vector<HypernodeID>& {
+        return edge_vector[he];
+      }, hyperedge_weight, hypernode_weight, stable_construction_of_incident_edges);
+  }
+
+  StaticHypergraph StaticHypergraphFactory::construct_from_csr(
+          const HypernodeID num_hypernodes,
+          const HyperedgeID num_hyperedges,
+          const size_t* hyperedge_indices,
+          const HypernodeID* hyperedges,
+          const HyperedgeWeight* hyperedge_weight,
+          const HypernodeWeight* hypernode_weight,
+          const bool stable_construction_of_incident_edges) {
+    return construct_impl(num_hypernodes, num_hyperedges,
+      [&](const HyperedgeID he) {
+        return IteratorRange<const HypernodeID*>(
+          hyperedges + hyperedge_indices[he], hyperedges + hyperedge_indices[he + 1]);
+      }, hyperedge_weight, hypernode_weight, stable_construction_of_incident_edges);
+  }
+
+  template<typename EdgePinsFunc>
+  StaticHypergraph StaticHypergraphFactory::construct_impl(
+          const HypernodeID num_hypernodes,
+          const HyperedgeID num_hyperedges,
+          const EdgePinsFunc& edge_pins,
+          const HyperedgeWeight* hyperedge_weight,
+          const HypernodeWeight* hypernode_weight,
+          const bool stable_construction_of_incident_edges) {
     StaticHypergraph hypergraph;
     hypergraph._num_hypernodes = num_hypernodes;
     hypergraph._num_hyperedges = num_hyperedges;
     hypergraph._hypernodes.resize(num_hypernodes + 1);
     hypergraph._hyperedges.resize(num_hyperedges + 1);
 
-    ASSERT(edge_vector.size() == num_hyperedges);
-
     // Compute number of pins per hyperedge and number
     // of incident nets per vertex
     Counter num_pins_per_hyperedge(num_hyperedges, 0);
@@ -57,10 +86,11 @@ namespace mt_kahypar::ds {
     tbb_kahypar::enumerable_thread_specific<size_t> local_max_edge_size(UL(0));
     tbb_kahypar::parallel_for(ID(0), num_hyperedges, [&](const size_t pos) {
       Counter& num_incident_nets_per_vertex = local_incident_nets_per_vertex.local();
-      num_pins_per_hyperedge[pos] = edge_vector[pos].size();
-      local_max_edge_size.local() = std::max(
-              local_max_edge_size.local(), edge_vector[pos].size());
-      for ( const HypernodeID& pin : edge_vector[pos] ) {
+      auto pins = edge_pins(pos);
+      const size_t edge_size = std::distance(pins.begin(), pins.end());
+      num_pins_per_hyperedge[pos] = edge_size;
+      local_max_edge_size.local() = std::max(local_max_edge_size.local(), edge_size);
+      for ( const HypernodeID& pin : pins ) {
         ASSERT(pin < num_hypernodes, V(pin) << V(num_hypernodes));
         ++num_incident_nets_per_vertex[pin];
       }
@@ -115,7 +145,7 @@ namespace mt_kahypar::ds {
 
         const HyperedgeID he = pos;
         size_t incidence_array_pos = hyperedge.firstEntry();
-        for ( const HypernodeID& pin : edge_vector[pos] ) {
+        for ( const HypernodeID& pin : edge_pins(pos) ) {
           ASSERT(incidence_array_pos < hyperedge.firstInvalidEntry());
           ASSERT(pin < num_hypernodes);
           // Add pin to incidence array
@@ -51,6 +51,17 @@ class StaticHypergraphFactory {
                                     const HypernodeWeight* hypernode_weight = nullptr,
                                     const bool stable_construction_of_incident_edges = false);
 
+  // ! Constructs the hypergraph directly from an adjacency array, i.e. the pins of
+  // ! hyperedge he are stored in hyperedges[hyperedge_indices[he]..hyperedge_indices[he + 1]).
+  // ! Avoids materializing a separate vector per hyperedge.
+  static StaticHypergraph construct_from_csr(const HypernodeID num_hypernodes,
+                                             const HyperedgeID num_hyperedges,
+                                             const size_t* hyperedge_indices,
+                                             const HypernodeID* hyperedges,
+                                             const HyperedgeWeight* hyperedge_weight = nullptr,
+                                             const HypernodeWeight* hypernode_weight = nullptr,
+                                             const bool stable_construction_of_incident_edges = false);
+
   static std::pair<StaticHypergraph, vec<HypernodeID>> compactify(const StaticHypergraph&) {
     throw UnsupportedOperationException(
       "Compactify not implemented for static hypergraph.");
@@ -58,6 +69,15 @@ class StaticHypergraphFactory {
 
  private:
   StaticHypergraphFactory() { }
+
+  // ! Shared construction routine. edge_pins(he) must return an iterable range over the pins of he.
+  template<typename EdgePinsFunc>
+  static StaticHypergraph construct_impl(const HypernodeID num_hypernodes,
+                                         const HyperedgeID num_hyperedges,
+                                         const EdgePinsFunc& edge_pins,
+                                         const HyperedgeWeight* hyperedge_weight,
+                                         const HypernodeWeight* hypernode_weight,
+                                         const bool stable_construction_of_incident_edges);
 };
 
 } // namespace mt_kahypar
\ No newline at end of file
@@ -80,9 +80,29 @@ namespace mt_kahypar {
             ("write-partition-file",
              po::value<bool>(&context.partition.write_partition_file)->value_name("<bool>")->default_value(false),
              "If true, then partition output file is generated")
+            ("partition-file-format",
+             po::value<std::string>()->value_name("<string>")->notifier([&](const std::string& s) {
+               if (s == "hmetis") {
+                 context.partition.partition_file_format = FileFormat::hMetis;
+               } else if (s == "binary") {
+                 context.partition.partition_file_format = FileFormat::binary;
+               }
+             }),
+             "Format of the partition output file: \n"
+             " - hmetis : one block ID per line (default) \n"
+             " - binary : header followed by one int32 block ID per node")
             ("partition-output-folder",
              po::value<std::string>(&context.partition.graph_partition_output_folder)->value_name("<string>"),
              "Output folder for partition file")
+            ("read-coarsening-snapshot",
+             po::value<std::string>(&context.partition.coarsening_snapshot_input_file)->value_name("<string>"),
+             "Reads the multilevel hierarchy from a file written via --write-coarsening-snapshot and skips\n"
+             "community detection and coarsening. The snapshot must be computed for the same input, k, seed\n"
+             "and coarsening parameters (only supported in multilevel mode with direct k-way partitioning).")
+            ("write-coarsening-snapshot",
+             po::value<std::string>(&context.partition.coarsening_snapshot_output_file)->value_name("<string>"),
+             "Writes the multilevel hierarchy computed by coarsening to a file, which can be reused by later\n"
+             "runs with a different imbalance factor or objective function (see --read-coarsening-snapshot).")
             ("mode,m",
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&](const std::string& mode) {
@@ -98,11 +118,14 @@ namespace mt_kahypar {
                  context.partition.file_format = FileFormat::hMetis;
                } else if (s == "metis") {
                  context.partition.file_format = FileFormat::Metis;
+               } else if (s == "binary") {
+                 context.partition.file_format = FileFormat::binary;
                }
              }),
              "Input file format: \n"
              " - hmetis : hMETIS hypergraph file format \n"
-             " - metis : METIS graph file format")
+             " - metis : METIS graph file format \n"
+             " - binary : binary CSR format (see tool HgrToBinary)")
             ("instance-type",
              po::value<std::string>()->value_name("<string>")->notifier([&](const std::string& type) {
                context.partition.instance_type = instanceTypeFromString(type);
@@ -127,6 +150,10 @@ namespace mt_kahypar {
             ("num-vcycles",
              po::value<size_t>(&context.partition.num_vcycles)->value_name("<size_t>")->default_value(0),
              "Number of V-Cycles")
+            ("portfolio-size",
+             po::value<size_t>(&context.partition.portfolio_size)->value_name("<size_t>")->default_value(1),
+             "Number of seeds for which the hypergraph is coarsened and initially partitioned.\n"
+             "Only the run with the best initial partition is refined (only supported in multilevel mode).")
             ("perform-parallel-recursion-in-deep-multilevel",
              po::value<bool>(&context.partition.perform_parallel_recursion_in_deep_multilevel)->value_name("<bool>")->default_value(true),
              "If true, then we perform parallel recursion within the deep multilevel scheme.")
@@ -165,7 +192,14 @@ namespace mt_kahypar {
              po::value<bool>(&context.partition.enable_progress_bar)->value_name("<bool>")->default_value(false),
              "If true, shows a progress bar during coarsening and refinement phase.")
             ("time-limit", po::value<int>(&context.partition.time_limit)->value_name("<int>"),
-             "Time limit in seconds (currently not supported)")
+             "Time limit in seconds (0 = no time limit). If set, coarsening terminates early, initial partitioning "
+             "reduces its number of runs, refinement falls back to label propagation and V-cycles are skipped "
+             "once the corresponding share of the time limit is exceeded.")
+            ("max-memory", po::value<size_t>(&context.partition.max_memory)->value_name("<size_t>"),
+             "Memory budget in MB (0 = unlimited). The peak memory consumption is estimated before partitioning. "
+             "If it exceeds the budget, low-memory contraction in community detection is used, flows are disabled, "
+             "sparse connectivity information is used (hypergraphs) and FM refinement is disabled (in this order) "
+             "until the estimate fits into the budget. Otherwise, partitioning is aborted.")
             ("sp-process,s",
              po::value<bool>(&context.partition.sp_process_output)->value_name("<bool>")->default_value(false),
              "Summarize partitioning results in RESULT line compatible with sqlplottools "
@@ -198,6 +232,17 @@ namespace mt_kahypar {
             ("p-disable-community-detection-on-mesh-graphs",
              po::value<bool>(&context.preprocessing.disable_community_detection_for_mesh_graphs)->value_name("<bool>")->default_value(true),
              "If true, community detection is dynamically disabled for mesh graphs (as it is not effective for this type of graphs).")
+            ("p-node-ordering",
+             po::value<std::string>()->value_name("<string>")->notifier(
+                     [&](const std::string& ordering) {
+                       context.preprocessing.node_ordering = nodeOrderingFromString(ordering);
+                     })->default_value("none"),
+             "Relabels the nodes of a static (hyper)graph after preprocessing to improve cache locality.\n"
+             "The partition is mapped back to the original node IDs at the end:\n"
+             "- none\n"
+             "- community: nodes of the same community are consecutive (requires community detection)\n"
+             "- bfs: breadth-first search order\n"
+             "- degree: nodes are grouped into buckets of exponentially increasing degree")
             ("p-louvain-edge-weight-function",
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&](const std::string& type) {
@@ -303,6 +348,11 @@ namespace mt_kahypar {
              "- best\n"
              #endif
              "- best_prefer_unmatched")
+            ("c-rating-use-small-rating-map",
+             po::value<bool>(&context.coarsening.rating.use_small_rating_map)->value_name(
+                     "<bool>")->default_value(false),
+             "If true, then the ratings of vertices with at most 64 (estimated) neighbors are accumulated\n"
+             "in a small dense table that is searched with AVX2/AVX-512 instructions (if supported by the CPU).")
             ("c-vertex-degree-sampling-threshold",
              po::value<size_t>(&context.coarsening.vertex_degree_sampling_threshold)->value_name(
                      "<size_t>")->default_value(std::numeric_limits<size_t>::max()),
@@ -310,7 +360,26 @@ namespace mt_kahypar {
             ("c-num-sub-rounds",
              po::value<size_t>(&context.coarsening.num_sub_rounds_deterministic)->value_name(
                      "<size_t>")->default_value(16),
-             "Number of sub-rounds used for deterministic coarsening.");
+             "Number of sub-rounds used for deterministic coarsening.")
+            ("c-identical-net-detection",
+             po::value<std::string>()->value_name("<string>")->notifier(
+                     [&](const std::string& detection) {
+                       context.coarsening.identical_net_detection =
+                               mt_kahypar::identicalNetDetectionFromString(detection);
+                     })->default_value("bucket_map"),
+             "Algorithm used to detect identical nets during contraction of a hypergraph:\n"
+             " - bucket_map: distributes nets into buckets based on their footprint\n"
+             " - parallel_sort: sorts (footprint, size, first pin) tuples in parallel and compares adjacent nets")
+            ("c-two-hop-clustering",
+             po::value<bool>(&context.coarsening.use_two_hop_clustering)->value_name(
+                     "<bool>")->default_value(false),
+             "If true, vertices that remain unmatched in a clustering pass are grouped with other unmatched\n"
+             "vertices that prefer the same (too heavy) neighboring cluster, e.g. leaves around a hub vertex.\n"
+             "Only used by the multilevel coarsener if the pass shrinks the hypergraph by less than c-two-hop-shrink-factor-threshold.")
+            ("c-two-hop-shrink-factor-threshold",
+             po::value<double>(&context.coarsening.two_hop_shrink_factor_threshold)->value_name(
+                     "<double>")->default_value(1.5),
+             "Two-hop clustering is performed if a clustering pass shrinks the hypergraph by less than this factor.");
     return options;
   }
 
@@ -337,6 +406,12 @@ namespace mt_kahypar {
              po::value<size_t>((!initial_partitioning ? &context.refinement.min_border_vertices_per_thread :
                                 &context.initial_partitioning.refinement.min_border_vertices_per_thread))->value_name("<size_t>")->default_value(0),
              "Minimum number of border vertices per thread with which we perform a localized search (n-Level Partitioner).")
+            ((initial_partitioning ? "i-r-sparse-gain-cache" : "r-sparse-gain-cache"),
+             po::value<bool>((!initial_partitioning ? &context.refinement.sparse_gain_cache :
+                              &context.initial_partitioning.refinement.sparse_gain_cache))->value_name(
+                     "<bool>")->default_value(false),
+             "If true, the gain cache only stores benefit terms for the blocks adjacent to each node\n"
+             "(km1, cut and soed metric on hypergraphs). Reduces the memory of the gain cache for large k.")
             ((initial_partitioning ? "i-r-lp-type" : "r-lp-type"),
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&, initial_partitioning](const std::string& type) {
@@ -439,6 +514,11 @@ namespace mt_kahypar {
              po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.fm.release_nodes :
                               &context.refinement.fm.release_nodes))->value_name("<bool>")->default_value(true),
              "FM releases nodes that weren't moved, so they might be found by another search.")
+            ((initial_partitioning ? "i-r-fm-bucket-pq-max-gain" : "r-fm-bucket-pq-max-gain"),
+             po::value<Gain>((initial_partitioning ? &context.initial_partitioning.refinement.fm.bucket_pq_max_gain :
+                              &context.refinement.fm.bucket_pq_max_gain))->value_name("<int>")->default_value(0),
+             "FM uses bucket priority queues instead of binary heaps for the vertex PQs, if the weighted\n"
+             "degree of all nodes (an upper bound for the gains) is at most this value (default = 0 = disabled).")
             ((initial_partitioning ? "i-r-fm-threshold-border-node-inclusion" : "r-fm-threshold-border-node-inclusion"),
              po::value<double>((initial_partitioning ? &context.initial_partitioning.refinement.fm.treshold_border_node_inclusion :
                               &context.refinement.fm.treshold_border_node_inclusion))->value_name("<double>")->default_value(0.75),
@@ -724,7 +804,8 @@ namespace mt_kahypar {
              "Afterwards, each block of the partition is mapped onto a block of the target architecture graph.")
             ("max-steiner-tree-size",
              po::value<size_t>(&context.mapping.max_steiner_tree_size)->value_name("<size_t>"),
-             "We precompute all optimal steiner trees up to this size in the target graph.")
+             "We precompute all optimal steiner trees up to this size in the target graph.\n"
+             "The size is reduced for large target graphs to bound the running time of the precomputation.")
             ("mapping-largest-he-fraction",
              po::value<double>(&context.mapping.largest_he_fraction)->value_name("<double>"),
              "If x% (x = process-mapping-largest-he-fraction) of the largest hyperedges covers more than y% of the pins\n"
@@ -761,7 +842,14 @@ namespace mt_kahypar {
             ("s-shuffle-block-size",
              po::value<size_t>(&context.shared_memory.shuffle_block_size)->value_name("<size_t>"),
              "If we perform a localized random shuffle in parallel, we perform a parallel for over blocks of size"
-             "'shuffle_block_size' and shuffle them sequential.");
+             "'shuffle_block_size' and shuffle them sequential.")
+            ("s-interleaved-allocations",
+             po::value<bool>(&context.shared_memory.interleaved_allocations)->value_name("<bool>")->default_value(true),
+             "If true, memory is allocated interleaved across the used NUMA nodes. Otherwise, memory is placed on the\n"
+             "NUMA node of the thread that first touches it (large memory chunks are initialized in parallel).")
+            ("s-huge-pages",
+             po::value<bool>(&context.shared_memory.use_huge_pages)->value_name("<bool>")->default_value(false),
+             "If true, large allocations are backed by 2 MB transparent huge pages (if supported by the system).");
 
     return shared_memory_options;
   }
@@ -26,6 +26,8 @@
 
 #include "hypergraph_factory.h"
 
+#include <tbb_kahypar/parallel_for.h>
+
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/io/hypergraph_io.h"
@@ -54,6 +56,50 @@ mt_kahypar_hypergraph_t constructHypergraph(const HypernodeID& num_hypernodes,
     reinterpret_cast<mt_kahypar_hypergraph_s*>(hypergraph), Hypergraph::TYPE };
 }
 
+template<typename Hypergraph>
+mt_kahypar_hypergraph_t constructHypergraphFromCSR(const HypernodeID num_hypernodes,
+                                                   const HyperedgeID num_hyperedges,
+                                                   const vec<size_t>& hyperedge_indices,
+                                                   const vec<HypernodeID>& hyperedges,
+                                                   const HyperedgeWeight* hyperedge_weight,
+                                                   const HypernodeWeight* hypernode_weight,
+                                                   const HypernodeID num_removed_single_pin_hes,
+                                                   const bool stable_construction) {
+  Hypergraph* hypergraph = new Hypergraph();
+  *hypergraph = Hypergraph::Factory::construct_from_csr(num_hypernodes, num_hyperedges,
+    hyperedge_indices.data(), hyperedges.data(), hyperedge_weight, hypernode_weight, stable_construction);
+  hypergraph->setNumRemovedHyperedges(num_removed_single_pin_hes);
+  return mt_kahypar_hypergraph_t {
+    reinterpret_cast<mt_kahypar_hypergraph_s*>(hypergraph), Hypergraph::TYPE };
+}
+
+template<typename Hypergraph>
+mt_kahypar_hypergraph_t constructGraphFromEdges(const HypernodeID num_vertices,
+                                                const HyperedgeID num_edges,
+                                                const EdgeVector& edges,
+                                                const HyperedgeWeight* edge_weight,
+                                                const HypernodeWeight* node_weight,
+                                                const bool stable_construction) {
+  Hypergraph* graph = new Hypergraph();
+  *graph = Hypergraph::Factory::construct_from_graph_edges(num_vertices, num_edges, edges,
+    edge_weight, node_weight, stable_construction);
+  return mt_kahypar_hypergraph_t {
+    reinterpret_cast<mt_kahypar_hypergraph_s*>(graph), Hypergraph::TYPE };
+}
+
+// ! The dynamic data structures do not support construction from an adjacency array,
+// ! therefore we materialize the pin lists of the hyperedges
+HyperedgeVector toHyperedgeVector(const HyperedgeID num_hyperedges,
+                                  const size_t* hyperedge_indices,
+                                  const HypernodeID* hyperedges) {
+  HyperedgeVector result(num_hyperedges);
+  tbb_kahypar::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
+    result[he].assign(hyperedges + hyperedge_indices[he],
+                      hyperedges + hyperedge_indices[he + 1]);
+  });
+  return result;
+}
+
 mt_kahypar_hypergraph_t readHMetisFile(const std::string& filename,
                                         const mt_kahypar_hypergraph_type_t& type,
                                         const bool stable_construction,
@@ -61,37 +107,40 @@ mt_kahypar_hypergraph_t readHMetisFile(const std::string& filename,
   HyperedgeID num_hyperedges = 0;
   HypernodeID num_hypernodes = 0;
   HyperedgeID num_removed_single_pin_hyperedges = 0;
-  HyperedgeVector hyperedges;
+  vec<size_t> hyperedge_indices;
+  vec<HypernodeID> hyperedges;
   vec<HyperedgeWeight> hyperedges_weight;
   vec<HypernodeWeight> hypernodes_weight;
   readHypergraphFile(filename, num_hyperedges, num_hypernodes,
-                     num_removed_single_pin_hyperedges, hyperedges,
+                     num_removed_single_pin_hyperedges, hyperedge_indices, hyperedges,
                      hyperedges_weight, hypernodes_weight, remove_single_pin_hes);
 
   switch ( type ) {
     case STATIC_HYPERGRAPH:
-      return constructHypergraph<ds::StaticHypergraph>(
-        num_hypernodes, num_hyperedges, hyperedges,
+      return constructHypergraphFromCSR<ds::StaticHypergraph>(
+        num_hypernodes, num_hyperedges, hyperedge_indices, hyperedges,
         hyperedges_weight.data(), hypernodes_weight.data(),
         num_removed_single_pin_hyperedges, stable_construction);
     case STATIC_GRAPH:
       ENABLE_GRAPHS(
-        return constructHypergraph<ds::StaticGraph>(
-          num_hypernodes, num_hyperedges, hyperedges,
+        return constructHypergraphFromCSR<ds::StaticGraph>(
+          num_hypernodes, num_hyperedges, hyperedge_indices, hyperedges,
           hyperedges_weight.data(), hypernodes_weight.data(),
           num_removed_single_pin_hyperedges, stable_construction);
       )
     case DYNAMIC_HYPERGRAPH:
       ENABLE_HIGHEST_QUALITY(
         return constructHypergraph<ds::DynamicHypergraph>(
-          num_hypernodes, num_hyperedges, hyperedges,
+          num_hypernodes, num_hyperedges,
+          toHyperedgeVector(num_hyperedges, hyperedge_indices.data(), hyperedges.data()),
           hyperedges_weight.data(), hypernodes_weight.data(),
           num_removed_single_pin_hyperedges, stable_construction);
       )
     case DYNAMIC_GRAPH:
       ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(
         return constructHypergraph<ds::DynamicGraph>(
-          num_hypernodes, num_hyperedges, hyperedges,
+          num_hypernodes, num_hyperedges,
+          toHyperedgeVector(num_hyperedges, hyperedge_indices.data(), hyperedges.data()),
           hyperedges_weight.data(), hypernodes_weight.data(),
           num_removed_single_pin_hyperedges, stable_construction);
       )
@@ -107,30 +156,91 @@ mt_kahypar_hypergraph_t readMetisFile(const std::string& filename,
                                       const bool stable_construction) {
   HyperedgeID num_edges = 0;
   HypernodeID num_vertices = 0;
-  HyperedgeVector edges;
+  EdgeVector edges;
   vec<HyperedgeWeight> edges_weight;
   vec<HypernodeWeight> nodes_weight;
   readGraphFile(filename, num_edges, num_vertices, edges, edges_weight, nodes_weight);
 
   switch ( type ) {
     case STATIC_HYPERGRAPH:
-      return constructHypergraph<ds::StaticHypergraph>(
-        num_vertices, num_edges, edges,
-        edges_weight.data(), nodes_weight.data(), 0, stable_construction);
+      {
+        // Each edge occupies exactly two consecutive entries in the adjacency array
+        vec<size_t> edge_indices(num_edges + 1);
+        vec<HypernodeID> pins(2 * static_cast<size_t>(num_edges));
+        tbb_kahypar::parallel_for(ID(0), num_edges, [&](const HyperedgeID e) {
+          edge_indices[e] = 2 * static_cast<size_t>(e);
+          pins[2 * static_cast<size_t>(e)] = edges[e].first;
+          pins[2 * static_cast<size_t>(e) + 1] = edges[e].second;
+        });
+        edge_indices[num_edges] = pins.size();
+        return constructHypergraphFromCSR<ds::StaticHypergraph>(
+          num_vertices, num_edges, edge_indices, pins,
+          edges_weight.data(), nodes_weight.data(), 0, stable_construction);
+      }
     ENABLE_GRAPHS(case STATIC_GRAPH:
-      return constructHypergraph<ds::StaticGraph>(
+      return constructGraphFromEdges<ds::StaticGraph>(
         num_vertices, num_edges, edges,
-        edges_weight.data(), nodes_weight.data(), 0, stable_construction);
+        edges_weight.data(), nodes_weight.data(), stable_construction);
     )
     ENABLE_HIGHEST_QUALITY(case DYNAMIC_HYPERGRAPH:
-      return constructHypergraph<ds::DynamicHypergraph>(
-        num_vertices, num_edges, edges,
-        edges_weight.data(), nodes_weight.data(), 0, stable_construction);
+      {
+        HyperedgeVector hyperedges(num_edges);
+        tbb_kahypar::parallel_for(ID(0), num_edges, [&](const HyperedgeID e) {
+          hyperedges[e] = { edges[e].first, edges[e].second };
+        });
+        return constructHypergraph<ds::DynamicHypergraph>(
+          num_vertices, num_edges, hyperedges,
+          edges_weight.data(), nodes_weight.data(), 0, stable_construction);
+      }
     )
     ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(case DYNAMIC_GRAPH:
-      return constructHypergraph<ds::DynamicGraph>(
+      return constructGraphFromEdges<ds::DynamicGraph>(
         num_vertices, num_edges, edges,
-        edges_weight.data(), nodes_weight.data(), 0, stable_construction);
+        edges_weight.data(), nodes_weight.data(), stable_construction);
+    )
+    case NULLPTR_HYPERGRAPH:
+      return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+    default:
+      return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+  }
+}
+
+template<typename Hypergraph>
+mt_kahypar_hypergraph_t constructHypergraphFromCSR(const BinaryHypergraphFile& file,
+                                                   const bool stable_construction) {
+  Hypergraph* hypergraph = new Hypergraph();
+  *hypergraph = Hypergraph::Factory::construct_from_csr(file.numNodes(), file.numEdges(),
+    file.hyperedgeIndices(), file.hyperedges(), file.hyperedgeWeights(),
+    file.hypernodeWeights(), stable_construction);
+  hypergraph->setNumRemovedHyperedges(file.numRemovedSinglePinHyperedges());
+  return mt_kahypar_hypergraph_t {
+    reinterpret_cast<mt_kahypar_hypergraph_s*>(hypergraph), Hypergraph::TYPE };
+}
+
+template<typename Hypergraph>
+mt_kahypar_hypergraph_t constructHypergraphFromBinaryFile(const BinaryHypergraphFile& file,
+                                                          const bool stable_construction) {
+  return constructHypergraph<Hypergraph>(file.numNodes(), file.numEdges(),
+    toHyperedgeVector(file.numEdges(), file.hyperedgeIndices(), file.hyperedges()),
+    file.hyperedgeWeights(), file.hypernodeWeights(),
+    file.numRemovedSinglePinHyperedges(), stable_construction);
+}
+
+mt_kahypar_hypergraph_t readBinaryFile(const std::string& filename,
+                                       const mt_kahypar_hypergraph_type_t& type,
+                                       const bool stable_construction) {
+  BinaryHypergraphFile file(filename);
+  switch ( type ) {
+    case STATIC_HYPERGRAPH:
+      return constructHypergraphFromCSR<ds::StaticHypergraph>(file, stable_construction);
+    ENABLE_GRAPHS(case STATIC_GRAPH:
+      return constructHypergraphFromCSR<ds::StaticGraph>(file, stable_construction);
+    )
+    ENABLE_HIGHEST_QUALITY(case DYNAMIC_HYPERGRAPH:
+      return constructHypergraphFromBinaryFile<ds::DynamicHypergraph>(file, stable_construction);
+    )
+    ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(case DYNAMIC_GRAPH:
+      return constructHypergraphFromBinaryFile<ds::DynamicGraph>(file, stable_construction);
     )
     case NULLPTR_HYPERGRAPH:
       return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
@@ -153,6 +263,8 @@ mt_kahypar_hypergraph_t readInputFile(const std::string& filename,
       filename, type, stable_construction, remove_single_pin_hes);
     case FileFormat::Metis: return readMetisFile(
       filename, type, stable_construction);
+    case FileFormat::binary: return readBinaryFile(
+      filename, type, stable_construction);
   }
   return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
 }
@@ -169,6 +281,9 @@ Hypergraph readInputFile(const std::string& filename,
       break;
     case FileFormat::Metis: hypergraph = readMetisFile(
       filename, Hypergraph::TYPE, stable_construction);
+      break;
+    case FileFormat::binary: hypergraph = readBinaryFile(
+      filename, Hypergraph::TYPE, stable_construction);
   }
   return std::move(utils::cast<Hypergraph>(hypergraph));
 }
@@ -242,6 +357,19 @@ void addFixedVerticesFromFile(mt_kahypar_hypergraph_t hypergraph,
   addFixedVertices(hypergraph, fixed_vertices.data(), k);
 }
 
+void addFixedVerticesFromBinaryFile(mt_kahypar_hypergraph_t hypergraph,
+                                    const std::string& filename,
+                                    const PartitionID k) {
+  BinaryHypergraphFile file(filename);
+  if ( file.fixedVertices() ) {
+    if ( file.numNodes() != numberOfNodes(hypergraph) ) {
+      throw InvalidInputException(
+        "Fixed vertices in " + filename + " do not match the number of nodes of the hypergraph");
+    }
+    addFixedVertices(hypergraph, file.fixedVertices(), k);
+  }
+}
+
 void removeFixedVertices(mt_kahypar_hypergraph_t hypergraph) {
   switch ( hypergraph.type ) {
     case STATIC_HYPERGRAPH:
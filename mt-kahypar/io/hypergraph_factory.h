@@ -58,6 +58,11 @@ void addFixedVerticesFromFile(mt_kahypar_hypergraph_t hypergraph,
                               const std::string& filename,
                               const PartitionID k);
 
+// ! Adds the fixed vertices stored in a binary hypergraph file (does nothing if the file contains none)
+void addFixedVerticesFromBinaryFile(mt_kahypar_hypergraph_t hypergraph,
+                                    const std::string& filename,
+                                    const PartitionID k);
+
 void removeFixedVertices(mt_kahypar_hypergraph_t hypergraph);
 
 }  // namespace io
@@ -27,9 +27,16 @@
 
 #include "hypergraph_io.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <thread>
 #include <memory>
 #include <vector>
@@ -45,11 +52,19 @@
 #include <unistd.h>
 #endif
 
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
 
 #include <tbb_kahypar/parallel_for.h>
+#include <tbb_kahypar/parallel_invoke.h>
+#include <tbb_kahypar/parallel_reduce.h>
+#include <tbb_kahypar/task_arena.h>
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
+#include "mt-kahypar/utils/bit_ops.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/utils/exception.h"
 
@@ -174,25 +189,50 @@ namespace mt_kahypar::io {
 
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   void goto_next_line(char* mapped_file, size_t& pos, const size_t length) {
-    for ( ; ; ++pos ) {
-      if ( pos == length || is_line_ending(mapped_file, pos) ) {
-        do_line_ending(mapped_file, pos);
-        break;
-      }
+    // memchr is vectorized in all major C libraries
+    const char* next = pos < length ?
+      static_cast<const char*>(std::memchr(mapped_file + pos, '\n', length - pos)) : nullptr;
+    pos = next ? static_cast<size_t>(next - mapped_file) + 1 : length;
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  void skip_spaces(char* mapped_file, size_t& pos) {
+    while ( mapped_file[pos] == ' ' ) {
+      ++pos;
     }
   }
 
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   int64_t read_number(char* mapped_file, size_t& pos, const size_t length) {
     int64_t number = 0;
-    while ( mapped_file[pos] == ' ' ) {
-      ++pos;
+    skip_spaces(mapped_file, pos);
+    #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if ( pos + 8 <= length ) {
+      // Parse numbers with less than eight digits at once (SWAR): each byte that
+      // is not a digit has its most significant bit set in the mask below
+      uint64_t chunk;
+      std::memcpy(&chunk, mapped_file + pos, 8);
+      const uint64_t digits = chunk ^ UINT64_C(0x3030303030303030);
+      const uint64_t non_digits = ( ( digits + UINT64_C(0x7676767676767676) ) | digits ) &
+                                  UINT64_C(0x8080808080808080);
+      const int num_digits = non_digits != 0 ? utils::lowest_set_bit_64(non_digits) / 8 : 8;
+      if ( num_digits > 0 && num_digits < 8 ) {
+        // Move the digits to the most significant bytes and combine
+        // adjacent digits pairwise
+        uint64_t value = digits << ( 8 * ( 8 - num_digits ) );
+        value = ( value * 10 + ( value >> 8 ) ) & UINT64_C(0x00FF00FF00FF00FF);
+        value = ( value * 100 + ( value >> 16 ) ) & UINT64_C(0x0000FFFF0000FFFF);
+        value = ( value * 10000 + ( value >> 32 ) ) & UINT64_C(0x00000000FFFFFFFF);
+        pos += num_digits;
+        ASSERT(mapped_file[pos] == ' ' || is_line_ending(mapped_file, pos));
+        skip_spaces(mapped_file, pos);
+        return value;
+      }
     }
+    #endif
     for ( ; pos < length; ++pos ) {
       if ( mapped_file[pos] == ' ' || is_line_ending(mapped_file, pos) ) {
-        while ( mapped_file[pos] == ' ' ) {
-          ++pos;
-        }
+        skip_spaces(mapped_file, pos);
         break;
       }
       ASSERT(mapped_file[pos] >= '0' && mapped_file[pos] <= '9');
@@ -201,6 +241,124 @@ namespace mt_kahypar::io {
     return number;
   }
 
+  // ! Counts the line breaks in [begin, end) and how many of them start a comment line.
+  // ! A line break at end - 1 is not checked for a comment, since the next line
+  // ! belongs to the subsequent chunk.
+  std::pair<size_t, size_t> count_line_breaks(const char* mapped_file,
+                                              const size_t begin,
+                                              const size_t end) {
+    size_t num_line_breaks = 0;
+    size_t num_comments = 0;
+    size_t pos = begin;
+    #ifdef __AVX2__
+    const __m256i newline_256 = _mm256_set1_epi8('\n');
+    const __m256i comment_256 = _mm256_set1_epi8('%');
+    for ( ; pos + 33 <= end; pos += 32 ) {
+      const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mapped_file + pos));
+      const __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mapped_file + pos + 1));
+      const uint32_t line_breaks = _mm256_movemask_epi8(_mm256_cmpeq_epi8(current, newline_256));
+      const uint32_t comments = _mm256_movemask_epi8(_mm256_cmpeq_epi8(next, comment_256));
+      num_line_breaks += utils::popcount_64(line_breaks);
+      num_comments += utils::popcount_64(line_breaks & comments);
+    }
+    #endif
+    #ifdef __SSE2__
+    const __m128i newline_128 = _mm_set1_epi8('\n');
+    const __m128i comment_128 = _mm_set1_epi8('%');
+    for ( ; pos + 17 <= end; pos += 16 ) {
+      const __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mapped_file + pos));
+      const __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mapped_file + pos + 1));
+      const uint32_t line_breaks = _mm_movemask_epi8(_mm_cmpeq_epi8(current, newline_128));
+      const uint32_t comments = _mm_movemask_epi8(_mm_cmpeq_epi8(next, comment_128));
+      num_line_breaks += utils::popcount_64(line_breaks);
+      num_comments += utils::popcount_64(line_breaks & comments);
+    }
+    #endif
+    for ( ; pos < end; ++pos ) {
+      if ( mapped_file[pos] == '\n' ) {
+        ++num_line_breaks;
+        num_comments += ( pos + 1 < end && mapped_file[pos + 1] == '%' );
+      }
+    }
+    return std::make_pair(num_line_breaks, num_comments);
+  }
+
+  // ! Moves pos behind the next num_lines lines that are not comments
+  void skip_lines(char* mapped_file, size_t& pos, const size_t length, const size_t num_lines) {
+    for ( size_t i = 0; i < num_lines; ) {
+      ASSERT(pos < length);
+      i += ( mapped_file[pos] != '%' );
+      goto_next_line(mapped_file, pos, length);
+    }
+  }
+
+  struct LineRange {
+    const size_t start;
+    const size_t end;
+    const size_t first_line;
+    const size_t num_lines;
+  };
+
+  /*!
+   * Splits the next num_lines lines (excluding comments) starting at pos into ranges
+   * that can be parsed independently and moves pos behind them. The file is cut into
+   * chunks at line boundaries and the lines of each chunk are counted in parallel
+   * (vectorized), which replaces a sequential pass over the whole section.
+   */
+  vec<LineRange> computeLineRanges(char* mapped_file,
+                                   size_t& pos,
+                                   const size_t length,
+                                   const size_t num_lines) {
+    static constexpr size_t MIN_CHUNK_SIZE = 1 << 16;
+    const size_t num_bytes = length - pos;
+    const size_t num_chunks = std::max(UL(1), std::min(num_bytes / MIN_CHUNK_SIZE,
+      UL(2 * tbb_kahypar::this_task_arena::max_concurrency())));
+
+    vec<size_t> chunk_start(num_chunks + 1, length);
+    vec<size_t> chunk_lines(num_chunks, 0);
+    chunk_start[0] = pos;
+    tbb_kahypar::parallel_for(UL(1), num_chunks, [&](const size_t i) {
+      // Move chunk start to the beginning of the next line
+      size_t start = pos + ( num_bytes * i ) / num_chunks;
+      if ( mapped_file[start - 1] != '\n' ) {
+        goto_next_line(mapped_file, start, length);
+      }
+      chunk_start[i] = start;
+    });
+    tbb_kahypar::parallel_for(UL(0), num_chunks, [&](const size_t i) {
+      const size_t start = chunk_start[i];
+      const size_t end = chunk_start[i + 1];
+      if ( start < end ) {
+        const auto [num_line_breaks, num_comments] = count_line_breaks(mapped_file, start, end);
+        const bool has_unterminated_line = end == length && mapped_file[end - 1] != '\n';
+        chunk_lines[i] = num_line_breaks + has_unterminated_line -
+          num_comments - ( mapped_file[start] == '%' );
+      }
+    });
+
+    // Cut the chunks after the requested number of lines
+    vec<LineRange> ranges;
+    size_t current_line = 0;
+    for ( size_t i = 0; i < num_chunks && current_line < num_lines; ++i ) {
+      const size_t num_lines_of_range = std::min(chunk_lines[i], num_lines - current_line);
+      size_t end = chunk_start[i + 1];
+      if ( num_lines_of_range < chunk_lines[i] ) {
+        end = chunk_start[i];
+        skip_lines(mapped_file, end, length, num_lines_of_range);
+      }
+      if ( num_lines_of_range > 0 ) {
+        ranges.push_back(LineRange { chunk_start[i], end, current_line, num_lines_of_range });
+      }
+      current_line += num_lines_of_range;
+      pos = end;
+    }
+
+    if ( current_line < num_lines ) {
+      throw InvalidInputException("Input file contains less lines than specified in its header");
+    }
+    return ranges;
+  }
+
   void readHGRHeader(char* mapped_file,
                      size_t& pos,
                      const size_t length,
@@ -257,12 +415,25 @@ namespace mt_kahypar::io {
     size_t num_hes_with_duplicated_pins;
   };
 
+  // Counts the numbers in the current line (does not move the position)
+  size_t count_numbers_in_line(char* mapped_file, size_t pos, const size_t length) {
+    size_t num_numbers = 0;
+    bool in_number = false;
+    for ( ; pos < length && !is_line_ending(mapped_file, pos); ++pos ) {
+      const bool is_digit = mapped_file[pos] != ' ';
+      num_numbers += is_digit && !in_number;
+      in_number = is_digit;
+    }
+    return num_numbers;
+  }
+
   HyperedgeReadResult readHyperedges(char* mapped_file,
                                      size_t& pos,
                                      const size_t length,
                                      const HyperedgeID num_hyperedges,
                                      const mt_kahypar::Type type,
-                                     HyperedgeVector& hyperedges,
+                                     vec<size_t>& hyperedge_indices,
+                                     vec<HypernodeID>& hyperedges,
                                      vec<HyperedgeWeight>& hyperedges_weight,
                                      const bool remove_single_pin_hes) {
     HyperedgeReadResult res;
@@ -272,48 +443,41 @@ namespace mt_kahypar::io {
 
     vec<HyperedgeRange> hyperedge_ranges;
     tbb_kahypar::parallel_invoke([&] {
-      // Sequential pass over all hyperedges to determine ranges in the
-      // input file that are read in parallel.
-      size_t current_range_start = pos;
-      HyperedgeID current_range_start_id = 0;
-      HyperedgeID current_range_num_hyperedges = 0;
-      HyperedgeID current_num_hyperedges = 0;
-      const HyperedgeID num_hyperedges_per_range = std::max(
-              (num_hyperedges / ( 2 * std::thread::hardware_concurrency())), ID(1));
-      while ( current_num_hyperedges < num_hyperedges ) {
-        // Skip Comments
-        ASSERT(pos < length);
-        while ( mapped_file[pos] == '%' ) {
-          goto_next_line(mapped_file, pos, length);
-          ASSERT(pos < length);
+      // Determine ranges in the input file that are read in parallel
+      const vec<LineRange> line_ranges = computeLineRanges(mapped_file, pos, length, num_hyperedges);
+
+      // Count the hyperedges of each range that are not removed
+      vec<HyperedgeID> num_kept_hyperedges(line_ranges.size(), 0);
+      tbb_kahypar::parallel_for(UL(0), line_ranges.size(), [&](const size_t i) {
+        const LineRange& range = line_ranges[i];
+        if ( !remove_single_pin_hes ) {
+          num_kept_hyperedges[i] = range.num_lines;
+          return;
         }
-
-        // This check is fine even with windows line endings!
-        ASSERT(mapped_file[pos - 1] == '\n');
-        if ( !remove_single_pin_hes || !isSinglePinHyperedge(mapped_file, pos, length, has_hyperedge_weights) ) {
-          ++current_range_num_hyperedges;
-        } else {
-          ++res.num_removed_single_pin_hyperedges;
+        size_t current_pos = range.start;
+        while ( current_pos < range.end ) {
+          if ( mapped_file[current_pos] != '%' ) {
+            // This check is fine even with windows line endings!
+            ASSERT(mapped_file[current_pos - 1] == '\n');
+            num_kept_hyperedges[i] += !isSinglePinHyperedge(
+              mapped_file, current_pos, range.end, has_hyperedge_weights);
+          }
+          goto_next_line(mapped_file, current_pos, range.end);
         }
-        ++current_num_hyperedges;
-        goto_next_line(mapped_file, pos, length);
+      });
 
-        // If there are enough hyperedges in the current scanned range
-        // we store that range, which will be later processed in parallel
-        if ( current_range_num_hyperedges == num_hyperedges_per_range ) {
+      HyperedgeID current_range_start_id = 0;
+      for ( size_t i = 0; i < line_ranges.size(); ++i ) {
+        const LineRange& range = line_ranges[i];
+        res.num_removed_single_pin_hyperedges += range.num_lines - num_kept_hyperedges[i];
+        if ( num_kept_hyperedges[i] > 0 ) {
           hyperedge_ranges.push_back(HyperedgeRange {
-                  current_range_start, pos, current_range_start_id, current_range_num_hyperedges});
-          current_range_start = pos;
-          current_range_start_id += current_range_num_hyperedges;
-          current_range_num_hyperedges = 0;
+                  range.start, range.end, current_range_start_id, num_kept_hyperedges[i]});
+          current_range_start_id += num_kept_hyperedges[i];
         }
       }
-      if ( current_range_num_hyperedges > 0 ) {
-        hyperedge_ranges.push_back(HyperedgeRange {
-                current_range_start, pos, current_range_start_id, current_range_num_hyperedges});
-      }
     }, [&] {
-      hyperedges.resize(num_hyperedges);
+      hyperedge_indices.assign(num_hyperedges + 1, 0);
     }, [&] {
       if ( has_hyperedge_weights ) {
         hyperedges_weight.resize(num_hyperedges);
@@ -321,19 +485,18 @@ namespace mt_kahypar::io {
     });
 
     const HyperedgeID tmp_num_hyperedges = num_hyperedges - res.num_removed_single_pin_hyperedges;
-    hyperedges.resize(tmp_num_hyperedges);
+    hyperedge_indices.resize(tmp_num_hyperedges + 1);
     if ( has_hyperedge_weights ) {
       hyperedges_weight.resize(tmp_num_hyperedges);
     }
 
-    // Process all ranges in parallel and build hyperedge vector
-    tbb_kahypar::parallel_for(UL(0), hyperedge_ranges.size(), [&](const size_t i) {
-      HyperedgeRange& range = hyperedge_ranges[i];
+    // Calls f(he, pos) for each hyperedge in the range, where pos points to the
+    // first number of the corresponding line. f has to move pos to the next line.
+    auto for_each_hyperedge = [&](const HyperedgeRange& range, const auto& f) {
       size_t current_pos = range.start;
       const size_t current_end = range.end;
       HyperedgeID current_id = range.start_id;
       const HyperedgeID last_id = current_id + range.num_hyperedges;
-
       while ( current_id < last_id ) {
         // Skip Comments
         ASSERT(current_pos < current_end);
@@ -343,47 +506,78 @@ namespace mt_kahypar::io {
         }
 
         if ( !remove_single_pin_hes || !isSinglePinHyperedge(mapped_file, current_pos, current_end, has_hyperedge_weights) ) {
-          ASSERT(current_id < hyperedges.size());
-          if ( has_hyperedge_weights ) {
-            hyperedges_weight[current_id] = read_number(mapped_file, current_pos, current_end);
-          }
-
-          Hyperedge& hyperedge = hyperedges[current_id];
-          // Note, a hyperedge line must contain at least one pin
-          HypernodeID pin = read_number(mapped_file, current_pos, current_end);
-          ASSERT(pin > 0, V(current_id));
-          hyperedge.push_back(pin - 1);
-          while ( !is_line_ending(mapped_file, current_pos) ) {
-            pin = read_number(mapped_file, current_pos, current_end);
-            ASSERT(pin > 0, V(current_id));
-            hyperedge.push_back(pin - 1);
-          }
-          do_line_ending(mapped_file, current_pos);
-
-          // Detect duplicated pins
-          std::sort(hyperedge.begin(), hyperedge.end());
-          size_t j = 1;
-          for ( size_t i = 1; i < hyperedge.size(); ++i ) {
-            if ( hyperedge[j - 1] != hyperedge[i] ) {
-              std::swap(hyperedge[i], hyperedge[j++]);
-            }
-          }
-          if ( j < hyperedge.size() ) {
-            // Remove duplicated pins
-            __atomic_fetch_add(&res.num_hes_with_duplicated_pins, 1, __ATOMIC_RELAXED);
-            __atomic_fetch_add(&res.num_duplicated_pins, hyperedge.size() - j, __ATOMIC_RELAXED);
-            for ( size_t i = j; i < hyperedge.size(); ++i ) {
-              hyperedge.pop_back();
-            }
-          }
-
-          ASSERT(hyperedge.size() >= 2);
+          ASSERT(current_id < tmp_num_hyperedges);
+          f(current_id, current_pos, current_end);
           ++current_id;
         } else {
           goto_next_line(mapped_file, current_pos, current_end);
         }
       }
+    };
+
+    // First pass: count the pins of each hyperedge to determine
+    // the positions of the hyperedges in the adjacency array
+    tbb_kahypar::parallel_for(UL(0), hyperedge_ranges.size(), [&](const size_t i) {
+      for_each_hyperedge(hyperedge_ranges[i], [&](const HyperedgeID he, size_t& current_pos, const size_t current_end) {
+        const size_t num_numbers = count_numbers_in_line(mapped_file, current_pos, current_end);
+        ASSERT(num_numbers > (has_hyperedge_weights ? 1 : 0), V(he));
+        hyperedge_indices[he + 1] = num_numbers - (has_hyperedge_weights ? 1 : 0);
+        goto_next_line(mapped_file, current_pos, current_end);
+      });
+    });
+    parallel_prefix_sum(hyperedge_indices.begin(), hyperedge_indices.end(),
+      hyperedge_indices.begin(), std::plus<size_t>(), UL(0));
+    hyperedges.resize(hyperedge_indices.back());
+
+    // Second pass: read the pins of each hyperedge directly into the adjacency array
+    tbb_kahypar::parallel_for(UL(0), hyperedge_ranges.size(), [&](const size_t i) {
+      for_each_hyperedge(hyperedge_ranges[i], [&](const HyperedgeID he, size_t& current_pos, const size_t current_end) {
+        if ( has_hyperedge_weights ) {
+          hyperedges_weight[he] = read_number(mapped_file, current_pos, current_end);
+        }
+
+        // Note, a hyperedge line must contain at least one pin
+        const auto first = hyperedges.begin() + hyperedge_indices[he];
+        const auto last = hyperedges.begin() + hyperedge_indices[he + 1];
+        for ( auto it = first; it != last; ++it ) {
+          const HypernodeID pin = read_number(mapped_file, current_pos, current_end);
+          ASSERT(pin > 0, V(he));
+          *it = pin - 1;
+        }
+        ASSERT(is_line_ending(mapped_file, current_pos));
+        do_line_ending(mapped_file, current_pos);
+
+        // Detect duplicated pins
+        std::sort(first, last);
+        const auto unique_end = std::unique(first, last);
+        if ( unique_end != last ) {
+          // Duplicated pins are marked as invalid and removed afterwards
+          __atomic_fetch_add(&res.num_hes_with_duplicated_pins, 1, __ATOMIC_RELAXED);
+          __atomic_fetch_add(&res.num_duplicated_pins, std::distance(unique_end, last), __ATOMIC_RELAXED);
+          std::fill(unique_end, last, kInvalidHypernode);
+        }
+      });
     });
+
+    if ( res.num_duplicated_pins > 0 ) {
+      // Remove duplicated pins from the adjacency array
+      vec<size_t> compacted_indices(tmp_num_hyperedges + 1, 0);
+      tbb_kahypar::parallel_for(ID(0), tmp_num_hyperedges, [&](const HyperedgeID he) {
+        const auto first = hyperedges.begin() + hyperedge_indices[he];
+        const auto last = hyperedges.begin() + hyperedge_indices[he + 1];
+        compacted_indices[he + 1] = std::distance(first, std::find(first, last, kInvalidHypernode));
+      });
+      parallel_prefix_sum(compacted_indices.begin(), compacted_indices.end(),
+        compacted_indices.begin(), std::plus<size_t>(), UL(0));
+      vec<HypernodeID> compacted_hyperedges(compacted_indices.back());
+      tbb_kahypar::parallel_for(ID(0), tmp_num_hyperedges, [&](const HyperedgeID he) {
+        std::copy(hyperedges.begin() + hyperedge_indices[he],
+                  hyperedges.begin() + hyperedge_indices[he] + (compacted_indices[he + 1] - compacted_indices[he]),
+                  compacted_hyperedges.begin() + compacted_indices[he]);
+      });
+      hyperedge_indices = std::move(compacted_indices);
+      hyperedges = std::move(compacted_hyperedges);
+    }
     return res;
   }
 
@@ -399,6 +593,10 @@ namespace mt_kahypar::io {
     if ( has_hypernode_weights ) {
       hypernodes_weight.resize(num_hypernodes);
       for ( HypernodeID hn = 0; hn < num_hypernodes; ++hn ) {
+        // Skip Comments
+        while ( mapped_file[pos] == '%' ) {
+          goto_next_line(mapped_file, pos, length);
+        }
         ASSERT(pos > 0 && pos < length);
         ASSERT(mapped_file[pos - 1] == '\n');
         hypernodes_weight[hn] = read_number(mapped_file, pos, length);
@@ -412,7 +610,8 @@ namespace mt_kahypar::io {
                           HyperedgeID& num_hyperedges,
                           HypernodeID& num_hypernodes,
                           HyperedgeID& num_removed_single_pin_hyperedges,
-                          HyperedgeVector& hyperedges,
+                          vec<size_t>& hyperedge_indices,
+                          vec<HypernodeID>& hyperedges,
                           vec<HyperedgeWeight>& hyperedges_weight,
                           vec<HypernodeWeight>& hypernodes_weight,
                           const bool remove_single_pin_hes) {
@@ -427,7 +626,7 @@ namespace mt_kahypar::io {
     // Read Hyperedges
     HyperedgeReadResult res =
             readHyperedges(handle.mapped_file, pos, handle.length, num_hyperedges,
-              type, hyperedges, hyperedges_weight, remove_single_pin_hes);
+              type, hyperedge_indices, hyperedges, hyperedges_weight, remove_single_pin_hes);
     num_hyperedges -= res.num_removed_single_pin_hyperedges;
     num_removed_single_pin_hyperedges = res.num_removed_single_pin_hyperedges;
 
@@ -448,6 +647,24 @@ namespace mt_kahypar::io {
     munmap_file(handle);
   }
 
+  void readHypergraphFile(const std::string& filename,
+                          HyperedgeID& num_hyperedges,
+                          HypernodeID& num_hypernodes,
+                          HyperedgeID& num_removed_single_pin_hyperedges,
+                          HyperedgeVector& hyperedges,
+                          vec<HyperedgeWeight>& hyperedges_weight,
+                          vec<HypernodeWeight>& hypernodes_weight,
+                          const bool remove_single_pin_hes) {
+    vec<size_t> hyperedge_indices;
+    vec<HypernodeID> pins;
+    readHypergraphFile(filename, num_hyperedges, num_hypernodes, num_removed_single_pin_hyperedges,
+      hyperedge_indices, pins, hyperedges_weight, hypernodes_weight, remove_single_pin_hes);
+    hyperedges.resize(num_hyperedges);
+    tbb_kahypar::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
+      hyperedges[he].assign(pins.begin() + hyperedge_indices[he], pins.begin() + hyperedge_indices[he + 1]);
+    });
+  }
+
   void readMetisHeader(char* mapped_file,
                        size_t& pos,
                        const size_t length,
@@ -490,72 +707,56 @@ namespace mt_kahypar::io {
                     const HypernodeID num_vertices,
                     const bool has_edge_weights,
                     const bool has_vertex_weights,
-                    HyperedgeVector& edges,
+                    EdgeVector& edges,
                     vec<HyperedgeWeight>& edges_weight,
                     vec<HypernodeWeight>& vertices_weight) {
     vec<VertexRange> vertex_ranges;
     tbb_kahypar::parallel_invoke([&] {
-      // Sequential pass over all vertices to determine ranges in the
-      // input file that are read in parallel.
-      // Additionally, we need to sum the vertex degrees to determine edge indices.
-      size_t current_range_start = pos;
-      HypernodeID current_range_vertex_id = 0;
-      HypernodeID current_range_num_vertices = 0;
-      HyperedgeID current_range_edge_id = 0;
-      HyperedgeID current_range_num_edges = 0;
-      const HypernodeID num_vertices_per_range = std::max(
-              (num_vertices / ( 2 * std::thread::hardware_concurrency())), ID(1));
-      while ( current_range_vertex_id + current_range_num_vertices < num_vertices ) {
-        // Skip Comments
-        ASSERT(pos < length);
-        while ( mapped_file[pos] == '%' ) {
-          goto_next_line(mapped_file, pos, length);
-          ASSERT(pos < length);
-        }
-
-        ASSERT(mapped_file[pos - 1] == '\n');
-        ++current_range_num_vertices;
+      // Determine ranges in the input file that are read in parallel
+      const vec<LineRange> line_ranges = computeLineRanges(mapped_file, pos, length, num_vertices);
+
+      // Count the forward edges of each range, ignore backward edges.
+      // This is necessary because we can only calculate unique edge ids
+      // efficiently if the edges are deduplicated.
+      vec<HyperedgeID> num_forward_edges(line_ranges.size(), 0);
+      tbb_kahypar::parallel_for(UL(0), line_ranges.size(), [&](const size_t i) {
+        const LineRange& range = line_ranges[i];
+        size_t current_pos = range.start;
+        HypernodeID source = range.first_line;
+        const HypernodeID last_vertex_id = range.first_line + range.num_lines;
+        while ( source < last_vertex_id ) {
+          // Skip Comments
+          ASSERT(current_pos < range.end);
+          while ( mapped_file[current_pos] == '%' ) {
+            goto_next_line(mapped_file, current_pos, range.end);
+            ASSERT(current_pos < range.end);
+          }
 
-        // Count the forward edges, ignore backward edges.
-        // This is necessary because we can only calculate unique edge ids
-        // efficiently if the edges are deduplicated.
-        if ( has_vertex_weights ) {
-          read_number(mapped_file, pos, length);
-        }
-        HyperedgeID vertex_degree = 0;
-        while (!is_line_ending(mapped_file, pos) && pos < length) {
-          const HypernodeID source = current_range_vertex_id + current_range_num_vertices;
-          const HypernodeID target = read_number(mapped_file, pos, length);
-          ASSERT(source != target);
-          if ( source < target ) {
-            ++vertex_degree;
+          ASSERT(mapped_file[current_pos - 1] == '\n');
+          if ( has_vertex_weights ) {
+            read_number(mapped_file, current_pos, range.end);
           }
-          if ( has_edge_weights ) {
-            read_number(mapped_file, pos, length);
+          while ( !is_line_ending(mapped_file, current_pos) && current_pos < range.end ) {
+            const HypernodeID target = read_number(mapped_file, current_pos, range.end);
+            ASSERT(source + 1 != target);
+            num_forward_edges[i] += ( source + 1 < target );
+            if ( has_edge_weights ) {
+              read_number(mapped_file, current_pos, range.end);
+            }
           }
+          do_line_ending(mapped_file, current_pos);
+          ++source;
         }
-        do_line_ending(mapped_file, pos);
-        current_range_num_edges += vertex_degree;
-
-        // If there are enough vertices in the current scanned range
-        // we store that range, which will be processed in parallel later
-        if ( current_range_num_vertices == num_vertices_per_range ) {
-          vertex_ranges.push_back(VertexRange {
-                  current_range_start, pos, current_range_vertex_id, current_range_num_vertices, current_range_edge_id});
-          current_range_start = pos;
-          current_range_vertex_id += current_range_num_vertices;
-          current_range_num_vertices = 0;
-          current_range_edge_id += current_range_num_edges;
-          current_range_num_edges = 0;
-        }
-      }
-      if ( current_range_num_vertices > 0 ) {
+      });
+
+      HyperedgeID current_range_edge_id = 0;
+      for ( size_t i = 0; i < line_ranges.size(); ++i ) {
+        const LineRange& range = line_ranges[i];
         vertex_ranges.push_back(VertexRange {
-                current_range_start, pos, current_range_vertex_id, current_range_num_vertices, current_range_edge_id});
-        current_range_vertex_id += current_range_num_vertices;
-        current_range_edge_id += current_range_num_edges;
+                range.start, range.end, static_cast<HypernodeID>(range.first_line),
+                static_cast<HypernodeID>(range.num_lines), current_range_edge_id});
+        current_range_edge_id += num_forward_edges[i];
       }
-      ASSERT(current_range_vertex_id == num_vertices);
       ASSERT(current_range_edge_id == num_edges);
     }, [&] {
       edges.resize(num_edges);
@@ -610,9 +811,6 @@ namespace mt_kahypar::io {
           // process forward edges, ignore backward edges
           if ( current_vertex_id < (target - 1) ) {
             ASSERT(current_edge_id < edges.size());
-            // At this point, some magic is involved:
-            // In case of the graph partitioner, the right handed expression is considered a pair.
-            // In case of the hypergraph partitioner, the right handed expression is considered  a vector.
             edges[current_edge_id] = {current_vertex_id, target - 1};
 
             if ( has_edge_weights ) {
@@ -632,7 +830,7 @@ namespace mt_kahypar::io {
   void readGraphFile(const std::string& filename,
                      HyperedgeID& num_edges,
                      HypernodeID& num_vertices,
-                     HyperedgeVector& edges,
+                     EdgeVector& edges,
                      vec<HyperedgeWeight>& edges_weight,
                      vec<HypernodeWeight>& vertices_weight) {
     ASSERT(!filename.empty(), "No filename for metis file specified");
@@ -658,27 +856,368 @@ namespace mt_kahypar::io {
     munmap_file(handle);
   }
 
+  void readGraphFile(const std::string& filename,
+                     HyperedgeID& num_edges,
+                     HypernodeID& num_vertices,
+                     HyperedgeVector& edges,
+                     vec<HyperedgeWeight>& edges_weight,
+                     vec<HypernodeWeight>& vertices_weight) {
+    EdgeVector edge_vector;
+    readGraphFile(filename, num_edges, num_vertices, edge_vector, edges_weight, vertices_weight);
+    edges.resize(num_edges);
+    tbb_kahypar::parallel_for(ID(0), num_edges, [&](const HyperedgeID e) {
+      edges[e] = { edge_vector[e].first, edge_vector[e].second };
+    });
+  }
+
+  namespace {
+  constexpr size_t BINARY_SECTION_ALIGNMENT = 8;
+
+  size_t alignedSectionSize(const size_t bytes) {
+    return ( ( bytes + BINARY_SECTION_ALIGNMENT - 1 ) / BINARY_SECTION_ALIGNMENT ) * BINARY_SECTION_ALIGNMENT;
+  }
+
+  const BinaryHypergraphHeader& readBinaryHeader(const FileHandle& handle, const std::string& filename) {
+    if ( handle.length < sizeof(BinaryHypergraphHeader) ) {
+      throw InvalidInputException("File is too small to be a binary hypergraph file: " + filename);
+    }
+    const BinaryHypergraphHeader& header =
+      *reinterpret_cast<const BinaryHypergraphHeader*>(handle.mapped_file);
+    if ( std::memcmp(header.magic, BinaryHypergraphHeader::MAGIC, sizeof(header.magic)) != 0 ) {
+      throw InvalidInputException("File is not in binary hypergraph format: " + filename);
+    }
+    if ( header.version != BinaryHypergraphHeader::VERSION ) {
+      throw InvalidInputException("Unsupported binary hypergraph format version " +
+        std::to_string(header.version) + " (expected " +
+        std::to_string(BinaryHypergraphHeader::VERSION) + "): " + filename);
+    }
+    if ( header.id_bytes != sizeof(HypernodeID) || header.weight_bytes != sizeof(HypernodeWeight) ) {
+      throw InvalidInputException("Binary hypergraph file was written with " + std::to_string(8 * header.id_bytes) +
+        "-bit IDs, but this build uses " + std::to_string(8 * sizeof(HypernodeID)) + "-bit IDs: " + filename);
+    }
+    return header;
+  }
+
+  void writeSection(std::ofstream& out, const void* data, const size_t bytes) {
+    static const char padding[BINARY_SECTION_ALIGNMENT] = { 0 };
+    out.write(reinterpret_cast<const char*>(data), bytes);
+    out.write(padding, alignedSectionSize(bytes) - bytes);
+  }
+
+  // ! Checks that the hyperedge indices are non-decreasing and that each pin is a valid node ID
+  bool isValidAdjacencyArray(const uint64_t num_nodes,
+                             const uint64_t num_edges,
+                             const size_t* hyperedge_indices,
+                             const HypernodeID* hyperedges) {
+    return tbb_kahypar::parallel_reduce(
+      tbb_kahypar::blocked_range<size_t>(UL(0), num_edges), true,
+      [&](const tbb_kahypar::blocked_range<size_t>& range, bool is_valid) {
+        for ( size_t e = range.begin(); is_valid && e < range.end(); ++e ) {
+          is_valid = hyperedge_indices[e] <= hyperedge_indices[e + 1];
+          for ( size_t i = hyperedge_indices[e]; is_valid && i < hyperedge_indices[e + 1]; ++i ) {
+            is_valid = hyperedges[i] < num_nodes;
+          }
+        }
+        return is_valid;
+      }, std::logical_and<bool>());
+  }
+  } // namespace
+
+  BinaryHypergraphFile::BinaryHypergraphFile(const std::string& filename) :
+    _handle(std::make_unique<FileHandle>(mmap_file(filename))),
+    _header(nullptr),
+    _hyperedge_indices(nullptr),
+    _hyperedges(nullptr),
+    _hyperedge_weights(nullptr),
+    _hypernode_weights(nullptr),
+    _fixed_vertices(nullptr) {
+    static_assert(sizeof(size_t) == sizeof(uint64_t), "Binary hypergraph format requires 64-bit size_t");
+    try {
+      _header = &readBinaryHeader(*_handle, filename);
+    } catch ( ... ) {
+      munmap_file(*_handle);
+      throw;
+    }
+
+    // Compute section offsets and check that they match the file size. Each section
+    // must fit into the file, which also prevents overflows in the offset computation.
+    const char* data = _handle->mapped_file;
+    const uint64_t n = _header->num_hypernodes;
+    const uint64_t m = _header->num_hyperedges;
+    const size_t length = _handle->length;
+    if ( n >= std::numeric_limits<HypernodeID>::max() || m >= std::numeric_limits<HyperedgeID>::max() ||
+         m >= length / sizeof(size_t) || _header->num_pins > length / sizeof(HypernodeID) ||
+         n > length / sizeof(PartitionID) ) {
+      munmap_file(*_handle);
+      throw InvalidInputException("Binary hypergraph file is truncated or corrupted: " + filename);
+    }
+    size_t offset = alignedSectionSize(sizeof(BinaryHypergraphHeader));
+    auto next_section = [&](const size_t bytes) {
+      const char* section = data + offset;
+      offset += alignedSectionSize(bytes);
+      return section;
+    };
+    _hyperedge_indices = reinterpret_cast<const size_t*>(next_section((m + 1) * sizeof(size_t)));
+    _hyperedges = reinterpret_cast<const HypernodeID*>(next_section(_header->num_pins * sizeof(HypernodeID)));
+    if ( _header->flags & BinaryHypergraphHeader::HAS_HYPEREDGE_WEIGHTS ) {
+      _hyperedge_weights = reinterpret_cast<const HyperedgeWeight*>(next_section(m * sizeof(HyperedgeWeight)));
+    }
+    if ( _header->flags & BinaryHypergraphHeader::HAS_HYPERNODE_WEIGHTS ) {
+      _hypernode_weights = reinterpret_cast<const HypernodeWeight*>(next_section(n * sizeof(HypernodeWeight)));
+    }
+    if ( _header->flags & BinaryHypergraphHeader::HAS_FIXED_VERTICES ) {
+      _fixed_vertices = reinterpret_cast<const PartitionID*>(next_section(n * sizeof(PartitionID)));
+    }
+    if ( offset != length || _hyperedge_indices[0] != 0 || _hyperedge_indices[m] != _header->num_pins ||
+         !isValidAdjacencyArray(n, m, _hyperedge_indices, _hyperedges) ) {
+      munmap_file(*_handle);
+      throw InvalidInputException("Binary hypergraph file is truncated or corrupted: " + filename);
+    }
+  }
+
+  BinaryHypergraphFile::~BinaryHypergraphFile() {
+    munmap_file(*_handle);
+  }
+
+  void writeBinaryHypergraphFile(const std::string& filename,
+                                 const HypernodeID num_hypernodes,
+                                 const HyperedgeID num_hyperedges,
+                                 const size_t* hyperedge_indices,
+                                 const HypernodeID* hyperedges,
+                                 const HyperedgeWeight* hyperedge_weights,
+                                 const HypernodeWeight* hypernode_weights,
+                                 const PartitionID* fixed_vertices,
+                                 const HyperedgeID num_removed_single_pin_hyperedges,
+                                 const bool is_graph) {
+    std::ofstream out(filename, std::ios::binary);
+    if ( !out ) {
+      throw InvalidInputException("Could not open: " + filename);
+    }
+
+    BinaryHypergraphHeader header;
+    std::memset(&header, 0, sizeof(BinaryHypergraphHeader));
+    std::memcpy(header.magic, BinaryHypergraphHeader::MAGIC, sizeof(header.magic));
+    header.version = BinaryHypergraphHeader::VERSION;
+    header.flags = ( hyperedge_weights ? BinaryHypergraphHeader::HAS_HYPEREDGE_WEIGHTS : 0 ) |
+                   ( hypernode_weights ? BinaryHypergraphHeader::HAS_HYPERNODE_WEIGHTS : 0 ) |
+                   ( fixed_vertices ? BinaryHypergraphHeader::HAS_FIXED_VERTICES : 0 ) |
+                   ( is_graph ? BinaryHypergraphHeader::IS_GRAPH : 0 );
+    header.id_bytes = sizeof(HypernodeID);
+    header.weight_bytes = sizeof(HypernodeWeight);
+    header.num_hypernodes = num_hypernodes;
+    header.num_hyperedges = num_hyperedges;
+    header.num_pins = hyperedge_indices[num_hyperedges] - hyperedge_indices[0];
+    header.num_removed_single_pin_hyperedges = num_removed_single_pin_hyperedges;
+
+    writeSection(out, &header, sizeof(BinaryHypergraphHeader));
+    if ( hyperedge_indices[0] == 0 ) {
+      writeSection(out, hyperedge_indices, ( num_hyperedges + 1 ) * sizeof(size_t));
+    } else {
+      // Normalize indices such that they start at zero
+      vec<size_t> indices(num_hyperedges + 1);
+      for ( HyperedgeID he = 0; he <= num_hyperedges; ++he ) {
+        indices[he] = hyperedge_indices[he] - hyperedge_indices[0];
+      }
+      writeSection(out, indices.data(), indices.size() * sizeof(size_t));
+    }
+    writeSection(out, hyperedges + hyperedge_indices[0], header.num_pins * sizeof(HypernodeID));
+    if ( hyperedge_weights ) {
+      writeSection(out, hyperedge_weights, num_hyperedges * sizeof(HyperedgeWeight));
+    }
+    if ( hypernode_weights ) {
+      writeSection(out, hypernode_weights, num_hypernodes * sizeof(HypernodeWeight));
+    }
+    if ( fixed_vertices ) {
+      writeSection(out, fixed_vertices, num_hypernodes * sizeof(PartitionID));
+    }
+    out.close();
+    if ( !out ) {
+      throw SystemException("Error while writing binary hypergraph file: " + filename);
+    }
+  }
+
+  InstanceType instanceTypeOfBinaryFile(const std::string& filename) {
+    BinaryHypergraphFile file(filename);
+    return file.isGraph() ? InstanceType::graph : InstanceType::hypergraph;
+  }
+
+  namespace {
+  static_assert(sizeof(PartitionID) == sizeof(int32_t), "Binary partition format requires 32-bit block IDs");
+
+  // ! Number of nodes per chunk that is parsed or formatted by one task
+  constexpr size_t PARTITION_CHUNK_SIZE = 1 << 16;
+
+  size_t numPartitionChunks(const size_t num_nodes) {
+    return std::max(UL(1), std::min(num_nodes / PARTITION_CHUNK_SIZE,
+      UL(2 * tbb_kahypar::this_task_arena::max_concurrency())));
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  void skip_blanks(char* mapped_file, size_t& pos, const size_t length) {
+    while ( pos < length && ( mapped_file[pos] == ' ' || mapped_file[pos] == '\t' ) ) {
+      ++pos;
+    }
+  }
+
+  // ! Returns the (1-based) number of the line that contains pos.
+  // ! Only used for error messages, therefore it scans the file sequentially.
+  size_t line_number_of(const char* mapped_file, const size_t pos) {
+    return 1 + std::count(mapped_file, mapped_file + pos, '\n');
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  PartitionID read_block_id(char* mapped_file, size_t& pos, const size_t length, const std::string& filename) {
+    skip_blanks(mapped_file, pos, length);
+    const bool is_negative = pos < length && mapped_file[pos] == '-';
+    pos += is_negative;
+    if ( pos >= length || mapped_file[pos] < '0' || mapped_file[pos] > '9' ) {
+      throw InvalidInputException("Partition file contains an invalid block ID in line " +
+        std::to_string(line_number_of(mapped_file, pos)) + ": " + filename);
+    }
+    const int64_t block = read_number(mapped_file, pos, length);
+    skip_blanks(mapped_file, pos, length);
+    if ( pos < length && !is_line_ending(mapped_file, pos) ) {
+      throw InvalidInputException("Partition file contains more than one entry in line " +
+        std::to_string(line_number_of(mapped_file, pos)) + ": " + filename);
+    }
+    return static_cast<PartitionID>(is_negative ? -block : block);
+  }
+
+  // ! Parses one block ID per line (surrounded by optional spaces or tabs). The lines
+  // ! are split into ranges that are parsed in parallel (see computeLineRanges(...)).
+  // ! Note that a blank line is an invalid entry (except at the end of the file).
+  void readTextPartition(const FileHandle& handle,
+                         const HypernodeID num_nodes,
+                         PartitionID* partition,
+                         const std::string& filename) {
+    char* mapped_file = handle.mapped_file;
+    const size_t length = handle.length;
+    size_t pos = 0;
+    vec<LineRange> ranges;
+    try {
+      ranges = computeLineRanges(mapped_file, pos, length, num_nodes);
+    } catch ( const InvalidInputException& ) {
+      throw InvalidInputException("Input file has less entries than the number of nodes: " + filename);
+    }
+    for ( ; pos < length; ++pos ) {
+      if ( !std::isspace(static_cast<unsigned char>(mapped_file[pos])) ) {
+        throw InvalidInputException("Input file has more entries than the number of nodes: " + filename);
+      }
+    }
+
+    tbb_kahypar::parallel_for(UL(0), ranges.size(), [&](const size_t i) {
+      const LineRange& range = ranges[i];
+      size_t current_pos = range.start;
+      for ( size_t line = range.first_line; line < range.first_line + range.num_lines; ++line ) {
+        while ( mapped_file[current_pos] == '%' ) {
+          goto_next_line(mapped_file, current_pos, length);
+        }
+        partition[line] = read_block_id(mapped_file, current_pos, length, filename);
+        goto_next_line(mapped_file, current_pos, length);
+      }
+    });
+  }
+
+  void readBinaryPartition(const FileHandle& handle,
+                           const HypernodeID num_nodes,
+                           PartitionID* partition,
+                           const std::string& filename) {
+    BinaryPartitionHeader header;
+    std::memcpy(&header, handle.mapped_file, sizeof(BinaryPartitionHeader));
+    if ( header.version != BinaryPartitionHeader::VERSION ) {
+      throw InvalidInputException("Unsupported binary partition format version " +
+        std::to_string(header.version) + " (expected " +
+        std::to_string(BinaryPartitionHeader::VERSION) + "): " + filename);
+    }
+    if ( header.num_nodes > num_nodes ) {
+      throw InvalidInputException("Input file has more entries than the number of nodes: " + filename);
+    } else if ( header.num_nodes < num_nodes ) {
+      throw InvalidInputException("Input file has less entries than the number of nodes: " + filename);
+    } else if ( handle.length != sizeof(BinaryPartitionHeader) + num_nodes * sizeof(PartitionID) ) {
+      throw InvalidInputException("Binary partition file is truncated or corrupted: " + filename);
+    }
+
+    const char* block_ids = handle.mapped_file + sizeof(BinaryPartitionHeader);
+    tbb_kahypar::parallel_for(tbb_kahypar::blocked_range<size_t>(UL(0), num_nodes, PARTITION_CHUNK_SIZE),
+      [&](const tbb_kahypar::blocked_range<size_t>& range) {
+        std::memcpy(partition + range.begin(), block_ids + range.begin() * sizeof(PartitionID),
+          range.size() * sizeof(PartitionID));
+      });
+  }
+
+  using Buffer = std::pair<const char*, size_t>;
+
+  // ! Writes the buffers consecutively to a file. On POSIX systems, the file is written
+  // ! with one positioned write per buffer (in parallel) instead of a sequential stream.
+  void writeBuffers(const std::string& filename, const vec<Buffer>& buffers) {
+    #ifdef _WIN32
+    std::ofstream out(filename, std::ios::binary);
+    if ( !out ) {
+      throw InvalidInputException("Could not open: " + filename);
+    }
+    for ( const Buffer& buffer : buffers ) {
+      out.write(buffer.first, buffer.second);
+    }
+    out.close();
+    if ( !out ) {
+      throw SystemException("Error while writing file: " + filename);
+    }
+    #else
+    vec<size_t> offsets(buffers.size() + 1, 0);
+    for ( size_t i = 0; i < buffers.size(); ++i ) {
+      offsets[i + 1] = offsets[i] + buffers[i].second;
+    }
+
+    const int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if ( fd < 0 ) {
+      throw InvalidInputException("Could not open: " + filename);
+    }
+    std::atomic<bool> success(true);
+    tbb_kahypar::parallel_for(UL(0), buffers.size(), [&](const size_t i) {
+      size_t written = 0;
+      while ( written < buffers[i].second && success ) {
+        const ssize_t res = pwrite(fd, buffers[i].first + written,
+          buffers[i].second - written, offsets[i] + written);
+        if ( res > 0 ) {
+          written += res;
+        } else if ( res < 0 && errno != EINTR ) {
+          success = false;
+        }
+      }
+    });
+    if ( close(fd) != 0 || !success ) {
+      throw SystemException("Error while writing file: " + filename);
+    }
+    #endif
+  }
+  } // namespace
+
   template<typename InitFunc>
   void readPartitionFileImpl(const std::string& filename, HypernodeID num_nodes, InitFunc init_func) {
     ASSERT(!filename.empty(), "No filename for partition file specified");
-    std::ifstream file(filename);
-    if (file) {
-      PartitionID* partition = init_func();
-      int part;
-      HypernodeID hn = 0;
-      while (file >> part) {
-        if (hn >= num_nodes) {
-          throw InvalidInputException(std::string("Input file has more entries than the number of nodes: ") + filename);
-        }
-        partition[hn++] = part;
-      }
-      file.close();
-      if (hn < num_nodes) {
+    if ( file_size(filename) == 0 ) {
+      // Empty files can not be mapped to memory
+      init_func();
+      if ( num_nodes > 0 ) {
         throw InvalidInputException(std::string("Input file has less entries than the number of nodes: ") + filename);
       }
-    } else {
-      throw InvalidInputException(std::string("File not found: ") + filename);
+      return;
     }
+
+    FileHandle handle = mmap_file(filename);
+    try {
+      PartitionID* partition = init_func();
+      if ( handle.length >= sizeof(BinaryPartitionHeader) &&
+           std::memcmp(handle.mapped_file, BinaryPartitionHeader::MAGIC, sizeof(BinaryPartitionHeader::MAGIC)) == 0 ) {
+        readBinaryPartition(handle, num_nodes, partition, filename);
+      } else {
+        readTextPartition(handle, num_nodes, partition, filename);
+      }
+    } catch ( ... ) {
+      munmap_file(handle);
+      throw;
+    }
+    munmap_file(handle);
   }
 
   void readPartitionFile(const std::string& filename, HypernodeID num_nodes, std::vector<PartitionID>& partition) {
@@ -694,25 +1233,63 @@ namespace mt_kahypar::io {
   }
 
   template<typename PartitionedHypergraph>
-  void writePartitionFile(const PartitionedHypergraph& phg, const std::string& filename) {
+  void writePartitionFile(const PartitionedHypergraph& phg,
+                          const std::string& filename,
+                          const FileFormat format) {
     if (filename.empty()) {
       throw InvalidInputException("No filename for output partition file specified");
-    } else {
-      std::ofstream out_stream(filename.c_str());
-      std::vector<PartitionID> partition(phg.initialNumNodes(), -1);
-      for (const HypernodeID& hn : phg.nodes()) {
-        ASSERT(hn < partition.size());
-        partition[hn] = phg.partID(hn);
-      }
-      for (const PartitionID& part : partition) {
-        out_stream << part << std::endl;
+    }
+
+    const HypernodeID num_nodes = phg.initialNumNodes();
+    vec<PartitionID> partition(num_nodes, kInvalidPartition);
+    phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      ASSERT(hn < partition.size());
+      partition[hn] = phg.partID(hn);
+    });
+
+    const size_t num_chunks = numPartitionChunks(num_nodes);
+    auto chunk_begin = [&](const size_t chunk) {
+      return ( UL(num_nodes) * chunk ) / num_chunks;
+    };
+    if ( format == FileFormat::binary ) {
+      BinaryPartitionHeader header;
+      std::memset(&header, 0, sizeof(BinaryPartitionHeader));
+      std::memcpy(header.magic, BinaryPartitionHeader::MAGIC, sizeof(header.magic));
+      header.version = BinaryPartitionHeader::VERSION;
+      header.num_nodes = num_nodes;
+      vec<Buffer> buffers;
+      buffers.emplace_back(reinterpret_cast<const char*>(&header), sizeof(BinaryPartitionHeader));
+      for ( size_t chunk = 0; chunk < num_chunks; ++chunk ) {
+        buffers.emplace_back(reinterpret_cast<const char*>(partition.data() + chunk_begin(chunk)),
+          ( chunk_begin(chunk + 1) - chunk_begin(chunk) ) * sizeof(PartitionID));
       }
-      out_stream.close();
+      writeBuffers(filename, buffers);
+    } else {
+      // Each chunk is formatted into its own buffer (at most 11 characters
+      // per block ID plus line break)
+      static constexpr size_t MAX_LINE_LENGTH = 12;
+      vec<std::string> text(num_chunks);
+      vec<Buffer> buffers(num_chunks);
+      tbb_kahypar::parallel_for(UL(0), num_chunks, [&](const size_t chunk) {
+        std::string& out = text[chunk];
+        out.resize(( chunk_begin(chunk + 1) - chunk_begin(chunk) ) * MAX_LINE_LENGTH);
+        char* pos = out.data();
+        char* end = out.data() + out.size();
+        for ( size_t hn = chunk_begin(chunk); hn < chunk_begin(chunk + 1); ++hn ) {
+          pos = std::to_chars(pos, end, partition[hn]).ptr;
+          *pos++ = '\n';
+        }
+        out.resize(pos - out.data());
+        buffers[chunk] = Buffer(out.data(), out.size());
+      });
+      writeBuffers(filename, buffers);
     }
   }
 
   namespace {
-  #define WRITE_PARTITION_FILE(X) void writePartitionFile(const X& phg, const std::string& filename)
+  #define WRITE_PARTITION_FILE(X) void writePartitionFile(const X& phg,                 \
+                                                          const std::string& filename, \
+                                                          const FileFormat format)
   }
 
   INSTANTIATE_FUNC_WITH_PARTITIONED_HG(WRITE_PARTITION_FILE)
@@ -27,15 +27,32 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <utility>
 
 #include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/partition/context_enum_classes.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 
 namespace mt_kahypar {
 namespace io {
   using Hyperedge = vec<HypernodeID>;
   using HyperedgeVector = vec<Hyperedge>;
+  using EdgeVector = vec<std::pair<HypernodeID, HypernodeID>>;
+
+  // ! Reads a hypergraph in hMetis format directly into an adjacency array, i.e. the
+  // ! pins of hyperedge e are stored in hyperedges[hyperedge_indices[e]] up to
+  // ! hyperedges[hyperedge_indices[e + 1]] (exclusive).
+  void readHypergraphFile(const std::string& filename,
+                          HyperedgeID& num_hyperedges,
+                          HypernodeID& num_hypernodes,
+                          HyperedgeID& num_removed_single_pin_hyperedges,
+                          vec<size_t>& hyperedge_indices,
+                          vec<HypernodeID>& hyperedges,
+                          vec<HyperedgeWeight>& hyperedges_weight,
+                          vec<HypernodeWeight>& hypernodes_weight,
+                          const bool remove_single_pin_hes = true);
 
   void readHypergraphFile(const std::string& filename,
                           HyperedgeID& num_hyperedges,
@@ -46,6 +63,13 @@ namespace io {
                           vec<HypernodeWeight>& hypernodes_weight,
                           const bool remove_single_pin_hes = true);
 
+  void readGraphFile(const std::string& filename,
+                     HyperedgeID& num_edges,
+                     HypernodeID& num_vertices,
+                     EdgeVector& edges,
+                     vec<HyperedgeWeight>& edges_weight,
+                     vec<HypernodeWeight>& vertices_weight);
+
   void readGraphFile(const std::string& filename,
                      HyperedgeID& num_hyperedges,
                      HypernodeID& num_hypernodes,
@@ -53,11 +77,144 @@ namespace io {
                      vec<HyperedgeWeight>& hyperedges_weight,
                      vec<HypernodeWeight>& hypernodes_weight);
 
+  /*!
+   * Binary partition file format (little endian):
+   *  - header (see BinaryPartitionHeader)
+   *  - block IDs: num_nodes x int32_t
+   * The text format (hMetis) stores one block ID per line.
+   */
+  struct BinaryPartitionHeader {
+    static constexpr char MAGIC[8] = { 'M', 'T', 'K', 'H', 'P', 'A', 'R', 'T' };
+    static constexpr uint32_t VERSION = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t num_nodes;
+  };
+  static_assert(sizeof(BinaryPartitionHeader) == 24);
+
+  // ! Reads a partition file in text or binary format (detected automatically).
+  // ! The file is memory-mapped and parsed in parallel.
   void readPartitionFile(const std::string& filename, HypernodeID num_nodes, std::vector<PartitionID>& partition);
   void readPartitionFile(const std::string& filename, HypernodeID num_nodes, PartitionID* partition);
 
+  // ! Writes the partition in text (FileFormat::hMetis) or binary format (FileFormat::binary).
+  // ! Chunks of the file are formatted and written to their positions in parallel.
   template<typename PartitionedHypergraph>
-  void writePartitionFile(const PartitionedHypergraph& phg, const std::string& filename);
+  void writePartitionFile(const PartitionedHypergraph& phg,
+                          const std::string& filename,
+                          const FileFormat format = FileFormat::hMetis);
+
+  struct FileHandle;
+
+  /*!
+   * Binary CSR file format (little endian, all sections are aligned to 8 bytes):
+   *  - header (see BinaryHypergraphHeader)
+   *  - hyperedge indices: (num_hyperedges + 1) x uint64_t
+   *  - pins: num_pins x HypernodeID
+   *  - hyperedge weights: num_hyperedges x HyperedgeWeight (optional)
+   *  - hypernode weights: num_hypernodes x HypernodeWeight (optional)
+   *  - fixed vertices: num_hypernodes x PartitionID, -1 if free (optional)
+   * Since the sections have exactly the layout of the in-memory arrays, a hypergraph
+   * can be constructed directly from the memory-mapped file.
+   */
+  struct BinaryHypergraphHeader {
+    static constexpr char MAGIC[8] = { 'M', 'T', 'K', 'H', 'P', 'C', 'S', 'R' };
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t HAS_HYPEREDGE_WEIGHTS = 1 << 0;
+    static constexpr uint32_t HAS_HYPERNODE_WEIGHTS = 1 << 1;
+    static constexpr uint32_t HAS_FIXED_VERTICES = 1 << 2;
+    static constexpr uint32_t IS_GRAPH = 1 << 3;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint8_t id_bytes;
+    uint8_t weight_bytes;
+    uint8_t reserved[6];
+    uint64_t num_hypernodes;
+    uint64_t num_hyperedges;
+    uint64_t num_pins;
+    uint64_t num_removed_single_pin_hyperedges;
+  };
+  static_assert(sizeof(BinaryHypergraphHeader) == 56);
+
+  // ! Read-only, memory-mapped view on a hypergraph file in binary CSR format.
+  // ! The file is unmapped when the object is destroyed.
+  class BinaryHypergraphFile {
+   public:
+    explicit BinaryHypergraphFile(const std::string& filename);
+    BinaryHypergraphFile(const BinaryHypergraphFile&) = delete;
+    BinaryHypergraphFile& operator= (const BinaryHypergraphFile&) = delete;
+    ~BinaryHypergraphFile();
+
+    HypernodeID numNodes() const {
+      return _header->num_hypernodes;
+    }
+
+    HyperedgeID numEdges() const {
+      return _header->num_hyperedges;
+    }
+
+    size_t numPins() const {
+      return _header->num_pins;
+    }
+
+    HyperedgeID numRemovedSinglePinHyperedges() const {
+      return _header->num_removed_single_pin_hyperedges;
+    }
+
+    bool isGraph() const {
+      return _header->flags & BinaryHypergraphHeader::IS_GRAPH;
+    }
+
+    const size_t* hyperedgeIndices() const {
+      return _hyperedge_indices;
+    }
+
+    const HypernodeID* hyperedges() const {
+      return _hyperedges;
+    }
+
+    // ! Returns nullptr, if the file contains no hyperedge weights
+    const HyperedgeWeight* hyperedgeWeights() const {
+      return _hyperedge_weights;
+    }
+
+    // ! Returns nullptr, if the file contains no hypernode weights
+    const HypernodeWeight* hypernodeWeights() const {
+      return _hypernode_weights;
+    }
+
+    // ! Returns nullptr, if the file contains no fixed vertices
+    const PartitionID* fixedVertices() const {
+      return _fixed_vertices;
+    }
+
+   private:
+    std::unique_ptr<FileHandle> _handle;
+    const BinaryHypergraphHeader* _header;
+    const size_t* _hyperedge_indices;
+    const HypernodeID* _hyperedges;
+    const HyperedgeWeight* _hyperedge_weights;
+    const HypernodeWeight* _hypernode_weights;
+    const PartitionID* _fixed_vertices;
+  };
+
+  void writeBinaryHypergraphFile(const std::string& filename,
+                                 const HypernodeID num_hypernodes,
+                                 const HyperedgeID num_hyperedges,
+                                 const size_t* hyperedge_indices,
+                                 const HypernodeID* hyperedges,
+                                 const HyperedgeWeight* hyperedge_weights = nullptr,
+                                 const HypernodeWeight* hypernode_weights = nullptr,
+                                 const PartitionID* fixed_vertices = nullptr,
+                                 const HyperedgeID num_removed_single_pin_hyperedges = 0,
+                                 const bool is_graph = false);
+
+  // ! Reads only the header of a binary file to decide whether it stores a graph or a hypergraph
+  InstanceType instanceTypeOfBinaryFile(const std::string& filename);
 
 }  // namespace io
 }  // namespace mt_kahypar
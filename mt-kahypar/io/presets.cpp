@@ -513,13 +513,23 @@ std::vector<option> load_large_k_preset() {
     // main -> refinement
     create_option("r-rebalancer-type", "advanced_rebalancer"),
     create_option("r-refine-until-no-improvement", "false"),
+    create_option("r-sparse-gain-cache", "true"),
     // main -> refinement -> label_propagation
     create_option("r-lp-type", "label_propagation"),
     create_option("r-lp-maximum-iterations", "5"),
     create_option("r-lp-rebalancing", "true"),
     create_option("r-lp-he-size-activation-threshold", "100"),
     // main -> refinement -> fm
-    create_option("r-fm-type", "do_nothing"),
+    create_option("r-fm-type", "kway_fm"),
+    create_option("r-fm-multitry-rounds", "10"),
+    create_option("r-fm-rollback-parallel", "true"),
+    create_option("r-fm-rollback-balance-violation-factor", "1.0"),
+    create_option("r-fm-seed-nodes", "25"),
+    create_option("r-fm-release-nodes", "true"),
+    create_option("r-fm-min-improvement", "-1.0"),
+    create_option("r-fm-obey-minimal-parallelism", "true"),
+    create_option("r-fm-time-limit-factor", "0.25"),
+    create_option("r-fm-iter-moves-on-recalc", "true"),
     // main -> refinement -> flows
     create_option("r-flow-algo", "do_nothing"),
   };
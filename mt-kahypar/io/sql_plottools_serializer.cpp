@@ -63,7 +63,9 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " seed=" << context.partition.seed
         << " num_vcycles=" << context.partition.num_vcycles
         << " deterministic=" << context.partition.deterministic
-        << " perform_parallel_recursion_in_deep_multilevel=" << context.partition.perform_parallel_recursion_in_deep_multilevel;
+        << " perform_parallel_recursion_in_deep_multilevel=" << context.partition.perform_parallel_recursion_in_deep_multilevel
+        << " portfolio_size=" << context.partition.portfolio_size
+        << " max_memory=" << context.partition.max_memory;
     oss << " large_hyperedge_size_threshold_factor=" << context.partition.large_hyperedge_size_threshold_factor
         << " smallest_large_he_size_threshold=" << context.partition.smallest_large_he_size_threshold
         << " large_hyperedge_size_threshold=" << context.partition.large_hyperedge_size_threshold
@@ -80,7 +82,8 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " community_min_vertex_move_fraction=" << context.preprocessing.community_detection.min_vertex_move_fraction
         << " community_vertex_degree_sampling_threshold=" << context.preprocessing.community_detection.vertex_degree_sampling_threshold
         << " community_num_sub_rounds_deterministic=" << context.preprocessing.community_detection.num_sub_rounds_deterministic
-        << " community_low_memory_contraction=" << context.preprocessing.community_detection.low_memory_contraction;
+        << " community_low_memory_contraction=" << context.preprocessing.community_detection.low_memory_contraction
+        << " node_ordering=" << context.preprocessing.node_ordering;
     oss << " coarsening_algorithm=" << context.coarsening.algorithm
         << " coarsening_contraction_limit_multiplier=" << context.coarsening.contraction_limit_multiplier
         << " coarsening_deep_ml_contraction_limit_multiplier=" << context.coarsening.deep_ml_contraction_limit_multiplier
@@ -92,9 +95,13 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " coarsening_vertex_degree_sampling_threshold=" << context.coarsening.vertex_degree_sampling_threshold
         << " coarsening_num_sub_rounds_deterministic=" << context.coarsening.num_sub_rounds_deterministic
         << " coarsening_contraction_limit=" << context.coarsening.contraction_limit
+        << " coarsening_identical_net_detection=" << context.coarsening.identical_net_detection
+        << " coarsening_use_two_hop_clustering=" << std::boolalpha << context.coarsening.use_two_hop_clustering
+        << " coarsening_two_hop_shrink_factor_threshold=" << context.coarsening.two_hop_shrink_factor_threshold
         << " rating_function=" << context.coarsening.rating.rating_function
         << " rating_heavy_node_penalty_policy=" << context.coarsening.rating.heavy_node_penalty_policy
-        << " rating_acceptance_policy=" << context.coarsening.rating.acceptance_policy;
+        << " rating_acceptance_policy=" << context.coarsening.rating.acceptance_policy
+        << " rating_use_small_rating_map=" << std::boolalpha << context.coarsening.rating.use_small_rating_map;
     oss << " initial_partitioning_mode=" << context.initial_partitioning.mode
         << " initial_partitioning_runs=" << context.initial_partitioning.runs
         << " initial_partitioning_use_adaptive_ip_runs=" << std::boolalpha << context.initial_partitioning.use_adaptive_ip_runs
@@ -110,6 +117,7 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " relative_improvement_threshold=" << context.refinement.relative_improvement_threshold
         << " max_batch_size=" << context.refinement.max_batch_size
         << " min_border_vertices_per_thread=" << context.refinement.min_border_vertices_per_thread
+        << " sparse_gain_cache=" << std::boolalpha << context.refinement.sparse_gain_cache
         << " lp_algorithm=" << context.refinement.label_propagation.algorithm
         << " lp_maximum_iterations=" << context.refinement.label_propagation.maximum_iterations
         << " lp_rebalancing=" << std::boolalpha << context.refinement.label_propagation.rebalancing
@@ -139,6 +147,7 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " fm_imbalance_penalty_max=" << context.refinement.fm.imbalance_penalty_max
         << " fm_activate_unconstrained_dynamically=" << std::boolalpha << context.refinement.fm.activate_unconstrained_dynamically
         << " fm_penalty_for_activation_test=" << context.refinement.fm.penalty_for_activation_test
+        << " fm_bucket_pq_max_gain=" << context.refinement.fm.bucket_pq_max_gain
         << " global_refine_use_global_refinement=" << std::boolalpha << context.refinement.global.use_global_refinement
         << " global_refine_refine_until_no_improvement=" << std::boolalpha << context.refinement.global.refine_until_no_improvement
         << " global_refine_fm_algorithm=" << context.refinement.global.fm_algorithm
@@ -163,7 +172,9 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
     oss << " num_threads=" << context.shared_memory.num_threads
         << " use_localized_random_shuffle=" << std::boolalpha << context.shared_memory.use_localized_random_shuffle
         << " shuffle_block_size=" << context.shared_memory.shuffle_block_size
-        << " static_balancing_work_packages=" << context.shared_memory.static_balancing_work_packages;
+        << " static_balancing_work_packages=" << context.shared_memory.static_balancing_work_packages
+        << " interleaved_allocations=" << std::boolalpha << context.shared_memory.interleaved_allocations
+        << " use_huge_pages=" << std::boolalpha << context.shared_memory.use_huge_pages;
 
     if ( context.partition.objective == Objective::steiner_tree ) {
       oss << " target_graph_file=" << context.mapping.target_graph_file.substr(
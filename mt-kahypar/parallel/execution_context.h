@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+
+#include <tbb_kahypar/task_arena.h>
+#undef __TBB_ARENA_OBSERVER
+#define __TBB_ARENA_OBSERVER true
+#include <tbb_kahypar/task_scheduler_observer.h>
+#undef __TBB_ARENA_OBSERVER
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/parallel/memory_pool.h"
+#include "mt-kahypar/utils/randomize.h"
+
+namespace mt_kahypar {
+namespace parallel {
+
+/*!
+ * An execution context owns the resources that are otherwise shared by all
+ * partitioning calls of a process: a task arena that bounds the number of threads,
+ * a memory pool and the random number generators. Work passed to execute(...) runs
+ * inside the task arena, and each thread working in the arena gets the memory pool
+ * and randomization of this context from MemoryPool::instance() and
+ * utils::Randomize::instance(). Statistics and timings are already separated per
+ * partitioning call via the utility id of the context.
+ * Several execution contexts can be used concurrently from different threads.
+ * The TBBInitializer only bounds the number of threads of the whole process. Code that
+ * sizes its work or thread-local data by the number of threads must therefore use
+ * ExecutionContext::maxNumThreads(), which respects the task arena of the context.
+ */
+class ExecutionContext {
+
+  // ! Makes the resources of the execution context visible to
+  // ! worker threads that join the task arena
+  class LocalInstanceObserver : public tbb_kahypar::task_scheduler_observer {
+    using Base = tbb_kahypar::task_scheduler_observer;
+
+   public:
+    LocalInstanceObserver(tbb_kahypar::task_arena& arena,
+                          ExecutionContext& context) :
+      Base(arena),
+      _context(context) {
+      observe(true);
+    }
+
+    ~LocalInstanceObserver() {
+      observe(false);
+    }
+
+    void on_scheduler_entry(bool is_worker) override {
+      // External threads are handled in ExecutionContext::execute(...)
+      if ( is_worker ) {
+        _context.activate();
+      }
+    }
+
+    void on_scheduler_exit(bool is_worker) override {
+      if ( is_worker ) {
+        ExecutionContext::deactivate();
+      }
+    }
+
+   private:
+    ExecutionContext& _context;
+  };
+
+ public:
+  explicit ExecutionContext(const int num_threads, const int seed = 0) :
+    _num_threads(num_threads),
+    _arena(num_threads),
+    _memory_pool(),
+    _randomize(),
+    _observer(_arena, *this) {
+    _randomize.setSeed(seed);
+  }
+
+  ExecutionContext(const ExecutionContext&) = delete;
+  ExecutionContext & operator= (const ExecutionContext &) = delete;
+
+  ExecutionContext(ExecutionContext&&) = delete;
+  ExecutionContext & operator= (ExecutionContext &&) = delete;
+
+  int numThreads() const {
+    return _num_threads;
+  }
+
+  // ! Maximum number of threads that work on tasks spawned by the calling thread,
+  // ! i.e., the size of the task arena of the active execution context (if any)
+  // ! bounded by the number of threads TBB was initialized with
+  static int maxNumThreads() {
+    return std::min(mt_kahypar::TBBInitializer::instance().total_number_of_threads(),
+                    tbb_kahypar::this_task_arena::max_concurrency());
+  }
+
+  MemoryPool& memoryPool() {
+    return _memory_pool;
+  }
+
+  utils::Randomize& randomize() {
+    return _randomize;
+  }
+
+  // ! Executes f in the task arena of this execution context
+  template<typename F>
+  auto execute(const F& f) -> decltype(f()) {
+    return _arena.execute([&] {
+      // The calling thread may already work in an other execution context
+      const LocalInstanceGuard guard(*this);
+      return f();
+    });
+  }
+
+ private:
+  // ! Restores the local instances of the calling thread on destruction
+  struct LocalInstanceGuard {
+    explicit LocalInstanceGuard(ExecutionContext& context) :
+      memory_pool(MemoryPool::local_instance()),
+      randomize(utils::Randomize::local_instance()) {
+      context.activate();
+    }
+
+    ~LocalInstanceGuard() {
+      setLocalInstances(memory_pool, randomize);
+    }
+
+    MemoryPool* memory_pool;
+    utils::Randomize* randomize;
+  };
+
+  static void setLocalInstances(MemoryPool* memory_pool, utils::Randomize* randomize) {
+    MemoryPool::local_instance() = memory_pool;
+    utils::Randomize::local_instance() = randomize;
+  }
+
+  void activate() {
+    setLocalInstances(&_memory_pool, &_randomize);
+  }
+
+  static void deactivate() {
+    setLocalInstances(nullptr, nullptr);
+  }
+
+  const int _num_threads;
+  tbb_kahypar::task_arena _arena;
+  MemoryPool _memory_pool;
+  utils::Randomize _randomize;
+  LocalInstanceObserver _observer;
+};
+
+}  // namespace parallel
+}  // namespace mt_kahypar
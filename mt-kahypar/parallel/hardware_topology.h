@@ -247,6 +247,12 @@ class HardwareTopology {
     hwloc_set_membind(_topology, cpuset, HWLOC_MEMBIND_INTERLEAVE, HWLOC_MEMBIND_MIGRATE);
   }
 
+  // ! Set membind policy such that memory is allocated on the NUMA node
+  // ! of the thread that first touches it
+  void activate_first_touch_membind_policy(hwloc_cpuset_t cpuset) const {
+    hwloc_set_membind(_topology, cpuset, HWLOC_MEMBIND_FIRSTTOUCH, 0);
+  }
+
  private:
   HardwareTopology() :
     _num_cpus(0),
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include <tbb_kahypar/blocked_range.h>
+#include <tbb_kahypar/parallel_for.h>
+#include <tbb_kahypar/partitioner.h>
+#include <tbb_kahypar/scalable_allocator.h>
+
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar {
+namespace parallel {
+
+/*!
+ * Allocation policy for large arrays (memory pool chunks and ds::Array).
+ *
+ * If huge pages are activated, allocations of at least HUGE_PAGE_SIZE bytes are backed
+ * by 2 MB transparent huge pages (madvise(MADV_HUGEPAGE) on Linux), which reduces
+ * TLB misses for random accesses into large arrays. The scalable allocator of TBB is
+ * switched to huge pages as well.
+ *
+ * If huge pages or the first-touch membind policy are activated, memory pool chunks are
+ * zero-initialized in parallel (otherwise, they are allocated with scalable_calloc). With a
+ * first-touch membind policy, a page is placed on the NUMA node of the thread that touches
+ * it first. We use a static partitioner such that consecutive ranges are touched by
+ * consecutive threads, which are pinned in increasing order of their NUMA node (see
+ * TBBInitializer). This matches the distribution of most parallel loops over the arrays
+ * later on.
+ */
+class LargeAllocationPolicy {
+
+ public:
+  static constexpr size_t REGULAR_PAGE_SIZE = 4096;
+  static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+  static void activate_huge_pages() {
+    scalable_allocation_mode(TBBMALLOC_USE_HUGE_PAGES, 1);
+    huge_pages_flag().store(true, std::memory_order_relaxed);
+  }
+
+  static bool use_huge_pages() {
+    return huge_pages_flag().load(std::memory_order_relaxed);
+  }
+
+  static void activate_first_touch() {
+    first_touch_flag().store(true, std::memory_order_relaxed);
+  }
+
+  static bool use_first_touch() {
+    return first_touch_flag().load(std::memory_order_relaxed);
+  }
+
+  // ! Returns true, if large allocations should be initialized with parallel_first_touch(...)
+  // ! instead of being zeroed by the allocating thread
+  static bool use_parallel_initialization() {
+    return use_huge_pages() || use_first_touch();
+  }
+
+  // ! Advises the kernel to back the huge page aligned part of the memory with huge pages
+  static void advise_huge_pages(void* data, const size_t size_in_bytes) {
+    #if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if ( data && use_huge_pages() && size_in_bytes >= HUGE_PAGE_SIZE ) {
+      const uintptr_t begin = reinterpret_cast<uintptr_t>(data);
+      const uintptr_t aligned_begin = (begin + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+      const uintptr_t aligned_end = (begin + size_in_bytes) & ~(HUGE_PAGE_SIZE - 1);
+      if ( aligned_begin < aligned_end ) {
+        // Only a hint, we continue with regular pages if it fails
+        madvise(reinterpret_cast<void*>(aligned_begin), aligned_end - aligned_begin, MADV_HUGEPAGE);
+      }
+    }
+    #else
+    (void) data;
+    (void) size_in_bytes;
+    #endif
+  }
+
+  // ! Zero-initializes the memory in parallel such that each page is
+  // ! first touched by the thread that is likely to process it later on
+  static void parallel_first_touch(char* data, const size_t size_in_bytes) {
+    tbb_kahypar::parallel_for(tbb_kahypar::blocked_range<size_t>(UL(0), size_in_bytes, REGULAR_PAGE_SIZE),
+      [&](const tbb_kahypar::blocked_range<size_t>& range) {
+        std::memset(data + range.begin(), 0, range.size());
+      }, tbb_kahypar::static_partitioner());
+  }
+
+ private:
+  static std::atomic<bool>& huge_pages_flag() {
+    static std::atomic<bool> use_huge_pages(false);
+    return use_huge_pages;
+  }
+
+  static std::atomic<bool>& first_touch_flag() {
+    static std::atomic<bool> use_first_touch(false);
+    return use_first_touch;
+  }
+};
+
+}  // namespace parallel
+}  // namespace mt_kahypar
@@ -44,12 +44,15 @@
 #include <tbb_kahypar/scalable_allocator.h>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/large_allocation.h"
 #include "mt-kahypar/parallel/stl/scalable_unique_ptr.h"
 #include "mt-kahypar/utils/memory_tree.h"
 
 namespace mt_kahypar {
 namespace parallel {
 
+class ExecutionContext;
+
 /*!
  * Singleton that handles huge memory allocations.
  * Memory chunks can be registered with a key and all memory
@@ -155,10 +158,19 @@ class MemoryPoolT {
     }
 
     // ! Allocates the memory chunk
-    // ! Note, the memory chunk is zero initialized.
+    // ! Note, the memory chunk is zero initialized (in parallel, if huge pages
+    // ! or the first-touch policy are activated, see LargeAllocationPolicy).
     bool allocate() {
       if ( !_data && !_defer_allocation ) {
-        _data = (char*) scalable_calloc(_num_elements, _size);
+        if ( LargeAllocationPolicy::use_parallel_initialization() ) {
+          _data = (char*) scalable_malloc(_num_elements * _size);
+          if ( _data ) {
+            LargeAllocationPolicy::advise_huge_pages(_data, _num_elements * _size);
+            LargeAllocationPolicy::parallel_first_touch(_data, _num_elements * _size);
+          }
+        } else {
+          _data = (char*) scalable_calloc(_num_elements, _size);
+        }
         return true;
       } else {
         return false;
@@ -228,7 +240,12 @@ class MemoryPoolT {
     free_memory_chunks();
   }
 
+  // ! Returns the memory pool of the execution context in which
+  // ! the calling thread currently runs or the global instance
   static MemoryPoolT& instance() {
+    if ( MemoryPoolT* local = local_instance() ) {
+      return *local;
+    }
     static MemoryPoolT instance;
     return instance;
   }
@@ -581,6 +598,13 @@ class MemoryPoolT {
   }
 
  private:
+  friend class ExecutionContext;
+
+  static MemoryPoolT*& local_instance() {
+    static thread_local MemoryPoolT* instance = nullptr;
+    return instance;
+  }
+
   explicit MemoryPoolT() :
     _memory_mutex(),
     _is_initialized(false),
@@ -766,6 +790,9 @@ class DoNothingMemoryPool {
   DoNothingMemoryPool & operator= (DoNothingMemoryPool &&) = delete;
 
   static DoNothingMemoryPool& instance() {
+    if ( DoNothingMemoryPool* local = local_instance() ) {
+      return *local;
+    }
     static DoNothingMemoryPool instance;
     return instance;
   }
@@ -835,6 +862,13 @@ class DoNothingMemoryPool {
   void explain_optimizations() const { }
 
  private:
+  friend class ExecutionContext;
+
+  static DoNothingMemoryPool*& local_instance() {
+    static thread_local DoNothingMemoryPool* instance = nullptr;
+    return instance;
+  }
+
   DoNothingMemoryPool() { }
 };
 
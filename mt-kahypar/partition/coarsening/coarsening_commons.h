@@ -62,6 +62,10 @@ public:
     return _communities[hn];
   }
 
+  const parallel::scalable_vector<HypernodeID>& communities() const {
+    return _communities;
+  }
+
   double coarseningTime() const {
     return _coarsening_time;
   }
@@ -164,13 +168,26 @@ public:
     is_finalized = true;
   }
 
+  // ! Replaces the partitioned hypergraph of the coarsest level with an empty partition
+  // ! into k blocks. This allows to reuse the multilevel hierarchy for an additional
+  // ! partitioning run (the partitioned hypergraph of the previous run is moved out
+  // ! by the uncoarsener).
+  void resetPartitionedHypergraph(const PartitionID k) {
+    ASSERT(!nlevel && is_finalized);
+    *partitioned_hg = PartitionedHypergraph(k, _hg, parallel_tag_t());
+    if (!hierarchy.empty()) {
+      partitioned_hg->setHypergraph(hierarchy.back().contractedHypergraph());
+    }
+  }
+
   void performMultilevelContraction(
           parallel::scalable_vector<HypernodeID>&& communities, bool deterministic,
+          IdenticalNetDetection identical_net_detection,
           const HighResClockTimepoint& round_start) {
     ASSERT(!is_finalized);
     Hypergraph& current_hg = hierarchy.empty() ? _hg : hierarchy.back().contractedHypergraph();
     ASSERT(current_hg.initialNumNodes() == communities.size());
-    Hypergraph contracted_hg = current_hg.contract(communities, deterministic);
+    Hypergraph contracted_hg = current_hg.contract(communities, deterministic, identical_net_detection);
     const HighResClockTimepoint round_end = std::chrono::high_resolution_clock::now();
     const double elapsed_time = std::chrono::duration<double>(round_end - round_start).count();
     hierarchy.emplace_back(std::move(contracted_hg), std::move(communities), elapsed_time);
@@ -0,0 +1,356 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <tbb_kahypar/enumerable_thread_specific.h>
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/coarsening_commons.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/exception.h"
+#include "mt-kahypar/utils/hash.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Binary snapshot file format of a multilevel hierarchy (little endian,
+ * all sections are aligned to 8 bytes):
+ *  - header (see CoarseningSnapshotHeader)
+ *  - for each level (from the finest to the coarsest contracted hypergraph):
+ *    - level header (see CoarseningSnapshotLevelHeader)
+ *    - communities: num_communities x HypernodeID, maps each node of the previous
+ *      level to its node in the contracted hypergraph (kInvalidHypernode, if disabled)
+ *    - hyperedge indices: (num_hyperedges + 1) x uint64_t
+ *    - pins: num_pins x HypernodeID (each undirected edge is stored once for graphs)
+ *    - hyperedge weights: num_hyperedges x HyperedgeWeight
+ *    - hypernode weights: num_hypernodes x HypernodeWeight
+ */
+struct CoarseningSnapshotHeader {
+  static constexpr char MAGIC[8] = { 'M', 'T', 'K', 'H', 'S', 'N', 'A', 'P' };
+  static constexpr uint32_t VERSION = 1;
+  static constexpr uint32_t IS_GRAPH = 1 << 0;
+
+  char magic[8];
+  uint32_t version;
+  uint32_t flags;
+  uint8_t id_bytes;
+  uint8_t weight_bytes;
+  uint8_t reserved[6];
+  uint64_t input_hash;
+  uint64_t context_hash;
+  uint64_t num_levels;
+};
+static_assert(sizeof(CoarseningSnapshotHeader) == 48);
+
+struct CoarseningSnapshotLevelHeader {
+  uint64_t num_communities;
+  uint64_t num_hypernodes;
+  uint64_t num_hyperedges;
+  uint64_t num_pins;
+  double coarsening_time;
+};
+static_assert(sizeof(CoarseningSnapshotLevelHeader) == 40);
+
+/*!
+ * Writes the multilevel hierarchy computed by coarsening to a file and reads it back,
+ * such that repeated partitioning runs of the same input (e.g., with different imbalance
+ * factors or objective functions) can skip community detection and coarsening. A snapshot
+ * stores a hash of the preprocessed input hypergraph and of all context parameters that
+ * influence coarsening. Reading a snapshot fails if one of them does not match.
+ */
+template<typename TypeTraits>
+class CoarseningSnapshot {
+
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using HypergraphFactory = typename Hypergraph::Factory;
+
+  static constexpr size_t SECTION_ALIGNMENT = 8;
+
+ public:
+  CoarseningSnapshot() = delete;
+
+  // ! Hash of all enabled nodes and hyperedges of the hypergraph
+  // ! (IDs, weights and pins), i.e., after removing degree-zero
+  // ! nodes and large hyperedges
+  static uint64_t inputHash(const Hypergraph& hypergraph) {
+    tbb_kahypar::enumerable_thread_specific<uint64_t> local_hash(0);
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      local_hash.local() += hashing::integer::combine64(hashing::integer::hash64(hn),
+        hashing::integer::hash64(static_cast<uint64_t>(hypergraph.nodeWeight(hn))));
+    });
+    hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
+      uint64_t he_hash = hashing::integer::combine64(hashing::integer::hash64_2(he),
+        hashing::integer::hash64(static_cast<uint64_t>(hypergraph.edgeWeight(he))));
+      for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+        he_hash = hashing::integer::combine64(he_hash, hashing::integer::hash64(pin));
+      }
+      local_hash.local() += he_hash;
+    });
+    // Summation makes the hash independent of the scheduling of the threads
+    uint64_t hash = hashing::integer::combine64(hashing::integer::hash64(hypergraph.initialNumNodes()),
+      hashing::integer::hash64(hypergraph.initialNumEdges()));
+    return hashing::integer::combine64(hash, local_hash.combine(std::plus<>()));
+  }
+
+  // ! Hash of all context parameters that influence the coarsening hierarchy. Note
+  // ! that the contraction limit and the maximum allowed node weight depend on k.
+  static uint64_t contextHash(const Context& context) {
+    std::stringstream params;
+    params << context.partition.partition_type << " "
+           << context.partition.seed << " "
+           << std::boolalpha << context.partition.deterministic << " "
+           << context.partition.large_hyperedge_size_threshold << std::endl
+           << context.preprocessing << context.coarsening;
+    uint64_t hash = 0;
+    for ( const char c : params.str() ) {
+      hash = hashing::integer::combine64(hash, hashing::integer::hash64(static_cast<uint64_t>(c)));
+    }
+    return hash;
+  }
+
+  // ! Writes all levels of a finalized multilevel hierarchy of the hypergraph to a file
+  static void write(const std::string& filename,
+                    const Hypergraph& hypergraph,
+                    const UncoarseningData<TypeTraits>& uncoarsening_data,
+                    const Context& context) {
+    ASSERT(!uncoarsening_data.nlevel);
+    std::ofstream out(filename, std::ios::binary);
+    if ( !out ) {
+      throw InvalidInputException("Could not open: " + filename);
+    }
+
+    CoarseningSnapshotHeader header;
+    std::memset(&header, 0, sizeof(CoarseningSnapshotHeader));
+    std::memcpy(header.magic, CoarseningSnapshotHeader::MAGIC, sizeof(header.magic));
+    header.version = CoarseningSnapshotHeader::VERSION;
+    header.flags = Hypergraph::is_graph ? CoarseningSnapshotHeader::IS_GRAPH : 0;
+    header.id_bytes = sizeof(HypernodeID);
+    header.weight_bytes = sizeof(HypernodeWeight);
+    header.input_hash = inputHash(hypergraph);
+    header.context_hash = contextHash(context);
+    header.num_levels = uncoarsening_data.hierarchy.size();
+    writeSection(out, &header, sizeof(CoarseningSnapshotHeader));
+
+    for ( const Level<TypeTraits>& level : uncoarsening_data.hierarchy ) {
+      const Hypergraph& contracted_hg = level.contractedHypergraph();
+      const HypernodeID num_nodes = contracted_hg.initialNumNodes();
+      vec<size_t> edge_indices;
+      vec<HypernodeID> pins;
+      vec<HyperedgeWeight> edge_weight;
+      vec<HypernodeWeight> node_weight(num_nodes, 0);
+      toCSR(contracted_hg, edge_indices, pins, edge_weight);
+      tbb_kahypar::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+        node_weight[hn] = contracted_hg.nodeWeight(hn);
+      });
+
+      CoarseningSnapshotLevelHeader level_header;
+      level_header.num_communities = level.communities().size();
+      level_header.num_hypernodes = num_nodes;
+      level_header.num_hyperedges = edge_weight.size();
+      level_header.num_pins = pins.size();
+      level_header.coarsening_time = level.coarseningTime();
+      writeSection(out, &level_header, sizeof(CoarseningSnapshotLevelHeader));
+      writeSection(out, level.communities().data(), level.communities().size() * sizeof(HypernodeID));
+      writeSection(out, edge_indices.data(), edge_indices.size() * sizeof(size_t));
+      writeSection(out, pins.data(), pins.size() * sizeof(HypernodeID));
+      writeSection(out, edge_weight.data(), edge_weight.size() * sizeof(HyperedgeWeight));
+      writeSection(out, node_weight.data(), node_weight.size() * sizeof(HypernodeWeight));
+    }
+    out.close();
+    if ( !out ) {
+      throw SystemException("Error while writing coarsening snapshot: " + filename);
+    }
+  }
+
+  // ! Reads a multilevel hierarchy of the hypergraph from a file. The returned
+  // ! hierarchy is finalized and can be passed to Multilevel::partition(...).
+  static std::unique_ptr<UncoarseningData<TypeTraits>> read(const std::string& filename,
+                                                            Hypergraph& hypergraph,
+                                                            const Context& context) {
+    std::ifstream in(filename, std::ios::binary);
+    if ( !in ) {
+      throw InvalidInputException("Could not open: " + filename);
+    }
+
+    CoarseningSnapshotHeader header;
+    readSection(in, &header, sizeof(CoarseningSnapshotHeader), filename);
+    if ( std::memcmp(header.magic, CoarseningSnapshotHeader::MAGIC, sizeof(header.magic)) != 0 ) {
+      throw InvalidInputException("File is not a coarsening snapshot: " + filename);
+    }
+    if ( header.version != CoarseningSnapshotHeader::VERSION ) {
+      throw InvalidInputException("Unsupported coarsening snapshot version " +
+        std::to_string(header.version) + " (expected " +
+        std::to_string(CoarseningSnapshotHeader::VERSION) + "): " + filename);
+    }
+    if ( header.id_bytes != sizeof(HypernodeID) || header.weight_bytes != sizeof(HypernodeWeight) ||
+         static_cast<bool>(header.flags & CoarseningSnapshotHeader::IS_GRAPH) != Hypergraph::is_graph ) {
+      throw InvalidInputException("Coarsening snapshot was written for a different "
+        "hypergraph data structure: " + filename);
+    }
+    if ( header.input_hash != inputHash(hypergraph) ) {
+      throw InvalidInputException("Coarsening snapshot was computed for a different input: " + filename);
+    }
+    if ( header.context_hash != contextHash(context) ) {
+      throw InvalidInputException("Coarsening snapshot was computed with different coarsening "
+        "parameters (e.g., k, seed or preset): " + filename);
+    }
+
+    auto uncoarsening_data = std::make_unique<UncoarseningData<TypeTraits>>(false, hypergraph, context);
+    uint64_t num_fine_nodes = hypergraph.initialNumNodes();
+    for ( uint64_t i = 0; i < header.num_levels; ++i ) {
+      CoarseningSnapshotLevelHeader level_header;
+      readSection(in, &level_header, sizeof(CoarseningSnapshotLevelHeader), filename);
+      const uint64_t n = level_header.num_hypernodes;
+      const uint64_t m = level_header.num_hyperedges;
+      if ( level_header.num_communities != num_fine_nodes || n > num_fine_nodes ||
+           ( Hypergraph::is_graph && level_header.num_pins != 2 * m ) ) {
+        throw InvalidInputException("Coarsening snapshot is corrupted: " + filename);
+      }
+
+      parallel::scalable_vector<HypernodeID> communities(num_fine_nodes);
+      vec<size_t> edge_indices(m + 1);
+      vec<HypernodeID> pins(level_header.num_pins);
+      vec<HyperedgeWeight> edge_weight(m);
+      vec<HypernodeWeight> node_weight(n);
+      readSection(in, communities.data(), communities.size() * sizeof(HypernodeID), filename);
+      readSection(in, edge_indices.data(), edge_indices.size() * sizeof(size_t), filename);
+      readSection(in, pins.data(), pins.size() * sizeof(HypernodeID), filename);
+      readSection(in, edge_weight.data(), edge_weight.size() * sizeof(HyperedgeWeight), filename);
+      readSection(in, node_weight.data(), node_weight.size() * sizeof(HypernodeWeight), filename);
+      const bool is_valid = edge_indices[0] == 0 && edge_indices[m] == pins.size() &&
+        std::is_sorted(edge_indices.begin(), edge_indices.end()) &&
+        std::all_of(pins.begin(), pins.end(), [&](const HypernodeID pin) {
+          return pin < n;
+        }) &&
+        std::all_of(communities.begin(), communities.end(), [&](const HypernodeID coarse_hn) {
+          return coarse_hn < n || coarse_hn == kInvalidHypernode;
+        });
+      if ( !is_valid ) {
+        throw InvalidInputException("Coarsening snapshot is corrupted: " + filename);
+      }
+
+      if constexpr ( Hypergraph::is_static_hypergraph ) {
+        Hypergraph contracted_hg = HypergraphFactory::construct_from_csr(n, m,
+          edge_indices.data(), pins.data(), edge_weight.data(), node_weight.data(),
+          context.preprocessing.stable_construction_of_incident_edges);
+        uncoarsening_data->hierarchy.emplace_back(
+          std::move(contracted_hg), std::move(communities), level_header.coarsening_time);
+      } else {
+        // The n-level hierarchy consists of single contractions and is not stored in snapshots
+        throw UnsupportedOperationException(
+          "Coarsening snapshots are only supported for static (hyper)graphs!");
+      }
+      num_fine_nodes = n;
+    }
+    if ( in.peek() != std::ifstream::traits_type::eof() ) {
+      throw InvalidInputException("Coarsening snapshot is corrupted: " + filename);
+    }
+
+    uncoarsening_data->finalizeCoarsening();
+    return uncoarsening_data;
+  }
+
+ private:
+  // ! Adjacency array of the hypergraph with consecutive hyperedge IDs. For graphs,
+  // ! each undirected edge is stored only once (as expected by the factory).
+  static void toCSR(const Hypergraph& hypergraph,
+                    vec<size_t>& edge_indices,
+                    vec<HypernodeID>& pins,
+                    vec<HyperedgeWeight>& edge_weight) {
+    if constexpr ( Hypergraph::is_graph ) {
+      const HyperedgeID num_edges = hypergraph.initialNumEdges() / 2;
+      edge_indices.assign(num_edges + 1, 0);
+      pins.assign(2 * UL(num_edges), kInvalidHypernode);
+      edge_weight.assign(num_edges, 0);
+      hypergraph.doParallelForAllEdges([&](const HyperedgeID& e) {
+        const HypernodeID source = hypergraph.edgeSource(e);
+        const HypernodeID target = hypergraph.edgeTarget(e);
+        if ( source < target ) {
+          const HyperedgeID id = hypergraph.uniqueEdgeID(e);
+          pins[2 * UL(id)] = source;
+          pins[2 * UL(id) + 1] = target;
+          edge_weight[id] = hypergraph.edgeWeight(e);
+        }
+      });
+      tbb_kahypar::parallel_for(ID(0), num_edges + 1, [&](const HyperedgeID id) {
+        edge_indices[id] = 2 * UL(id);
+      });
+    } else {
+      // Removed hyperedges are skipped, since hyperedge IDs of
+      // contracted hypergraphs are not referenced by the hierarchy
+      vec<HyperedgeID> enabled_edges;
+      for ( HyperedgeID he = 0; he < hypergraph.initialNumEdges(); ++he ) {
+        if ( hypergraph.edgeIsEnabled(he) ) {
+          enabled_edges.push_back(he);
+        }
+      }
+      const HyperedgeID num_edges = enabled_edges.size();
+      edge_indices.assign(num_edges + 1, 0);
+      edge_weight.assign(num_edges, 0);
+      for ( HyperedgeID id = 0; id < num_edges; ++id ) {
+        edge_indices[id + 1] = edge_indices[id] + hypergraph.edgeSize(enabled_edges[id]);
+      }
+      pins.assign(edge_indices[num_edges], kInvalidHypernode);
+      tbb_kahypar::parallel_for(ID(0), num_edges, [&](const HyperedgeID id) {
+        size_t pos = edge_indices[id];
+        for ( const HypernodeID& pin : hypergraph.pins(enabled_edges[id]) ) {
+          pins[pos++] = pin;
+        }
+        edge_weight[id] = hypergraph.edgeWeight(enabled_edges[id]);
+      });
+    }
+  }
+
+  static size_t alignedSectionSize(const size_t bytes) {
+    return ( ( bytes + SECTION_ALIGNMENT - 1 ) / SECTION_ALIGNMENT ) * SECTION_ALIGNMENT;
+  }
+
+  static void writeSection(std::ofstream& out, const void* data, const size_t bytes) {
+    static const char padding[SECTION_ALIGNMENT] = { 0 };
+    out.write(reinterpret_cast<const char*>(data), bytes);
+    out.write(padding, alignedSectionSize(bytes) - bytes);
+  }
+
+  static void readSection(std::ifstream& in, void* data, const size_t bytes, const std::string& filename) {
+    char padding[SECTION_ALIGNMENT];
+    in.read(reinterpret_cast<char*>(data), bytes);
+    in.read(padding, alignedSectionSize(bytes) - bytes);
+    if ( !in ) {
+      throw InvalidInputException("Coarsening snapshot is truncated: " + filename);
+    }
+  }
+};
+
+}  // namespace mt_kahypar
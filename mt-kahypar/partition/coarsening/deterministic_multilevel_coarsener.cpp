@@ -101,8 +101,10 @@ bool DeterministicMultilevelCoarsener<TypeTraits>::coarseningPassImpl() {
     return false;
   }
   _timer.start_timer("contraction", "Contraction");
-  _uncoarseningData.performMultilevelContraction(std::move(clusters), true /* deterministic */, pass_start_time);
+  _uncoarseningData.performMultilevelContraction(std::move(clusters), true /* deterministic */,
+    _context.coarsening.identical_net_detection, pass_start_time);
   _timer.stop_timer("contraction");
+  Base::reportProgress(pass, Base::currentNumNodes());
   return true;
 }
 
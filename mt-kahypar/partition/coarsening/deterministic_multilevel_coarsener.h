@@ -104,7 +104,8 @@ private:
   bool coarseningPassImpl() override;
 
   bool shouldNotTerminateImpl() const override {
-    return Base::currentNumNodes() > _context.coarsening.contraction_limit;
+    return Base::currentNumNodes() > _context.coarsening.contraction_limit &&
+      !_time_limit.exceeded(utils::TimeLimit::COARSENING_SHARE);
   }
 
   void terminateImpl() override {
@@ -144,6 +145,7 @@ private:
   using Base::_hg;
   using Base::_context;
   using Base::_timer;
+  using Base::_time_limit;
   using Base::_uncoarseningData;
 
   DeterministicCoarseningConfig config;
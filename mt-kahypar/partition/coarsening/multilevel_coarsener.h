@@ -33,6 +33,7 @@
 #include <tbb_kahypar/task_group.h>
 #include <tbb_kahypar/parallel_for.h>
 #include <tbb_kahypar/parallel_reduce.h>
+#include <tbb_kahypar/parallel_sort.h>
 
 #include "kahypar-resources/meta/mandatory.h"
 
@@ -74,6 +75,18 @@ class MultilevelCoarsener : public ICoarsener,
     MATCHED = 2
   };
 
+  // ! Unmatched vertex of the two-hop clustering stage together with the
+  // ! representative of its favourite (but too heavy or already matched) cluster
+  struct TwoHopCandidate {
+    HypernodeID favourite;
+    HypernodeWeight weight;
+    HypernodeID hn;
+
+    bool operator< (const TwoHopCandidate& other) const {
+      return std::tie(favourite, weight, hn) < std::tie(other.favourite, other.weight, other.hn);
+    }
+  };
+
   #define STATE(X) static_cast<uint8_t>(X)
   using AtomicMatchingState = parallel::IntegralAtomicWrapper<uint8_t>;
   using AtomicWeight = parallel::IntegralAtomicWrapper<HypernodeWeight>;
@@ -137,7 +150,8 @@ class MultilevelCoarsener : public ICoarsener,
   }
 
   bool shouldNotTerminateImpl() const override {
-    return Base::currentNumNodes() > _context.coarsening.contraction_limit;
+    return Base::currentNumNodes() > _context.coarsening.contraction_limit &&
+      !_time_limit.exceeded(utils::TimeLimit::COARSENING_SHARE);
   }
 
   bool coarseningPassImpl() override {
@@ -214,10 +228,12 @@ class MultilevelCoarsener : public ICoarsener,
 
     _timer.start_timer("contraction", "Contraction");
     // Perform parallel contraction
-    _uncoarseningData.performMultilevelContraction(std::move(cluster_ids), false /* deterministic */, round_start);
+    _uncoarseningData.performMultilevelContraction(std::move(cluster_ids), false /* deterministic */,
+      _context.coarsening.identical_net_detection, round_start);
     _timer.stop_timer("contraction");
 
     ++_pass_nr;
+    Base::reportProgress(_pass_nr, Base::currentNumNodes());
     return true;
   }
 
@@ -288,6 +304,20 @@ class MultilevelCoarsener : public ICoarsener,
         }
       }
     });
+
+    // If the matching stalls (e.g., on star-like hypergraphs where most vertices are only
+    // adjacent to a few heavy hubs), we additionally cluster the remaining unmatched vertices.
+    current_num_nodes = num_hns_before_pass - contracted_nodes.combine(std::plus<HypernodeID>());
+    if ( _context.coarsening.use_two_hop_clustering &&
+         current_num_nodes > hierarchy_contraction_limit &&
+         static_cast<double>(num_hns_before_pass) / static_cast<double>(current_num_nodes) <
+           _context.coarsening.two_hop_shrink_factor_threshold ) {
+      _timer.start_timer("two_hop_clustering", "Two-Hop Clustering");
+      performTwoHopClustering<has_fixed_vertices>(current_hg, cluster_ids, contracted_nodes,
+        fixed_vertices, current_num_nodes - hierarchy_contraction_limit);
+      _timer.stop_timer("two_hop_clustering");
+    }
+
     if ( _context.partition.show_detailed_clustering_timings ) {
       _timer.stop_timer("clustering_level_" + std::to_string(_pass_nr));
     }
@@ -334,6 +364,82 @@ class MultilevelCoarsener : public ICoarsener,
     return num_hns_before_pass - contracted_nodes.combine(std::plus<>());
   }
 
+  /*!
+   * Second clustering stage that is only executed if the matching computed by
+   * performClustering(...) shrinks the hypergraph by less than the two-hop shrink
+   * factor threshold. For each vertex that is still unmatched, we compute its
+   * favourite cluster without considering the maximum allowed node weight.
+   * Such vertices are usually leaves or two-hop neighbors of a heavy hub whose
+   * cluster can not absorb more vertices. Vertices that share the same favourite
+   * cluster are then grouped together (sorted by weight to pack them tightly)
+   * subject to the maximum allowed node weight. Each group of vertices with the
+   * same favourite is processed by exactly one thread and contains only singleton
+   * clusters, so no synchronization is needed when updating the cluster ids.
+   */
+  template<bool has_fixed_vertices>
+  void performTwoHopClustering(const Hypergraph& current_hg,
+                               vec<HypernodeID>& cluster_ids,
+                               tbb_kahypar::enumerable_thread_specific<HypernodeID>& contracted_nodes,
+                               ds::FixedVertexSupport<Hypergraph>& fixed_vertices,
+                               const HypernodeID max_contractions) {
+    // Vertices without favourite cluster are placed at the end of the candidate list
+    const TwoHopCandidate invalid_candidate { kInvalidHypernode, 0, kInvalidHypernode };
+    vec<TwoHopCandidate> candidates(current_hg.initialNumNodes(), invalid_candidate);
+    tbb_kahypar::parallel_for(ID(0), current_hg.initialNumNodes(), [&](const HypernodeID hn) {
+      if ( current_hg.nodeIsEnabled(hn) &&
+           _matching_state[hn].load(std::memory_order_relaxed) == STATE(MatchingState::UNMATCHED) ) {
+        ASSERT(cluster_ids[hn] == hn);
+        // The weight of two different clusters can not exceed the total weight
+        // of the hypergraph, which therefore effectively disables the weight constraint
+        const Rating rating = _rater.template rate<has_fixed_vertices>(current_hg, hn,
+          cluster_ids, _cluster_weight, fixed_vertices, current_hg.totalWeight());
+        if ( rating.target != kInvalidHypernode ) {
+          candidates[hn] = TwoHopCandidate { cluster_ids[rating.target], current_hg.nodeWeight(hn), hn };
+        }
+      }
+    });
+    tbb_kahypar::parallel_sort(candidates.begin(), candidates.end());
+
+    parallel::IntegralAtomicWrapper<int64_t> remaining_contractions(max_contractions);
+    tbb_kahypar::parallel_for(UL(0), candidates.size(), [&](const size_t group_start) {
+      const HypernodeID favourite = candidates[group_start].favourite;
+      if ( favourite == kInvalidHypernode ||
+           ( group_start > 0 && candidates[group_start - 1].favourite == favourite ) ) {
+        // Entry does not start a group of vertices with the same favourite cluster
+        return;
+      }
+
+      HypernodeID& local_contracted_nodes = contracted_nodes.local();
+      HypernodeID rep = candidates[group_start].hn;
+      for ( size_t i = group_start + 1; i < candidates.size() &&
+              candidates[i].favourite == favourite; ++i ) {
+        const HypernodeID hn = candidates[i].hn;
+        bool join_cluster = _cluster_weight[rep].load(std::memory_order_relaxed) +
+          candidates[i].weight <= _context.coarsening.max_allowed_node_weight;
+        if ( join_cluster && remaining_contractions.fetch_sub(1, std::memory_order_relaxed) <= 0 ) {
+          // Contraction limit of the current level is reached
+          break;
+        }
+        if constexpr ( has_fixed_vertices ) {
+          if ( join_cluster && !fixed_vertices.contract(rep, hn) ) {
+            remaining_contractions.fetch_add(1, std::memory_order_relaxed);
+            join_cluster = false;
+          }
+        }
+
+        if ( join_cluster ) {
+          cluster_ids[hn] = rep;
+          _cluster_weight[rep].fetch_add(candidates[i].weight, std::memory_order_relaxed);
+          _matching_state[hn].store(STATE(MatchingState::MATCHED), std::memory_order_relaxed);
+          ++local_contracted_nodes;
+        } else {
+          // Start a new cluster
+          rep = hn;
+        }
+      }
+    });
+  }
+
   void terminateImpl() override {
     _progress_bar += (_initial_num_nodes - _progress_bar.count());
     _progress_bar.disable();
@@ -511,6 +617,7 @@ class MultilevelCoarsener : public ICoarsener,
   using Base::_hg;
   using Base::_context;
   using Base::_timer;
+  using Base::_time_limit;
   using Base::_uncoarseningData;
   Rater _rater;
   HypernodeID _initial_num_nodes;
@@ -51,6 +51,8 @@ class MultilevelCoarsenerBase {
           _hg(hypergraph),
           _context(context),
           _timer(utils::Utilities::instance().getTimer(context.utility_id)),
+          _time_limit(utils::Utilities::instance().getTimeLimit(context.utility_id)),
+          _progress_reporter(utils::Utilities::instance().getProgressReporter(context.utility_id)),
           _uncoarseningData(uncoarseningData) {}
 
   MultilevelCoarsenerBase(const MultilevelCoarsenerBase&) = delete;
@@ -78,6 +80,13 @@ class MultilevelCoarsenerBase {
     }
   }
 
+  // ! Reports the progress of the main partitioning context after a coarsening pass
+  void reportProgress(const size_t level, const HypernodeID num_nodes) const {
+    if ( _context.type == ContextType::main ) {
+      _progress_reporter.report(utils::ProgressReporter::Phase::coarsening, level, num_nodes, 0);
+    }
+  }
+
   PartitionedHypergraph& currentPartitionedHypergraph() {
     ASSERT(_uncoarseningData.is_finalized);
     return *_uncoarseningData.partitioned_hg;
@@ -87,6 +96,8 @@ class MultilevelCoarsenerBase {
   Hypergraph& _hg;
   const Context& _context;
   utils::Timer& _timer;
+  const utils::TimeLimit& _time_limit;
+  const utils::ProgressReporter& _progress_reporter;
   UncoarseningData<TypeTraits>& _uncoarseningData;
 };
 }  // namespace mt_kahypar
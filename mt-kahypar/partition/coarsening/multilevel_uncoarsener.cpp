@@ -112,6 +112,7 @@ namespace mt_kahypar {
     ASSERT(metrics::quality(*_uncoarseningData.partitioned_hg, _context) == _current_metrics.quality,
       V(_current_metrics.quality) << V(metrics::quality(*_uncoarseningData.partitioned_hg, _context)));
 
+    Base::reportProgress(_current_level, partitioned_hg.initialNumNodes(), _current_metrics.quality);
     --_current_level;
   }
 
@@ -193,12 +194,19 @@ namespace mt_kahypar {
 
   template<typename TypeTraits>
   void MultilevelUncoarsener<TypeTraits>::refineImpl() {
+    if ( _time_limit.isCancelled() ) {
+      // The projected partition is already a valid solution
+      return;
+    }
+
     PartitionedHypergraph& partitioned_hypergraph = *_uncoarseningData.partitioned_hg;
-    double time_limit = std::numeric_limits<double>::max();
+    double time_limit = Base::clampToRemainingTime(std::numeric_limits<double>::max());
     if (_current_level >= 0 && _current_level != _num_levels) {
       // there is a refinement run on the coarsest graph before projection. There is no value stored for this run, so we must avoid looking it up.
       time_limit = Base::refinementTimeLimit(_context, (_uncoarseningData.hierarchy)[_current_level].coarseningTime());
     }
+    // If the global time limit is exceeded, we only use label propagation on the remaining levels
+    const bool time_limit_exceeded = _time_limit.exceeded();
 
     if ( debug && _context.type == ContextType::main ) {
       io::printHypergraphInfo(partitioned_hypergraph.hypergraph(),
@@ -228,7 +236,7 @@ namespace mt_kahypar {
         _timer.stop_timer("label_propagation");
       }
 
-      if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+      if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing && !time_limit_exceeded ) {
         _timer.start_timer("initialize_fm_refiner", "Initialize FM Refiner");
         _fm->initialize(phg);
         _timer.stop_timer("initialize_fm_refiner");
@@ -238,7 +246,7 @@ namespace mt_kahypar {
         _timer.stop_timer("fm");
       }
 
-      if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
+      if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing && !time_limit_exceeded ) {
         _timer.start_timer("initialize_flow_scheduler", "Initialize Flow Scheduler");
         _flows->initialize(phg);
         _timer.stop_timer("initialize_flow_scheduler");
@@ -258,7 +266,8 @@ namespace mt_kahypar {
       const double relative_improvement = 1.0 -
         static_cast<double>(metric_after) / metric_before;
       if ( !_context.refinement.refine_until_no_improvement ||
-           relative_improvement <= _context.refinement.relative_improvement_threshold ) {
+           relative_improvement <= _context.refinement.relative_improvement_threshold ||
+           _time_limit.exceeded() ) {
         break;
       }
     }
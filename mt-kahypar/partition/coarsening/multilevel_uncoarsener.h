@@ -102,6 +102,7 @@ class MultilevelUncoarsener : public IUncoarsener<TypeTraits>,
   using Base::_flows;
   using Base::_rebalancer;
   using Base::_timer;
+  using Base::_time_limit;
 
   const TargetGraph* _target_graph;
   int _current_level;
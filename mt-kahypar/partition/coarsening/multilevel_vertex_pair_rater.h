@@ -39,7 +39,10 @@
 
 #include "mt-kahypar/datastructures/sparse_map.h"
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/small_rating_map.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_fixed_vertex_acceptance_policy.h"
+#include "mt-kahypar/utils/bit_ops.h"
+#include "mt-kahypar/utils/simd.h"
 
 
 namespace mt_kahypar {
@@ -52,6 +55,7 @@ class MultilevelVertexPairRater {
   using ThreadLocalCacheEfficientRatingMap = tbb_kahypar::enumerable_thread_specific<CacheEfficientRatingMap>;
   using ThreadLocalVertexDegreeBoundedRatingMap = tbb_kahypar::enumerable_thread_specific<CacheEfficientRatingMap>;
   using ThreadLocalLargeTmpRatingMap = tbb_kahypar::enumerable_thread_specific<LargeTmpRatingMap>;
+  using ThreadLocalSmallRatingMap = tbb_kahypar::enumerable_thread_specific<SmallRatingMap>;
   using ThreadLocalFastResetFlagArray = tbb_kahypar::enumerable_thread_specific<kahypar::ds::FastResetFlagArray<> >;
 
  private:
@@ -81,6 +85,7 @@ class MultilevelVertexPairRater {
   };
 
   enum class RatingMapType {
+    SMALL_RATING_MAP,
     CACHE_EFFICIENT_RATING_MAP,
     VERTEX_DEGREE_BOUNDED_RATING_MAP,
     LARGE_RATING_MAP
@@ -88,15 +93,21 @@ class MultilevelVertexPairRater {
 
   using AtomicWeight = parallel::IntegralAtomicWrapper<HypernodeWeight>;
 
+  static_assert(sizeof(AtomicWeight) == sizeof(HypernodeWeight),
+    "The small rating map reads the cluster weights as plain array");
+
  public:
   using Rating = VertexPairRating;
 
   MultilevelVertexPairRater(const HypernodeID num_hypernodes,
                             const HypernodeID max_edge_size,
-                            const Context& context) :
+                            const Context& context,
+                            const utils::SIMDInstructionSet instruction_set =
+                              utils::supportedSIMDInstructionSet()) :
     _context(context),
     _current_num_nodes(num_hypernodes),
     _vertex_degree_sampling_threshold(context.coarsening.vertex_degree_sampling_threshold),
+    _local_small_rating_map(SmallRatingMap(instruction_set)),
     _local_cache_efficient_rating_map(0.0),
     _local_vertex_degree_bounded_rating_map(3UL * _vertex_degree_sampling_threshold, 0.0),
     _local_large_rating_map([&] {
@@ -123,7 +134,10 @@ class MultilevelVertexPairRater {
                         const HypernodeWeight max_allowed_node_weight) {
 
     const RatingMapType rating_map_type = getRatingMapTypeForRatingOfHypernode(hypergraph, u);
-    if ( rating_map_type == RatingMapType::CACHE_EFFICIENT_RATING_MAP ) {
+    if ( rating_map_type == RatingMapType::SMALL_RATING_MAP ) {
+      return rateWithSmallRatingMap<has_fixed_vertices>(hypergraph, u, _local_small_rating_map.local(),
+        cluster_ids, cluster_weight, fixed_vertices, max_allowed_node_weight);
+    } else if ( rating_map_type == RatingMapType::CACHE_EFFICIENT_RATING_MAP ) {
       return rate<has_fixed_vertices>(hypergraph, u, _local_cache_efficient_rating_map.local(),
         cluster_ids, cluster_weight, fixed_vertices, max_allowed_node_weight, false);
     } else if ( rating_map_type == RatingMapType::VERTEX_DEGREE_BOUNDED_RATING_MAP ) {
@@ -170,52 +184,137 @@ class MultilevelVertexPairRater {
       fillRatingMap(hypergraph, u, tmp_ratings, cluster_ids);
     }
 
-    int cpu_id = THREAD_ID;
+    const int cpu_id = THREAD_ID;
     const HypernodeWeight weight_u = cluster_weight[u];
-    const PartitionID community_u_id = hypergraph.communityID(u);
-    RatingType max_rating = std::numeric_limits<RatingType>::min();
-    HypernodeID target = std::numeric_limits<HypernodeID>::max();
-    HypernodeID target_id = std::numeric_limits<HypernodeID>::max();
+    VertexPairRating ret;
     for (auto it = tmp_ratings.end() - 1; it >= tmp_ratings.begin(); --it) {
-      const HypernodeID tmp_target_id = it->key;
-      const HypernodeID tmp_target = tmp_target_id;
-      const HypernodeWeight target_weight = cluster_weight[tmp_target_id];
-
+      const HypernodeID tmp_target = it->key;
+      const HypernodeWeight target_weight = cluster_weight[tmp_target];
       if ( tmp_target != u && weight_u + target_weight <= max_allowed_node_weight ) {
-        HypernodeWeight penalty = HeavyNodePenaltyPolicy::penalty(weight_u, target_weight);
-        penalty = penalty == 0 ? std::max(std::max(weight_u, target_weight), 1) : penalty;
-        const RatingType tmp_rating = it->value / static_cast<double>(penalty);
-
-        bool accept_fixed_vertex_contraction = true;
-        if constexpr ( has_fixed_vertices ) {
-          accept_fixed_vertex_contraction =
-            FixedVertexAcceptancePolicy::acceptContraction(
-              hypergraph, fixed_vertices, _context, tmp_target, u);
-        }
-
-        DBG << "r(" << u << "," << tmp_target << ")=" << tmp_rating;
-        if ( accept_fixed_vertex_contraction &&
-             community_u_id == hypergraph.communityID(tmp_target) &&
-             AcceptancePolicy::acceptRating( tmp_rating, max_rating,
-               target_id, tmp_target_id, cpu_id, _already_matched) ) {
-          max_rating = tmp_rating;
-          target_id = tmp_target_id;
-          target = tmp_target;
-        }
+        updateBestRating<has_fixed_vertices>(hypergraph, u, weight_u,
+          tmp_target, target_weight, it->value, fixed_vertices, cpu_id, ret);
       }
     }
+    tmp_ratings.clear();
+    return ret;
+  }
+
+  template<bool has_fixed_vertices, typename Hypergraph>
+  VertexPairRating rateWithSmallRatingMap(const Hypergraph& hypergraph,
+                                          const HypernodeID u,
+                                          SmallRatingMap& tmp_ratings,
+                                          const parallel::scalable_vector<HypernodeID>& cluster_ids,
+                                          const parallel::scalable_vector<AtomicWeight>& cluster_weight,
+                                          const ds::FixedVertexSupport<Hypergraph>& fixed_vertices,
+                                          const HypernodeWeight max_allowed_node_weight) {
+    switch ( tmp_ratings.instructionSet() ) {
+      #ifdef KAHYPAR_HAS_SIMD_DISPATCH
+      case utils::SIMDInstructionSet::avx512:
+        return rateWithSmallRatingMapAVX512<has_fixed_vertices>(hypergraph, u, tmp_ratings,
+          cluster_ids, cluster_weight, fixed_vertices, max_allowed_node_weight);
+      case utils::SIMDInstructionSet::avx2:
+        return rateWithSmallRatingMapAVX2<has_fixed_vertices>(hypergraph, u, tmp_ratings,
+          cluster_ids, cluster_weight, fixed_vertices, max_allowed_node_weight);
+      #endif
+      default:
+        return rateWithSmallRatingMapImpl<has_fixed_vertices, utils::SIMDInstructionSet::scalar>(
+          hypergraph, u, tmp_ratings, cluster_ids, cluster_weight, fixed_vertices, max_allowed_node_weight);
+    }
+  }
+
+  #ifdef KAHYPAR_HAS_SIMD_DISPATCH
+  template<bool has_fixed_vertices, typename Hypergraph>
+  KAHYPAR_TARGET_AVX2_FLATTEN VertexPairRating rateWithSmallRatingMapAVX2(
+    const Hypergraph& hypergraph,
+    const HypernodeID u,
+    SmallRatingMap& tmp_ratings,
+    const parallel::scalable_vector<HypernodeID>& cluster_ids,
+    const parallel::scalable_vector<AtomicWeight>& cluster_weight,
+    const ds::FixedVertexSupport<Hypergraph>& fixed_vertices,
+    const HypernodeWeight max_allowed_node_weight) {
+    return rateWithSmallRatingMapImpl<has_fixed_vertices, utils::SIMDInstructionSet::avx2>(
+      hypergraph, u, tmp_ratings, cluster_ids, cluster_weight, fixed_vertices, max_allowed_node_weight);
+  }
 
+  template<bool has_fixed_vertices, typename Hypergraph>
+  KAHYPAR_TARGET_AVX512_FLATTEN VertexPairRating rateWithSmallRatingMapAVX512(
+    const Hypergraph& hypergraph,
+    const HypernodeID u,
+    SmallRatingMap& tmp_ratings,
+    const parallel::scalable_vector<HypernodeID>& cluster_ids,
+    const parallel::scalable_vector<AtomicWeight>& cluster_weight,
+    const ds::FixedVertexSupport<Hypergraph>& fixed_vertices,
+    const HypernodeWeight max_allowed_node_weight) {
+    return rateWithSmallRatingMapImpl<has_fixed_vertices, utils::SIMDInstructionSet::avx512>(
+      hypergraph, u, tmp_ratings, cluster_ids, cluster_weight, fixed_vertices, max_allowed_node_weight);
+  }
+  #endif
+
+  // ! Same as rate(...), but the weight constraint of all neighbors is
+  // ! checked at once. The remaining candidates are visited in the same
+  // ! order as in rate(...) (reverse insertion order).
+  template<bool has_fixed_vertices, utils::SIMDInstructionSet instruction_set, typename Hypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE VertexPairRating rateWithSmallRatingMapImpl(
+    const Hypergraph& hypergraph,
+    const HypernodeID u,
+    SmallRatingMap& tmp_ratings,
+    const parallel::scalable_vector<HypernodeID>& cluster_ids,
+    const parallel::scalable_vector<AtomicWeight>& cluster_weight,
+    const ds::FixedVertexSupport<Hypergraph>& fixed_vertices,
+    const HypernodeWeight max_allowed_node_weight) {
+    fillSmallRatingMap<instruction_set>(hypergraph, u, tmp_ratings, cluster_ids);
+
+    const int cpu_id = THREAD_ID;
+    const HypernodeWeight weight_u = cluster_weight[u];
+    uint64_t candidates = tmp_ratings.feasibleEntries(
+      u, cluster_weight.data(), max_allowed_node_weight - weight_u);
     VertexPairRating ret;
-    if (max_rating != std::numeric_limits<RatingType>::min()) {
-      ASSERT(target != std::numeric_limits<HypernodeID>::max(), "invalid contraction target");
-      ret.value = max_rating;
-      ret.target = target;
-      ret.valid = true;
+    while ( candidates ) {
+      const int i = utils::highest_set_bit_64(candidates);
+      candidates ^= uint64_t(1) << i;
+      const HypernodeID tmp_target = tmp_ratings.key(i);
+      updateBestRating<has_fixed_vertices>(hypergraph, u, weight_u,
+        tmp_target, cluster_weight[tmp_target].load(std::memory_order_relaxed),
+        tmp_ratings.value(i), fixed_vertices, cpu_id, ret);
     }
     tmp_ratings.clear();
     return ret;
   }
 
+  // ! Replaces the current best rating, if contracting u onto tmp_target
+  // ! is accepted by the rating, community and fixed vertex policies
+  template<bool has_fixed_vertices, typename Hypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updateBestRating(const Hypergraph& hypergraph,
+                                                           const HypernodeID u,
+                                                           const HypernodeWeight weight_u,
+                                                           const HypernodeID tmp_target,
+                                                           const HypernodeWeight target_weight,
+                                                           const RatingType score,
+                                                           const ds::FixedVertexSupport<Hypergraph>& fixed_vertices,
+                                                           const int cpu_id,
+                                                           VertexPairRating& best) {
+    HypernodeWeight penalty = HeavyNodePenaltyPolicy::penalty(weight_u, target_weight);
+    penalty = penalty == 0 ? std::max(std::max(weight_u, target_weight), 1) : penalty;
+    const RatingType tmp_rating = score / static_cast<double>(penalty);
+
+    bool accept_fixed_vertex_contraction = true;
+    if constexpr ( has_fixed_vertices ) {
+      accept_fixed_vertex_contraction =
+        FixedVertexAcceptancePolicy::acceptContraction(
+          hypergraph, fixed_vertices, _context, tmp_target, u);
+    }
+
+    DBG << "r(" << u << "," << tmp_target << ")=" << tmp_rating;
+    if ( accept_fixed_vertex_contraction &&
+         hypergraph.communityID(u) == hypergraph.communityID(tmp_target) &&
+         AcceptancePolicy::acceptRating( tmp_rating, best.value,
+           best.target, tmp_target, cpu_id, _already_matched) ) {
+      best.value = tmp_rating;
+      best.target = tmp_target;
+      best.valid = true;
+    }
+  }
+
   template<typename Hypergraph, typename RatingMap>
   void fillRatingMap(const Hypergraph& hypergraph,
                      const HypernodeID u,
@@ -253,6 +352,40 @@ class MultilevelVertexPairRater {
     }
   }
 
+  // ! Same as fillRatingMap(...), but the pins of a hyperedge are deduplicated
+  // ! with a bitmask of their entries in the small rating map (instead of the
+  // ! bloom filter)
+  template<utils::SIMDInstructionSet instruction_set, typename Hypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void fillSmallRatingMap(const Hypergraph& hypergraph,
+                                                             const HypernodeID u,
+                                                             SmallRatingMap& tmp_ratings,
+                                                             const parallel::scalable_vector<HypernodeID>& cluster_ids) {
+    if constexpr (Hypergraph::is_graph) {
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
+        const RatingType score = ScorePolicy::score(hypergraph.edgeWeight(he), hypergraph.edgeSize(he));
+        const HypernodeID representative = cluster_ids[hypergraph.edgeTarget(he)];
+        ASSERT(representative < hypergraph.initialNumNodes());
+        tmp_ratings.addScore(tmp_ratings.template findOrInsert<instruction_set>(representative), score);
+      }
+    } else {
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
+        HypernodeID edge_size = hypergraph.edgeSize(he);
+        ASSERT(edge_size > 1, V(he));
+        if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
+          uint64_t entries = 0;
+          for ( const HypernodeID& v : hypergraph.pins(he) ) {
+            const HypernodeID representative = cluster_ids[v];
+            ASSERT(representative < hypergraph.initialNumNodes());
+            entries |= uint64_t(1) << tmp_ratings.template findOrInsert<instruction_set>(representative);
+          }
+          edge_size = _context.coarsening.use_adaptive_edge_size ?
+            std::max(static_cast<HypernodeID>(utils::popcount_64(entries)), ID(2)) : edge_size;
+          tmp_ratings.addScoreToEntries(entries, ScorePolicy::score(hypergraph.edgeWeight(he), edge_size));
+        }
+      }
+    }
+  }
+
   template<typename Hypergraph, typename RatingMap>
   void fillRatingMapWithSampling(const Hypergraph& hypergraph,
                                  const HypernodeID u,
@@ -332,6 +465,10 @@ class MultilevelVertexPairRater {
     const size_t size_of_smaller_rating_map = std::min(
       vertex_degree_bounded_rating_map_size, cache_efficient_rating_map_size);
 
+    if ( _context.coarsening.rating.use_small_rating_map && fitsIntoSmallRatingMap(hypergraph, u) ) {
+      return RatingMapType::SMALL_RATING_MAP;
+    }
+
     // In case the current number of nodes is smaller than size
     // of the cache-efficient sparse map, the large tmp rating map
     // consumes less memory
@@ -371,6 +508,26 @@ class MultilevelVertexPairRater {
     return RatingMapType::CACHE_EFFICIENT_RATING_MAP;
   }
 
+  // ! Returns true, if the estimated number of neighbors of u is
+  // ! at most the capacity of the small rating map
+  template<typename Hypergraph>
+  inline bool fitsIntoSmallRatingMap(const Hypergraph& hypergraph,
+                                     const HypernodeID u) const {
+    if constexpr (Hypergraph::is_graph) {
+      return hypergraph.nodeDegree(u) <= SmallRatingMap::CAPACITY;
+    } else {
+      HypernodeID ub_neighbors_u = 0;
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
+        const HypernodeID edge_size = hypergraph.edgeSize(he);
+        ub_neighbors_u += edge_size < _context.partition.ignore_hyperedge_size_threshold ? edge_size : 0;
+        if ( ub_neighbors_u > SmallRatingMap::CAPACITY ) {
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+
   LargeTmpRatingMap construct_large_tmp_rating_map() {
     return LargeTmpRatingMap(_current_num_nodes);
   }
@@ -385,6 +542,9 @@ class MultilevelVertexPairRater {
   // ! Maximum number of neighbors that are considered for rating
   size_t _vertex_degree_sampling_threshold;
 
+  // ! Dense rating map with SIMD lookups that is used if the estimated
+  // ! number of neighbors is at most SmallRatingMap::CAPACITY
+  ThreadLocalSmallRatingMap _local_small_rating_map;
   // ! Cache efficient rating map (with linear probing) that is used if the
   // ! estimated number of neighbors smaller than 10922 (= 32768 / 3)
   ThreadLocalCacheEfficientRatingMap _local_cache_efficient_rating_map;
@@ -222,6 +222,7 @@ class NLevelCoarsener : public ICoarsener,
     }
 
     ++_pass_nr;
+    Base::reportProgress(_pass_nr, _cl_tracker.currentNumNodes());
     return true;
   }
 
@@ -237,7 +238,8 @@ class NLevelCoarsener : public ICoarsener,
   }
 
   bool shouldNotTerminateImpl() const override {
-    return _cl_tracker.currentNumNodes() > _context.coarsening.contraction_limit;
+    return _cl_tracker.currentNumNodes() > _context.coarsening.contraction_limit &&
+      !_time_limit.exceeded(utils::TimeLimit::COARSENING_SHARE);
   }
 
   void terminateImpl() override {
@@ -321,6 +323,7 @@ class NLevelCoarsener : public ICoarsener,
   using Base::_hg;
   using Base::_context;
   using Base::_timer;
+  using Base::_time_limit;
   using Base::_uncoarseningData;
   Rater _rater;
   const HypernodeID _initial_num_nodes;
@@ -57,6 +57,8 @@ class NLevelCoarsenerBase {
     _hg(hypergraph),
     _context(context),
     _timer(utils::Utilities::instance().getTimer(context.utility_id)),
+    _time_limit(utils::Utilities::instance().getTimeLimit(context.utility_id)),
+    _progress_reporter(utils::Utilities::instance().getProgressReporter(context.utility_id)),
     _uncoarseningData(uncoarseningData) { }
 
   NLevelCoarsenerBase(const NLevelCoarsenerBase&) = delete;
@@ -78,6 +80,13 @@ class NLevelCoarsenerBase {
     return *_uncoarseningData.compactified_phg;
   }
 
+  // ! Reports the progress of the main partitioning context after a coarsening pass
+  void reportProgress(const size_t level, const HypernodeID num_nodes) const {
+    if ( _context.type == ContextType::main ) {
+      _progress_reporter.report(utils::ProgressReporter::Phase::coarsening, level, num_nodes, 0);
+    }
+  }
+
   void removeSinglePinAndParallelNets(const HighResClockTimepoint& round_start) {
     _timer.start_timer("remove_single_pin_and_parallel_nets", "Remove Single Pin and Parallel Nets");
     _uncoarseningData.removed_hyperedges_batches.emplace_back(_hg.removeSinglePinAndParallelHyperedges());
@@ -92,6 +101,8 @@ class NLevelCoarsenerBase {
   Hypergraph& _hg;
   const Context& _context;
   utils::Timer& _timer;
+  const utils::TimeLimit& _time_limit;
+  const utils::ProgressReporter& _progress_reporter;
   UncoarseningData<TypeTraits>& _uncoarseningData;
 };
 }  // namespace mt_kahypar
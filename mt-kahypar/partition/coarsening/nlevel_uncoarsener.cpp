@@ -234,6 +234,8 @@ namespace mt_kahypar {
         _timer.enable();
       }
     }
+
+    Base::reportProgress(_hierarchy.size(), _stats.current_number_of_nodes, _current_metrics.quality);
   }
 
   template<typename TypeTraits>
@@ -314,6 +316,9 @@ namespace mt_kahypar {
     vec<HypernodeID> refinement_nodes = _tmp_refinement_nodes.copy_parallel();
     _tmp_refinement_nodes.clear_parallel();
     _border_vertices_of_batch.reset();
+    if ( _time_limit.isCancelled() ) {
+      return;
+    }
 
     if ( debug && _context.type == ContextType::main ) {
       io::printHypergraphInfo(partitioned_hypergraph.hypergraph(),
@@ -335,7 +340,8 @@ namespace mt_kahypar {
         _timer.stop_timer("local_label_propagation", _force_measure_timings);
       }
 
-      if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+      // If the global time limit is exceeded, we only use label propagation for the remaining batches
+      if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing && !_time_limit.exceeded() ) {
         _timer.start_timer("local_fm", "FM", false, _force_measure_timings);
         improvement_found |= _fm->refine(phg,
           refinement_nodes, _current_metrics, std::numeric_limits<double>::max());
@@ -362,7 +368,7 @@ namespace mt_kahypar {
   template<typename TypeTraits>
   void NLevelUncoarsener<TypeTraits>::globalRefine(PartitionedHypergraph& partitioned_hypergraph,
                                        const double time_limit) {
-    if ( _context.refinement.global.use_global_refinement ) {
+    if ( _context.refinement.global.use_global_refinement && !_time_limit.isCancelled() ) {
       if ( debug && _context.type == ContextType::main ) {
         io::printHypergraphInfo(partitioned_hypergraph.hypergraph(),
           _context, "Refinement Hypergraph", false);
@@ -381,6 +387,8 @@ namespace mt_kahypar {
       // Apply global FM parameters to FM context and temporary store old fm context
       _timer.start_timer("global_refinement", "Global Refinement");
       bool improvement_found = true;
+      // If the global time limit is exceeded, we only use label propagation
+      const bool time_limit_exceeded = _time_limit.exceeded();
       mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hypergraph);
       runInGlobalRefinementContext([&]{
         while( improvement_found ) {
@@ -395,13 +403,13 @@ namespace mt_kahypar {
           }
 
           IRefiner* fm_ptr = _global_fm ? _global_fm.get() : _fm.get();
-          if ( fm_ptr && _context.refinement.global.fm_algorithm != FMAlgorithm::do_nothing ) {
+          if ( fm_ptr && _context.refinement.global.fm_algorithm != FMAlgorithm::do_nothing && !time_limit_exceeded ) {
             _timer.start_timer("fm", "FM");
               improvement_found |= fm_ptr->refine(phg, {}, _current_metrics, time_limit);
             _timer.stop_timer("fm");
           }
 
-          if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
+          if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing && !time_limit_exceeded ) {
             _timer.start_timer("initialize_flow_scheduler", "Initialize Flow Scheduler");
             _flows->initialize(phg);
             _timer.stop_timer("initialize_flow_scheduler");
@@ -421,7 +429,8 @@ namespace mt_kahypar {
           const double relative_improvement = 1.0 -
             static_cast<double>(metric_after) / metric_before;
           if ( !_context.refinement.global.refine_until_no_improvement ||
-              relative_improvement <= _context.refinement.relative_improvement_threshold ) {
+              relative_improvement <= _context.refinement.relative_improvement_threshold ||
+              _time_limit.exceeded() ) {
             break;
           }
         }
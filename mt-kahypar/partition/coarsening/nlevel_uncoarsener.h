@@ -150,6 +150,7 @@ class NLevelUncoarsener : public IUncoarsener<TypeTraits>,
   using Base::_flows;
   using Base::_rebalancer;
   using Base::_timer;
+  using Base::_time_limit;
 
   const TargetGraph* _target_graph;
 
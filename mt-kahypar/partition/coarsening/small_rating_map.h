@@ -0,0 +1,204 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/bit_ops.h"
+#include "mt-kahypar/utils/simd.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Rating map for nodes with only a few neighbors. The ratings are accumulated
+ * in a small dense table, where the keys and ratings are stored in two separate
+ * arrays (in insertion order). Looking up a key compares 8 (AVX2) or
+ * 16 (AVX-512) keys at once.
+ *
+ * The instruction set is a template parameter of the lookup functions such
+ * that callers can dispatch once for a whole rating instead of for each pin.
+ * Note that the SIMD variants are compiled with function-level target
+ * attributes, they can only be inlined into functions compiled for the same
+ * (or a wider) instruction set (see KAHYPAR_TARGET_AVX2_FLATTEN).
+ */
+class SmallRatingMap {
+
+  static_assert(sizeof(HypernodeID) == sizeof(int32_t));
+
+  using InstructionSet = utils::SIMDInstructionSet;
+  using AtomicWeight = parallel::IntegralAtomicWrapper<HypernodeWeight>;
+
+ public:
+  // ! Must be a multiple of the number of 32-bit lanes of AVX-512 and
+  // ! fit into the 64-bit masks used to represent a subset of the entries
+  static constexpr size_t CAPACITY = 64;
+
+  explicit SmallRatingMap(const InstructionSet instruction_set =
+                            utils::supportedSIMDInstructionSet()) :
+    _instruction_set(instruction_set),
+    _size(0),
+    _keys(),
+    _values() {
+    if ( !utils::isSupported(_instruction_set) ) {
+      _instruction_set = utils::supportedSIMDInstructionSet();
+    }
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  HypernodeID key(const size_t i) const {
+    ASSERT(i < _size);
+    return _keys[i];
+  }
+
+  RatingType value(const size_t i) const {
+    ASSERT(i < _size);
+    return _values[i];
+  }
+
+  // ! Instruction set that should be used for this map
+  InstructionSet instructionSet() const {
+    return _instruction_set;
+  }
+
+  // ! Returns the position of the key (inserts the key with rating zero, if
+  // ! it is not contained in the map)
+  template<InstructionSet instruction_set = InstructionSet::scalar>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t findOrInsert(const HypernodeID key) {
+    const size_t pos = find<instruction_set>(key);
+    if ( pos == _size ) {
+      ASSERT(_size < CAPACITY);
+      _keys[_size] = key;
+      _values[_size] = 0.0;
+      ++_size;
+    }
+    return pos;
+  }
+
+  // ! Adds the score to the rating of the i-th entry
+  void addScore(const size_t i, const RatingType score) {
+    ASSERT(i < _size);
+    _values[i] += score;
+  }
+
+  // ! Adds the score to the ratings of all entries in the bitmask
+  void addScoreToEntries(uint64_t entries, const RatingType score) {
+    for ( ; entries; entries &= entries - 1 ) {
+      addScore(utils::lowest_set_bit_64(entries), score);
+    }
+  }
+
+  // ! Returns a bitmask of all entries i with key(i) != u and
+  // ! cluster_weight[key(i)] <= max_target_weight (bit i corresponds to entry i).
+  // ! Note that the cluster weights are modified concurrently. They are loaded
+  // ! with relaxed atomics, which is fine since the weight constraint is checked
+  // ! again when two clusters are joined.
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE uint64_t feasibleEntries(const HypernodeID u,
+                                                              const AtomicWeight* cluster_weight,
+                                                              const HypernodeWeight max_target_weight) const {
+    uint64_t mask = 0;
+    for ( size_t i = 0; i < _size; ++i ) {
+      const bool is_feasible = _keys[i] != u &&
+        cluster_weight[_keys[i]].load(std::memory_order_relaxed) <= max_target_weight;
+      mask |= static_cast<uint64_t>(is_feasible) << i;
+    }
+    return mask;
+  }
+
+  void clear() {
+    _size = 0;
+  }
+
+ private:
+  // ! Returns the position of the key or size(), if the key is not contained
+  template<InstructionSet instruction_set>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t find(const HypernodeID key) const {
+    #ifdef KAHYPAR_HAS_SIMD_DISPATCH
+    if constexpr ( instruction_set == InstructionSet::avx512 ) {
+      return findAVX512(key);
+    } else if constexpr ( instruction_set == InstructionSet::avx2 ) {
+      return findAVX2(key);
+    }
+    #endif
+    return findScalar(key);
+  }
+
+  size_t findScalar(const HypernodeID key) const {
+    size_t pos = 0;
+    while ( pos < _size && _keys[pos] != key ) {
+      ++pos;
+    }
+    return pos;
+  }
+
+  #ifdef KAHYPAR_HAS_SIMD_DISPATCH
+  KAHYPAR_TARGET_AVX2 size_t findAVX2(const HypernodeID key) const {
+    const __m256i key_256 = _mm256_set1_epi32(key);
+    for ( size_t i = 0; i < _size; i += 8 ) {
+      const __m256i keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_keys + i));
+      const uint32_t matches = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(keys, key_256))) & validLanes(i, 8);
+      if ( matches ) {
+        return i + __builtin_ctz(matches);
+      }
+    }
+    return _size;
+  }
+
+  KAHYPAR_TARGET_AVX512 size_t findAVX512(const HypernodeID key) const {
+    const __m512i key_512 = _mm512_set1_epi32(key);
+    for ( size_t i = 0; i < _size; i += 16 ) {
+      const __m512i keys = _mm512_loadu_si512(_keys + i);
+      const uint32_t matches = _mm512_mask_cmpeq_epi32_mask(validLanes(i, 16), keys, key_512);
+      if ( matches ) {
+        return i + __builtin_ctz(matches);
+      }
+    }
+    return _size;
+  }
+  #endif
+
+  // ! Bitmask of the lanes starting at position i that contain an entry
+  uint32_t validLanes(const size_t i, const size_t num_lanes) const {
+    const size_t remaining = _size - i;
+    return remaining >= num_lanes ? (1U << num_lanes) - 1 : (1U << remaining) - 1;
+  }
+
+  InstructionSet _instruction_set;
+  size_t _size;
+  alignas(64) HypernodeID _keys[CAPACITY];
+  alignas(64) RatingType _values[CAPACITY];
+};
+
+}  // namespace mt_kahypar
@@ -58,6 +58,8 @@ class UncoarsenerBase {
           _hg(hypergraph),
           _context(context),
           _timer(utils::Utilities::instance().getTimer(context.utility_id)),
+          _time_limit(utils::Utilities::instance().getTimeLimit(context.utility_id)),
+          _progress_reporter(utils::Utilities::instance().getProgressReporter(context.utility_id)),
           _uncoarseningData(uncoarseningData),
           _gain_cache(gain_cache_t {nullptr, GainPolicy::none}),
           _label_propagation(nullptr),
@@ -78,6 +80,8 @@ class UncoarsenerBase {
   Hypergraph& _hg;
   const Context& _context;
   utils::Timer& _timer;
+  const utils::TimeLimit& _time_limit;
+  const utils::ProgressReporter& _progress_reporter;
   UncoarseningData<TypeTraits>& _uncoarseningData;
   gain_cache_t _gain_cache;
   std::unique_ptr<IRefiner> _label_propagation;
@@ -90,9 +94,23 @@ class UncoarsenerBase {
   double refinementTimeLimit(const Context& context, const double time) {
     if ( context.refinement.fm.time_limit_factor != std::numeric_limits<double>::max() ) {
       const double time_limit_factor = std::max(1.0,  context.refinement.fm.time_limit_factor * context.partition.k);
-      return std::max(5.0, time_limit_factor * time);
+      return clampToRemainingTime(std::max(5.0, time_limit_factor * time));
     } else {
-      return std::numeric_limits<double>::max();
+      return clampToRemainingTime(std::numeric_limits<double>::max());
+    }
+  }
+
+  // FM switches to a light-weight configuration if it reaches its time limit and
+  // aborts when it reaches twice the time limit. We therefore use half of the
+  // remaining time of the global time limit (if set) as upper bound.
+  double clampToRemainingTime(const double time_limit) const {
+    return _time_limit.isEnabled() ? std::min(time_limit, _time_limit.remaining() / 2) : time_limit;
+  }
+
+  // ! Reports the progress of the main partitioning context after an uncoarsening level
+  void reportProgress(const size_t level, const HypernodeID num_nodes, const HyperedgeWeight objective) const {
+    if ( _context.type == ContextType::main ) {
+      _progress_reporter.report(utils::ProgressReporter::Phase::refinement, level, num_nodes, objective);
     }
   }
 
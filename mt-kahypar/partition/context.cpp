@@ -42,6 +42,13 @@ namespace mt_kahypar {
     }
     if ( params.write_partition_file ) {
       str << "  Partition File:                     " << params.graph_partition_filename << std::endl;
+      str << "  Partition File Format:              " << params.partition_file_format << std::endl;
+    }
+    if ( params.coarsening_snapshot_input_file != "" ) {
+      str << "  Read Coarsening Snapshot:           " << params.coarsening_snapshot_input_file << std::endl;
+    }
+    if ( params.coarsening_snapshot_output_file != "" ) {
+      str << "  Write Coarsening Snapshot:          " << params.coarsening_snapshot_output_file << std::endl;
     }
     str << "  Mode:                               " << params.mode << std::endl;
     str << "  Objective:                          " << params.objective << std::endl;
@@ -58,6 +65,13 @@ namespace mt_kahypar {
     str << "  epsilon:                            " << params.epsilon << std::endl;
     str << "  seed:                               " << params.seed << std::endl;
     str << "  Number of V-Cycles:                 " << params.num_vcycles << std::endl;
+    str << "  Portfolio Size:                     " << params.portfolio_size << std::endl;
+    if ( params.time_limit > 0 ) {
+      str << "  Time Limit:                         " << params.time_limit << "s" << std::endl;
+    }
+    if ( params.max_memory > 0 ) {
+      str << "  Memory Budget:                      " << params.max_memory << " MB" << std::endl;
+    }
     str << "  Ignore HE Size Threshold:           " << params.ignore_hyperedge_size_threshold << std::endl;
     str << "  Large HE Size Threshold:            " << params.large_hyperedge_size_threshold << std::endl;
     if ( params.use_individual_part_weights ) {
@@ -88,6 +102,7 @@ namespace mt_kahypar {
     str << "Preprocessing Parameters:" << std::endl;
     str << "  Use Community Detection:            " << std::boolalpha << params.use_community_detection << std::endl;
     str << "  Disable C. D. for Mesh Graphs:      " << std::boolalpha << params.disable_community_detection_for_mesh_graphs << std::endl;
+    str << "  Node Ordering:                      " << params.node_ordering << std::endl;
     if (params.use_community_detection) {
       str << std::endl << params.community_detection;
     }
@@ -99,6 +114,7 @@ namespace mt_kahypar {
     str << "    Rating Function:                  " << params.rating_function << std::endl;
     str << "    Heavy Node Penalty:               " << params.heavy_node_penalty_policy << std::endl;
     str << "    Acceptance Policy:                " << params.acceptance_policy << std::endl;
+    str << "    Use Small Rating Map:             " << std::boolalpha << params.use_small_rating_map << std::endl;
     return str;
   }
 
@@ -115,6 +131,9 @@ namespace mt_kahypar {
     str << "  Maximum Shrink Factor:              " << params.maximum_shrink_factor << std::endl;
     str << "  Vertex Degree Sampling Threshold:   " << params.vertex_degree_sampling_threshold << std::endl;
     str << "  Number of subrounds (deterministic):" << params.num_sub_rounds_deterministic << std::endl;
+    str << "  Identical Net Detection:            " << params.identical_net_detection << std::endl;
+    str << "  Use Two-Hop Clustering:             " << std::boolalpha << params.use_two_hop_clustering << std::endl;
+    str << "  Two-Hop Shrink Factor Threshold:    " << params.two_hop_shrink_factor_threshold << std::endl;
     str << std::endl << params.rating;
     return str;
   }
@@ -144,6 +163,7 @@ namespace mt_kahypar {
       out << "    Obey Minimal Parallelism:         " << std::boolalpha << params.obey_minimal_parallelism << std::endl;
       out << "    Minimum Improvement Factor:       " << params.min_improvement << std::endl;
       out << "    Release Nodes:                    " << std::boolalpha << params.release_nodes << std::endl;
+      out << "    Bucket PQ Max Gain:               " << params.bucket_pq_max_gain << std::endl;
       out << "    Time Limit Factor:                " << params.time_limit_factor << std::endl;
     }
     if ( params.algorithm == FMAlgorithm::unconstrained_fm ) {
@@ -207,6 +227,7 @@ namespace mt_kahypar {
   std::ostream & operator<< (std::ostream& str, const RefinementParameters& params) {
     str << "Refinement Parameters:" << std::endl;
     str << "  Rebalancing Algorithm:              " << params.rebalancer << std::endl;
+    str << "  Sparse Gain Cache:                  " << std::boolalpha << params.sparse_gain_cache << std::endl;
     str << "  Refine Until No Improvement:        " << std::boolalpha << params.refine_until_no_improvement << std::endl;
     str << "  Relative Improvement Threshold:     " << params.relative_improvement_threshold << std::endl;
     str << "  Maximum Batch Size:                 " << params.max_batch_size << std::endl;
@@ -257,6 +278,8 @@ namespace mt_kahypar {
     }
     str << "  Use Localized Random Shuffle:       " << std::boolalpha << params.use_localized_random_shuffle << std::endl;
     str << "  Random Shuffle Block Size:          " << params.shuffle_block_size << std::endl;
+    str << "  Interleaved Allocations:            " << std::boolalpha << params.interleaved_allocations << std::endl;
+    str << "  Use Huge Pages:                     " << std::boolalpha << params.use_huge_pages << std::endl;
     return str;
   }
 
@@ -376,9 +399,6 @@ namespace mt_kahypar {
       if ( partition.preset_type == PresetType::large_k ) {
         // steiner trees scale really badly with k (cubic with no parallelization), so we don't want to support this
         throw UnsupportedOperationException("Large k partitioning is not supported for steiner tree metric.");
-      } else if ( partition.k > 64 && partition.instance_type == InstanceType::hypergraph ) {
-        // larger k currently don't work correctly due to collisions in the hash table
-        throw UnsupportedOperationException("Steiner tree metric on hypergraphs is currently only supported for k <= 64.");
       }
       if ( !target_graph ) {
         partition.objective = Objective::km1;
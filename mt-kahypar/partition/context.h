@@ -41,6 +41,7 @@ struct PartitioningParameters {
   Objective objective = Objective::UNDEFINED;
   GainPolicy gain_policy = GainPolicy::none;
   FileFormat file_format = FileFormat::hMetis;
+  FileFormat partition_file_format = FileFormat::hMetis;
   InstanceType instance_type = InstanceType::UNDEFINED;
   PresetType preset_type = PresetType::UNDEFINED;
   mt_kahypar_partition_type_t partition_type =  NULLPTR_PARTITION;
@@ -48,9 +49,11 @@ struct PartitioningParameters {
   PartitionID k = std::numeric_limits<PartitionID>::max();
   int seed = 0;
   size_t num_vcycles = 0;
+  size_t portfolio_size = 1;
   bool perform_parallel_recursion_in_deep_multilevel = true;
 
   int time_limit = 0;
+  size_t max_memory = 0;
   bool use_individual_part_weights = false;
   std::vector<HypernodeWeight> perfect_balance_part_weights;
   std::vector<HypernodeWeight> max_part_weights;
@@ -78,6 +81,8 @@ struct PartitioningParameters {
   std::string graph_partition_filename { };
   std::string graph_community_filename { };
   std::string preset_file { };
+  std::string coarsening_snapshot_input_file { };
+  std::string coarsening_snapshot_output_file { };
 };
 
 std::ostream & operator<< (std::ostream& str, const PartitioningParameters& params);
@@ -97,6 +102,7 @@ struct PreprocessingParameters {
   bool stable_construction_of_incident_edges = false;
   bool use_community_detection = false;
   bool disable_community_detection_for_mesh_graphs = true;
+  NodeOrdering node_ordering = NodeOrdering::none;
   CommunityDetectionParameters community_detection = { };
 };
 
@@ -106,6 +112,7 @@ struct RatingParameters {
   RatingFunction rating_function = RatingFunction::UNDEFINED;
   HeavyNodePenaltyPolicy heavy_node_penalty_policy = HeavyNodePenaltyPolicy::UNDEFINED;
   AcceptancePolicy acceptance_policy = AcceptancePolicy::UNDEFINED;
+  bool use_small_rating_map = false;
 };
 
 std::ostream & operator<< (std::ostream& str, const RatingParameters& params);
@@ -121,6 +128,9 @@ struct CoarseningParameters {
   double maximum_shrink_factor = std::numeric_limits<double>::max();
   size_t vertex_degree_sampling_threshold = std::numeric_limits<size_t>::max();
   size_t num_sub_rounds_deterministic = 16;
+  IdenticalNetDetection identical_net_detection = IdenticalNetDetection::bucket_map;
+  bool use_two_hop_clustering = false;
+  double two_hop_shrink_factor_threshold = 1.5;
 
   // Those will be determined dynamically
   HypernodeWeight max_allowed_node_weight = 0;
@@ -157,6 +167,8 @@ struct FMParameters {
   bool shuffle = true;
   mutable bool obey_minimal_parallelism = false;
   bool release_nodes = true;
+  // ! Vertex PQs use bucket queues if all gains are bounded by this value (0 = disabled)
+  Gain bucket_pq_max_gain = 0;
 
   // unconstrained
   size_t unconstrained_rounds = 1;
@@ -220,6 +232,7 @@ struct RefinementParameters {
   NLevelGlobalRefinementParameters global;
   FlowParameters flows;
   RebalancingAlgorithm rebalancer = RebalancingAlgorithm::do_nothing;
+  bool sparse_gain_cache = false;
   bool refine_until_no_improvement = false;
   double relative_improvement_threshold = 0.0;
   size_t max_batch_size = std::numeric_limits<size_t>::max();
@@ -269,6 +282,8 @@ struct SharedMemoryParameters {
   bool use_localized_random_shuffle = false;
   size_t shuffle_block_size = 2;
   double degree_of_parallelism = 1.0;
+  bool interleaved_allocations = true;
+  bool use_huge_pages = false;
 };
 
 std::ostream & operator<< (std::ostream& str, const SharedMemoryParameters& params);
@@ -48,6 +48,7 @@ namespace mt_kahypar {
     switch (format) {
       case FileFormat::hMetis: return os << "hMetis";
       case FileFormat::Metis: return os << "Metis";
+      case FileFormat::binary: return os << "binary";
         // omit default case to trigger compiler warning for missing cases
     }
     return os << static_cast<uint8_t>(format);
@@ -147,6 +148,18 @@ namespace mt_kahypar {
     return os << static_cast<uint8_t>(type);
   }
 
+  std::ostream & operator<< (std::ostream& os, const NodeOrdering& ordering) {
+    switch (ordering) {
+      case NodeOrdering::none: return os << "none";
+      case NodeOrdering::community: return os << "community";
+      case NodeOrdering::bfs: return os << "bfs";
+      case NodeOrdering::degree: return os << "degree";
+      case NodeOrdering::UNDEFINED: return os << "UNDEFINED";
+        // omit default case to trigger compiler warning for missing cases
+    }
+    return os << static_cast<uint8_t>(ordering);
+  }
+
   std::ostream & operator<< (std::ostream& os, const SimiliarNetCombinerStrategy& strategy) {
     switch (strategy) {
       case SimiliarNetCombinerStrategy::union_nets: return os << "union";
@@ -170,6 +183,16 @@ namespace mt_kahypar {
     return os << static_cast<uint8_t>(algo);
   }
 
+  std::ostream & operator<< (std::ostream& os, const IdenticalNetDetection& detection) {
+    switch (detection) {
+      case IdenticalNetDetection::bucket_map: return os << "bucket_map";
+      case IdenticalNetDetection::parallel_sort: return os << "parallel_sort";
+      case IdenticalNetDetection::UNDEFINED: return os << "UNDEFINED";
+        // omit default case to trigger compiler warning for missing cases
+    }
+    return os << static_cast<uint8_t>(detection);
+  }
+
   std::ostream & operator<< (std::ostream& os, const HeavyNodePenaltyPolicy& heavy_hn_policy) {
     switch (heavy_hn_policy) {
       case HeavyNodePenaltyPolicy::no_penalty: return os << "no_penalty";
@@ -344,6 +367,20 @@ namespace mt_kahypar {
     return LouvainEdgeWeight::UNDEFINED;
   }
 
+  NodeOrdering nodeOrderingFromString(const std::string& ordering) {
+    if (ordering == "none") {
+      return NodeOrdering::none;
+    } else if (ordering == "community") {
+      return NodeOrdering::community;
+    } else if (ordering == "bfs") {
+      return NodeOrdering::bfs;
+    } else if (ordering == "degree") {
+      return NodeOrdering::degree;
+    }
+    throw InvalidParameterException("Illegal option: " + ordering);
+    return NodeOrdering::UNDEFINED;
+  }
+
   SimiliarNetCombinerStrategy similiarNetCombinerStrategyFromString(const std::string& type) {
     if (type == "union") {
       return SimiliarNetCombinerStrategy::union_nets;
@@ -370,6 +407,16 @@ namespace mt_kahypar {
     return CoarseningAlgorithm::UNDEFINED;
   }
 
+  IdenticalNetDetection identicalNetDetectionFromString(const std::string& type) {
+    if (type == "bucket_map") {
+      return IdenticalNetDetection::bucket_map;
+    } else if (type == "parallel_sort") {
+      return IdenticalNetDetection::parallel_sort;
+    }
+    throw InvalidParameterException("Illegal option: " + type);
+    return IdenticalNetDetection::UNDEFINED;
+  }
+
   HeavyNodePenaltyPolicy heavyNodePenaltyFromString(const std::string& penalty) {
     if (penalty == "no_penalty") {
       return HeavyNodePenaltyPolicy::no_penalty;
@@ -46,6 +46,7 @@ enum class Type : int8_t {
 enum class FileFormat : int8_t {
   hMetis = 0,
   Metis = 1,
+  binary = 2,
 };
 
 enum class InstanceType : int8_t {
@@ -101,6 +102,14 @@ enum class LouvainEdgeWeight : uint8_t {
   UNDEFINED
 };
 
+enum class NodeOrdering : uint8_t {
+  none,
+  community,
+  bfs,
+  degree,
+  UNDEFINED
+};
+
 enum class SimiliarNetCombinerStrategy : uint8_t {
   union_nets,
   max_size,
@@ -116,6 +125,12 @@ enum class CoarseningAlgorithm : uint8_t {
   UNDEFINED
 };
 
+enum class IdenticalNetDetection : uint8_t {
+  bucket_map,
+  parallel_sort,
+  UNDEFINED
+};
+
 enum class RatingFunction : uint8_t {
   heavy_edge,
   ENABLE_EXPERIMENTAL_FEATURES(sameness COMMA)
@@ -203,10 +218,14 @@ std::ostream & operator<< (std::ostream& os, const GainPolicy& type);
 
 std::ostream & operator<< (std::ostream& os, const LouvainEdgeWeight& type);
 
+std::ostream & operator<< (std::ostream& os, const NodeOrdering& ordering);
+
 std::ostream & operator<< (std::ostream& os, const SimiliarNetCombinerStrategy& strategy);
 
 std::ostream & operator<< (std::ostream& os, const CoarseningAlgorithm& algo);
 
+std::ostream & operator<< (std::ostream& os, const IdenticalNetDetection& detection);
+
 std::ostream & operator<< (std::ostream& os, const HeavyNodePenaltyPolicy& heavy_hn_policy);
 
 std::ostream & operator<< (std::ostream& os, const AcceptancePolicy& acceptance_policy);
@@ -237,10 +256,14 @@ Objective objectiveFromString(const std::string& obj);
 
 LouvainEdgeWeight louvainEdgeWeightFromString(const std::string& type);
 
+NodeOrdering nodeOrderingFromString(const std::string& ordering);
+
 SimiliarNetCombinerStrategy similiarNetCombinerStrategyFromString(const std::string& type);
 
 CoarseningAlgorithm coarseningAlgorithmFromString(const std::string& type);
 
+IdenticalNetDetection identicalNetDetectionFromString(const std::string& type);
+
 HeavyNodePenaltyPolicy heavyNodePenaltyFromString(const std::string& penalty);
 
 AcceptancePolicy acceptanceCriterionFromString(const std::string& crit);
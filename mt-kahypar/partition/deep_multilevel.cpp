@@ -818,6 +818,15 @@ PartitionID deep_multilevel_partitioning(typename TypeTraits::PartitionedHypergr
   enableTimerAndStats(context, was_enabled_before);
   timer.stop_timer("initial_partitioning");
 
+  const utils::ProgressReporter& progress_reporter =
+    utils::Utilities::instance().getProgressReporter(context.utility_id);
+  if ( context.type == ContextType::main && progress_reporter.isEnabled() ) {
+    const size_t num_levels = nlevel ? uncoarseningData.removed_hyperedges_batches.size() :
+      uncoarseningData.hierarchy.size();
+    progress_reporter.report(utils::ProgressReporter::Phase::initial_partitioning,
+      num_levels, coarsest_phg.initialNumNodes(), metrics::quality(coarsest_phg, context));
+  }
+
   // ################## UNCOARSENING ##################
   io::printLocalSearchBanner(context);
   timer.start_timer("refinement", "Refinement");
@@ -0,0 +1,362 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "mt-kahypar/partition/incremental_repartitioner.h"
+
+#include <limits>
+#include <memory>
+
+#include <tbb_kahypar/parallel_for.h>
+#include <tbb_kahypar/parallel_invoke.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
+#include "mt-kahypar/partition/factories.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/refinement/gains/gain_cache_ptr.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/exception.h"
+#include "mt-kahypar/utils/utilities.h"
+
+namespace mt_kahypar {
+
+namespace {
+
+template<typename PartitionedHypergraph>
+void checkDelta(const PartitionedHypergraph& partitioned_hg,
+                const HypergraphDelta& delta,
+                const vec<HypernodeID>& mapping) {
+  for ( const HyperedgeID& he : delta.removed_edges ) {
+    if ( he >= partitioned_hg.initialNumEdges() ) {
+      throw InvalidInputException("Removed hyperedge " + STR(he) + " does not exist");
+    }
+  }
+  if ( !delta.added_edge_weights.empty() &&
+       delta.added_edge_weights.size() != delta.added_edges.size() ) {
+    throw InvalidInputException("Number of added hyperedge weights does not match number of added hyperedges");
+  }
+  for ( const vec<HypernodeID>& pins : delta.added_edges ) {
+    if ( PartitionedHypergraph::is_graph && ( pins.size() != 2 || pins[0] == pins[1] ) ) {
+      throw InvalidInputException("Added edges of a graph must connect exactly two different nodes");
+    }
+    for ( const HypernodeID& pin : pins ) {
+      if ( pin >= mapping.size() || mapping[pin] == kInvalidHypernode ) {
+        throw InvalidInputException("Added hyperedge contains invalid or removed node " + STR(pin));
+      }
+    }
+  }
+}
+
+}  // namespace
+
+template<typename TypeTraits>
+vec<HypernodeID> IncrementalRepartitioner<TypeTraits>::nodeMapping(const PartitionedHypergraph& partitioned_hg,
+                                                                   const HypergraphDelta& delta) {
+  const HypernodeID num_nodes = partitioned_hg.initialNumNodes();
+  vec<HypernodeID> mapping(num_nodes + delta.added_node_weights.size(), 0);
+  for ( const HypernodeID& hn : delta.removed_nodes ) {
+    if ( hn >= num_nodes ) {
+      throw InvalidInputException("Removed node " + STR(hn) + " does not exist");
+    }
+    if ( mapping[hn] == kInvalidHypernode ) {
+      throw InvalidInputException("Node " + STR(hn) + " is removed more than once");
+    }
+    mapping[hn] = kInvalidHypernode;
+  }
+  HypernodeID next_id = 0;
+  for ( HypernodeID& id : mapping ) {
+    if ( id != kInvalidHypernode ) {
+      id = next_id++;
+    }
+  }
+  return mapping;
+}
+
+template<typename TypeTraits>
+typename TypeTraits::Hypergraph IncrementalRepartitioner<TypeTraits>::applyDelta(const PartitionedHypergraph& partitioned_hg,
+                                                                                 const HypergraphDelta& delta) {
+  const vec<HypernodeID> mapping = nodeMapping(partitioned_hg, delta);
+  checkDelta(partitioned_hg, delta, mapping);
+  const HypernodeID num_original_nodes = partitioned_hg.initialNumNodes();
+  const HypernodeID num_nodes = mapping.size() - delta.removed_nodes.size();
+
+  vec<HypernodeWeight> node_weights(num_nodes, 0);
+  tbb_kahypar::parallel_for(ID(0), num_original_nodes, [&](const HypernodeID hn) {
+    if ( mapping[hn] != kInvalidHypernode ) {
+      node_weights[mapping[hn]] = partitioned_hg.nodeWeight(hn);
+    }
+  });
+  for ( size_t i = 0; i < delta.added_node_weights.size(); ++i ) {
+    node_weights[mapping[num_original_nodes + i]] = delta.added_node_weights[i];
+  }
+
+  // For graphs, the removed edges are marked via their unique (undirected) edge ID
+  vec<bool> is_removed(partitioned_hg.initialNumEdges(), false);
+  for ( const HyperedgeID& he : delta.removed_edges ) {
+    if constexpr ( PartitionedHypergraph::is_graph ) {
+      is_removed[partitioned_hg.uniqueEdgeID(he)] = true;
+    } else {
+      is_removed[he] = true;
+    }
+  }
+
+  // Count the remaining pins of each hyperedge that is kept. For graphs, each
+  // undirected edge is only considered via its direction with source < target.
+  const HyperedgeID num_original_edges = partitioned_hg.initialNumEdges();
+  vec<size_t> num_kept_pins(num_original_edges + 1, 0);
+  partitioned_hg.doParallelForAllEdges([&](const HyperedgeID& he) {
+    if constexpr ( PartitionedHypergraph::is_graph ) {
+      const HypernodeID source = partitioned_hg.edgeSource(he);
+      const HypernodeID target = partitioned_hg.edgeTarget(he);
+      if ( source < target && !is_removed[partitioned_hg.uniqueEdgeID(he)] &&
+           mapping[source] != kInvalidHypernode && mapping[target] != kInvalidHypernode ) {
+        num_kept_pins[he + 1] = 2;
+      }
+    } else if ( !is_removed[he] ) {
+      for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
+        num_kept_pins[he + 1] += mapping[pin] != kInvalidHypernode;
+      }
+    }
+  });
+  vec<HyperedgeID> kept_edge_id(num_original_edges + 1, 0);
+  tbb_kahypar::parallel_for(ID(0), num_original_edges, [&](const HyperedgeID he) {
+    kept_edge_id[he + 1] = num_kept_pins[he + 1] > 0;
+  });
+  tbb_kahypar::parallel_invoke([&] {
+    parallel_prefix_sum(num_kept_pins.begin(), num_kept_pins.end(),
+      num_kept_pins.begin(), std::plus<>(), UL(0));
+  }, [&] {
+    parallel_prefix_sum(kept_edge_id.begin(), kept_edge_id.end(),
+      kept_edge_id.begin(), std::plus<>(), ID(0));
+  });
+
+  // Write the adjacency array of the updated hypergraph: the kept hyperedges in
+  // their original order followed by the added hyperedges
+  const HyperedgeID num_kept_edges = kept_edge_id[num_original_edges];
+  const HyperedgeID num_edges = num_kept_edges + delta.added_edges.size();
+  vec<size_t> edge_indices(num_edges + 1, 0);
+  vec<HypernodeID> pins(num_kept_pins[num_original_edges], kInvalidHypernode);
+  vec<HyperedgeWeight> edge_weights(num_edges, 0);
+  tbb_kahypar::parallel_for(ID(0), num_original_edges, [&](const HyperedgeID he) {
+    if ( num_kept_pins[he + 1] > num_kept_pins[he] ) {
+      const HyperedgeID id = kept_edge_id[he];
+      size_t pos = num_kept_pins[he];
+      edge_indices[id] = pos;
+      edge_weights[id] = partitioned_hg.edgeWeight(he);
+      if constexpr ( PartitionedHypergraph::is_graph ) {
+        pins[pos] = mapping[partitioned_hg.edgeSource(he)];
+        pins[pos + 1] = mapping[partitioned_hg.edgeTarget(he)];
+      } else {
+        for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
+          if ( mapping[pin] != kInvalidHypernode ) {
+            pins[pos++] = mapping[pin];
+          }
+        }
+      }
+    }
+  });
+  edge_indices[num_kept_edges] = pins.size();
+  for ( size_t i = 0; i < delta.added_edges.size(); ++i ) {
+    for ( const HypernodeID& pin : delta.added_edges[i] ) {
+      pins.push_back(mapping[pin]);
+    }
+    edge_indices[num_kept_edges + i + 1] = pins.size();
+    edge_weights[num_kept_edges + i] = delta.added_edge_weights.empty() ? 1 : delta.added_edge_weights[i];
+  }
+
+  if constexpr ( Hypergraph::is_static_hypergraph ) {
+    return Hypergraph::Factory::construct_from_csr(num_nodes, num_edges,
+      edge_indices.data(), pins.data(), edge_weights.data(), node_weights.data());
+  } else {
+    // The dynamic factories expect one vector per hyperedge
+    vec<vec<HypernodeID>> edge_vector(num_edges);
+    tbb_kahypar::parallel_for(ID(0), num_edges, [&](const HyperedgeID he) {
+      edge_vector[he].assign(pins.begin() + edge_indices[he], pins.begin() + edge_indices[he + 1]);
+    });
+    return Hypergraph::Factory::construct(num_nodes, num_edges,
+      edge_vector, edge_weights.data(), node_weights.data());
+  }
+}
+
+template<typename TypeTraits>
+typename TypeTraits::PartitionedHypergraph IncrementalRepartitioner<TypeTraits>::repartition(const PartitionedHypergraph& partitioned_hg,
+                                                                                            const HypergraphDelta& delta,
+                                                                                            Hypergraph& updated_hg,
+                                                                                            Context& context) {
+  if ( context.partition.k != partitioned_hg.k() ) {
+    throw InvalidInputException("Number of blocks of the context does not match the number of blocks of the partition");
+  }
+  if ( partitioned_hg.hasFixedVertices() ) {
+    throw UnsupportedOperationException("Incremental repartitioning does not support fixed vertices");
+  }
+  if ( context.partition.objective == Objective::steiner_tree ) {
+    throw UnsupportedOperationException("Incremental repartitioning does not support mappings onto target graphs");
+  }
+
+  utils::Utilities::instance().getTimeLimit(context.utility_id).start(context.partition.time_limit);
+  context.sanityCheck(nullptr);
+  context.setupPartWeights(updated_hg.totalWeight());
+
+  const PartitionID k = context.partition.k;
+  const HypernodeID num_original_nodes = partitioned_hg.initialNumNodes();
+  const vec<HypernodeID> mapping = nodeMapping(partitioned_hg, delta);
+  ASSERT(mapping.size() - delta.removed_nodes.size() == updated_hg.initialNumNodes());
+
+  // Project the partition of the remaining nodes onto the updated hypergraph
+  vec<PartitionID> part(updated_hg.initialNumNodes(), kInvalidPartition);
+  vec<HypernodeWeight> part_weights(k, 0);
+  for ( HypernodeID hn = 0; hn < num_original_nodes; ++hn ) {
+    if ( mapping[hn] != kInvalidHypernode ) {
+      part[mapping[hn]] = partitioned_hg.partID(hn);
+      part_weights[part[mapping[hn]]] += updated_hg.nodeWeight(mapping[hn]);
+    }
+  }
+
+  // Collect all nodes in the modified region, which serve as seeds for the localized refinement
+  vec<HypernodeID> refinement_nodes;
+  vec<bool> is_refinement_node(updated_hg.initialNumNodes(), false);
+  auto add_refinement_node = [&](const HypernodeID original_id) {
+    const HypernodeID hn = mapping[original_id];
+    if ( hn != kInvalidHypernode && !is_refinement_node[hn] ) {
+      is_refinement_node[hn] = true;
+      refinement_nodes.push_back(hn);
+    }
+  };
+  for ( const HyperedgeID& he : delta.removed_edges ) {
+    for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
+      add_refinement_node(pin);
+    }
+  }
+  for ( const HypernodeID& hn : delta.removed_nodes ) {
+    for ( const HyperedgeID& he : partitioned_hg.incidentEdges(hn) ) {
+      for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
+        add_refinement_node(pin);
+      }
+    }
+  }
+  for ( const vec<HypernodeID>& pins : delta.added_edges ) {
+    for ( const HypernodeID& pin : pins ) {
+      add_refinement_node(pin);
+    }
+  }
+
+  // Assign each added node to the block to which it has the strongest connection
+  // and that can accommodate its weight (or to the lightest block otherwise)
+  vec<HyperedgeWeight> connectivity(k, 0);
+  vec<bool> contains_block(k, false);
+  vec<PartitionID> blocks_of_edge;
+  for ( size_t i = 0; i < delta.added_node_weights.size(); ++i ) {
+    const HypernodeID hn = mapping[num_original_nodes + i];
+    add_refinement_node(num_original_nodes + i);
+    std::fill(connectivity.begin(), connectivity.end(), 0);
+    for ( const HyperedgeID& he : updated_hg.incidentEdges(hn) ) {
+      for ( const HypernodeID& pin : updated_hg.pins(he) ) {
+        const PartitionID block = part[pin];
+        if ( block != kInvalidPartition && !contains_block[block] ) {
+          contains_block[block] = true;
+          blocks_of_edge.push_back(block);
+          connectivity[block] += updated_hg.edgeWeight(he);
+        }
+      }
+      for ( const PartitionID& block : blocks_of_edge ) {
+        contains_block[block] = false;
+      }
+      blocks_of_edge.clear();
+    }
+
+    const HypernodeWeight weight = updated_hg.nodeWeight(hn);
+    PartitionID best_block = kInvalidPartition;
+    PartitionID lightest_block = 0;
+    for ( PartitionID block = 0; block < k; ++block ) {
+      if ( part_weights[block] < part_weights[lightest_block] ) {
+        lightest_block = block;
+      }
+      if ( part_weights[block] + weight <= context.partition.max_part_weights[block] &&
+           ( best_block == kInvalidPartition || connectivity[block] > connectivity[best_block] ||
+             ( connectivity[block] == connectivity[best_block] &&
+               part_weights[block] < part_weights[best_block] ) ) ) {
+        best_block = block;
+      }
+    }
+    part[hn] = best_block != kInvalidPartition ? best_block : lightest_block;
+    part_weights[part[hn]] += weight;
+  }
+
+  PartitionedHypergraph updated_phg(k, updated_hg, parallel_tag_t { });
+  tbb_kahypar::parallel_for(ID(0), updated_hg.initialNumNodes(), [&](const HypernodeID& hn) {
+    updated_phg.setOnlyNodePart(hn, part[hn]);
+  });
+  updated_phg.initializePartition();
+
+  // Repair quality and balance with localized refinement around the modified region
+  Metrics current_metrics = { metrics::quality(updated_phg, context), metrics::imbalance(updated_phg, context) };
+  gain_cache_t gain_cache = GainCachePtr::constructGainCache(context);
+  {
+    std::unique_ptr<IRebalancer> rebalancer(RebalancerFactory::getInstance().createObject(
+      context.refinement.rebalancer, updated_hg.initialNumNodes(), context, gain_cache));
+    std::unique_ptr<IRefiner> label_propagation(LabelPropagationFactory::getInstance().createObject(
+      context.refinement.label_propagation.algorithm,
+      updated_hg.initialNumNodes(), updated_hg.initialNumEdges(), context, gain_cache, *rebalancer));
+    std::unique_ptr<IRefiner> fm(FMFactory::getInstance().createObject(
+      context.refinement.fm.algorithm,
+      updated_hg.initialNumNodes(), updated_hg.initialNumEdges(), context, gain_cache, *rebalancer));
+
+    mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(updated_phg);
+    rebalancer->initialize(phg);
+    label_propagation->initialize(phg);
+    fm->initialize(phg);
+
+    bool improvement_found = !refinement_nodes.empty();
+    while ( improvement_found ) {
+      improvement_found = false;
+      if ( context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing ) {
+        improvement_found |= label_propagation->refine(phg,
+          refinement_nodes, current_metrics, std::numeric_limits<double>::max());
+      }
+      if ( context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+        improvement_found |= fm->refine(phg,
+          refinement_nodes, current_metrics, std::numeric_limits<double>::max());
+      }
+      if ( !context.refinement.refine_until_no_improvement ) {
+        break;
+      }
+    }
+
+    if ( !metrics::isBalanced(updated_phg, context) ) {
+      rebalancer->refine(phg, {}, current_metrics, 0.0);
+    }
+  }
+  GainCachePtr::deleteGainCache(gain_cache);
+
+  ASSERT(current_metrics.quality == metrics::quality(updated_phg, context));
+  return updated_phg;
+}
+
+INSTANTIATE_CLASS_WITH_TYPE_TRAITS(IncrementalRepartitioner)
+
+}  // namespace mt_kahypar
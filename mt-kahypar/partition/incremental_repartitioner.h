@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+
+// ! Describes a small modification of a (hyper)graph. Pins of added hyperedges
+// ! refer to node IDs of the original hypergraph, and the i-th added node has ID
+// ! 'initialNumNodes() + i'. For graphs, each added hyperedge must contain
+// ! exactly two nodes and removing one direction of an edge removes both.
+struct HypergraphDelta {
+  vec<HypernodeID> removed_nodes;
+  vec<HyperedgeID> removed_edges;
+  vec<HypernodeWeight> added_node_weights;
+  vec<vec<HypernodeID>> added_edges;
+  vec<HyperedgeWeight> added_edge_weights;
+};
+
+template<typename TypeTraits>
+class IncrementalRepartitioner {
+
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+
+ public:
+  // ! Maps each node of the original hypergraph to its ID in the updated hypergraph
+  // ! (kInvalidHypernode for removed nodes). The remaining nodes keep their relative
+  // ! order and the added nodes are appended to them.
+  static vec<HypernodeID> nodeMapping(const PartitionedHypergraph& partitioned_hg,
+                                      const HypergraphDelta& delta);
+
+  // ! Constructs the hypergraph that results from applying the delta
+  static Hypergraph applyDelta(const PartitionedHypergraph& partitioned_hg,
+                               const HypergraphDelta& delta);
+
+  // ! Projects the partition onto the updated hypergraph, assigns the added nodes
+  // ! greedily to their most connected block and repairs quality and balance with
+  // ! label propagation and FM searches seeded only from the modified region.
+  static PartitionedHypergraph repartition(const PartitionedHypergraph& partitioned_hg,
+                                           const HypergraphDelta& delta,
+                                           Hypergraph& updated_hg,
+                                           Context& context);
+};
+
+}  // namespace mt_kahypar
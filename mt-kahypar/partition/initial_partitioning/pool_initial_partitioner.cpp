@@ -34,12 +34,13 @@
 #include "mt-kahypar/partition/initial_partitioning/initial_partitioning_data_container.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/exception.h"
+#include "mt-kahypar/utils/utilities.h"
 
 namespace mt_kahypar {
 
 namespace {
-// IP algorithm and random seed
-using IPTask = std::tuple<InitialPartitioningAlgorithm, int, int>;
+// IP algorithm, random seed, tag and run
+using IPTask = std::tuple<InitialPartitioningAlgorithm, int, int, size_t>;
 }
 
 template<typename TypeTraits>
@@ -53,6 +54,11 @@ void Pool<TypeTraits>::bipartition(PartitionedHypergraph& hypergraph,
       "Size of enabled IP algorithms vector is smaller than number of IP algorithms!");
   }
 
+  // If the time limit is (almost) exceeded, we only perform one run per algorithm
+  const utils::TimeLimit& time_limit = utils::Utilities::instance().getTimeLimit(context.utility_id);
+  const size_t runs = time_limit.exceeded(utils::TimeLimit::INITIAL_PARTITIONING_SHARE) ?
+    std::min(context.initial_partitioning.runs, UL(1)) : context.initial_partitioning.runs;
+
   int tag = 0;
   std::mt19937 rng(context.partition.seed);
   vec<IPTask> _ip_task_lists;
@@ -60,10 +66,10 @@ void Pool<TypeTraits>::bipartition(PartitionedHypergraph& hypergraph,
   for ( uint8_t i = 0; i < static_cast<uint8_t>(InitialPartitioningAlgorithm::UNDEFINED); ++i ) {
     if ( context.initial_partitioning.enabled_ip_algos[i] ) {
       auto algorithm = static_cast<InitialPartitioningAlgorithm>(i);
-      for ( size_t j = 0; j < context.initial_partitioning.runs; ++j ) {
+      for ( size_t j = 0; j < runs; ++j ) {
         // Each initial partitioning algorithm is assigned a seed and a tag
         // for deterministic behavior when partitioning in deterministic mode.
-        _ip_task_lists.emplace_back(algorithm, rng(), tag++);
+        _ip_task_lists.emplace_back(algorithm, rng(), tag++, j);
       }
     }
   }
@@ -74,18 +80,29 @@ void Pool<TypeTraits>::bipartition(PartitionedHypergraph& hypergraph,
   tbb_kahypar::task_group tg;
   InitialPartitioningDataContainer<TypeTraits> ip_data(hypergraph, context);
   ip_data_container_t* ip_data_ptr = ip::to_pointer(ip_data);
-  for ( const auto& ip_task : _ip_task_lists ) {
+  for ( size_t i = 0; i < _ip_task_lists.size(); ++i ) {
+    // If the partitioning run is cancelled, a single initial partition suffices
+    if ( i > 0 && time_limit.isCancelled() ) {
+      break;
+    }
+    const auto& ip_task = _ip_task_lists[i];
     const InitialPartitioningAlgorithm algorithm = std::get<0>(ip_task);
     const int seed = std::get<1>(ip_task);
     const int tag = std::get<2>(ip_task);
+    const size_t run = std::get<3>(ip_task);
     if ( run_parallel ) {
-      tg.run([&, algorithm, seed, tag] {
+      tg.run([&, algorithm, seed, tag, run, i] {
+        // Skip additional runs if the time limit is exceeded, but always
+        // keep the first run of each algorithm.
+        if ( ( run > 0 && time_limit.exceeded() ) || ( i > 0 && time_limit.isCancelled() ) ) {
+          return;
+        }
         std::unique_ptr<IInitialPartitioner> initial_partitioner =
           InitialPartitionerFactory::getInstance().createObject(
             algorithm, algorithm, ip_data_ptr, context, seed, tag);
         initial_partitioner->partition();
       });
-    } else {
+    } else if ( run == 0 || !time_limit.exceeded() ) {
       std::unique_ptr<IInitialPartitioner> initial_partitioner =
         InitialPartitionerFactory::getInstance().createObject(
           algorithm, algorithm, ip_data_ptr, context, seed, tag);
@@ -26,14 +26,51 @@
 
 #include "mt-kahypar/partition/mapping/all_pair_shortest_path.h"
 
+#include <cmath>
+#include <queue>
+
+#include <tbb_kahypar/parallel_for.h>
+#include <tbb_kahypar/enumerable_thread_specific.h>
+
 namespace mt_kahypar {
 
 namespace {
+using PQElement = std::pair<HyperedgeWeight, HypernodeID>;
+using PQ = std::priority_queue<PQElement, vec<PQElement>, std::greater<PQElement>>;
+
 MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t index(
   const HypernodeID u, const HypernodeID v, const HypernodeID n) {
   ASSERT(u < n && v < n);
   return u + v * n;
 }
+
+// ! Dijkstra's algorithm from a single source. The target graph is undirected,
+// ! so we store the distances to the source in its (contiguous) column.
+void dijkstra(const ds::StaticGraph& graph,
+              const HypernodeID source,
+              vec<HyperedgeWeight>& distances,
+              PQ& pq) {
+  const HypernodeID n = graph.initialNumNodes();
+  HyperedgeWeight* dist = distances.data() + index(0, source, n);
+  dist[source] = 0;
+  pq.push(std::make_pair(0, source));
+  while ( !pq.empty() ) {
+    const HyperedgeWeight d = pq.top().first;
+    const HypernodeID u = pq.top().second;
+    pq.pop();
+    if ( d > dist[u] ) {
+      continue;
+    }
+    for ( const HyperedgeID& e : graph.incidentEdges(u) ) {
+      const HypernodeID v = graph.edgeTarget(e);
+      const HyperedgeWeight d_v = d + graph.edgeWeight(e);
+      if ( d_v < dist[v] ) {
+        dist[v] = d_v;
+        pq.push(std::make_pair(d_v, v));
+      }
+    }
+  }
+}
 } // namespace
 
 void AllPairShortestPath::compute(const ds::StaticGraph& graph,
@@ -41,6 +78,17 @@ void AllPairShortestPath::compute(const ds::StaticGraph& graph,
   const HypernodeID n = graph.initialNumNodes();
   ASSERT(static_cast<size_t>(n * n) <= distances.size());
 
+  // Dijkstra from each source takes O(n * m * log(n)) time, which is
+  // faster than Floyd's algorithm on sparse target graphs
+  const double log_n = std::max(std::log2(static_cast<double>(n)), 1.0);
+  if ( static_cast<double>(graph.initialNumEdges()) * log_n < static_cast<double>(n) * n ) {
+    tbb_kahypar::enumerable_thread_specific<PQ> local_pq;
+    tbb_kahypar::parallel_for(ID(0), n, [&](const HypernodeID source) {
+      dijkstra(graph, source, distances, local_pq.local());
+    });
+    return;
+  }
+
   // Initialize Distance Matrix
   for ( const HypernodeID& u : graph.nodes() ) {
     distances[index(u, u, n)] = 0;
@@ -48,17 +96,22 @@ void AllPairShortestPath::compute(const ds::StaticGraph& graph,
   for ( const HyperedgeID& e : graph.edges() ) {
     const HypernodeID u = graph.edgeSource(e);
     const HypernodeID v = graph.edgeTarget(e);
-    distances[index(u, v, n)] = graph.edgeWeight(e);
+    distances[index(u, v, n)] = std::min(distances[index(u, v, n)], graph.edgeWeight(e));
   }
 
-  // Floyd Algorithm to compute all shortest paths (O(n^3))
+  // Floyd Algorithm to compute all shortest paths (O(n^3)). In round k, column k
+  // does not change, so the remaining columns can be updated in parallel.
   for ( HypernodeID k = 0;  k < n; ++k) {
-    for ( HypernodeID u = 0; u < n; ++u ) {
-      for ( HypernodeID v = 0; v < n; ++v ) {
-        distances[index(u, v, n)] = std::min(distances[index(u, v, n)],
-          distances[index(u, k, n)] + distances[index(k, v, n)]);
+    const HyperedgeWeight* column_k = distances.data() + index(0, k, n);
+    tbb_kahypar::parallel_for(ID(0), n, [&](const HypernodeID v) {
+      if ( v != k ) {
+        HyperedgeWeight* column_v = distances.data() + index(0, v, n);
+        const HyperedgeWeight dist_kv = column_v[k];
+        for ( HypernodeID u = 0; u < n; ++u ) {
+          column_v[u] = std::min(column_v[u], column_k[u] + dist_kv);
+        }
       }
-    }
+    });
   }
 }
 
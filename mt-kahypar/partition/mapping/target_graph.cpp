@@ -42,19 +42,42 @@ void TargetGraph::precomputeDistances(const size_t max_connectivity) {
     throw InvalidInputException("Target graph must be connected, but it is not.");
   }
 
-  const size_t num_entries = std::pow(_k, max_connectivity);
+  // Steiner trees of larger connectivity sets are approximated on demand
+  const size_t connectivity = maxFeasibleConnectivity(_k, max_connectivity);
+  const size_t num_entries = std::pow(_k, connectivity);
   if ( num_entries > MEMORY_LIMIT ) {
     throw SystemException(
       "Too much memory requested for precomputing steiner trees "
       "of connectivity sets in the target graph.");
   }
   _distances.assign(num_entries, kInvalidDistance);
-  SteinerTree::compute(_graph, max_connectivity, _distances);
+  SteinerTree::compute(_graph, connectivity, _distances);
 
-  _max_precomputed_connectitivty = max_connectivity;
+  _max_precomputed_connectitivty = connectivity;
   _is_initialized = true;
 }
 
+/**
+ * The precomputation stores k^m distances and its running time is dominated by
+ * \sum_{i = 2 to m - 1} binomial(k, i) * k * ( 2^i * i + k * i ) (see SteinerTree::compute(...)).
+ * Shortest paths (m = 2) are always precomputed.
+ */
+size_t TargetGraph::maxFeasibleConnectivity(const PartitionID k, const size_t max_connectivity) {
+  size_t connectivity = 2;
+  double work = 0.0;
+  double binomial = static_cast<double>(k) * (k - 1) / 2.0;
+  while ( connectivity < std::min(max_connectivity, static_cast<size_t>(k)) ) {
+    const double i = connectivity;
+    work += binomial * k * ( std::pow(2.0, i) * i + static_cast<double>(k) * i );
+    if ( std::pow(static_cast<double>(k), i + 1) > MEMORY_LIMIT || work > WORK_LIMIT ) {
+      break;
+    }
+    binomial *= static_cast<double>(k - connectivity) / (i + 1);
+    ++connectivity;
+  }
+  return connectivity;
+}
+
 HyperedgeWeight TargetGraph::distance(const ds::StaticBitset& connectivity_set) const {
   const PartitionID connectivity = connectivity_set.popcount();
   if ( likely(connectivity <= _max_precomputed_connectitivty) ) {
@@ -65,6 +88,11 @@ HyperedgeWeight TargetGraph::distance(const ds::StaticBitset& connectivity_set)
     return _distances[idx];
   } else {
     const uint64_t hash_key = computeHash(connectivity_set);
+    if ( hash_key == kInvalidHashKey ) {
+      // Connectivity set has no unique key => Compute 2-approximation without caching
+      if constexpr ( TRACK_STATS ) ++_stats.cache_misses;
+      return computeWeightOfMSTOnMetricCompletion(connectivity_set);
+    }
     // We have not precomputed the optimal steiner tree for the connectivity set.
     #ifdef KAHYPAR_USE_GROWT
     HashTableHandle& handle = _handles.local();
@@ -58,6 +58,7 @@
 #include "mt-kahypar/datastructures/static_graph.h"
 #include "mt-kahypar/datastructures/static_bitset.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/bit_ops.h"
 
 namespace mt_kahypar {
 
@@ -65,8 +66,13 @@ namespace mt_kahypar {
 class TargetGraph {
 
   static constexpr HyperedgeWeight kInvalidDistance = std::numeric_limits<HyperedgeWeight>::max() / 3;
+  static constexpr uint64_t kInvalidHashKey = std::numeric_limits<uint64_t>::max();
   static constexpr size_t INITIAL_HASH_TABLE_CAPACITY = 100000;
   static constexpr size_t MEMORY_LIMIT = 100000000;
+  // ! Maximum (estimated) number of operations for precomputing steiner trees
+  static constexpr double WORK_LIMIT = 1e9;
+  // ! Number of bits of a hash key that encode block IDs if k > 64
+  static constexpr size_t HASH_KEY_BITS = 62;
 
   using PQElement = std::pair<HyperedgeWeight, PartitionID>;
   using PQ = std::priority_queue<PQElement, vec<PQElement>, std::greater<PQElement>>;
@@ -109,6 +115,7 @@ class TargetGraph {
   explicit TargetGraph(ds::StaticGraph&& graph) :
     _is_initialized(false),
     _k(graph.initialNumNodes()),
+    _bits_per_block(_k > 64 ? utils::highest_set_bit_64(UL(_k)) + 1 : 0),
     _graph(std::move(graph)),
     _max_precomputed_connectitivty(0),
     _distances(),
@@ -137,10 +144,21 @@ class TargetGraph {
     return _graph;
   }
 
+  // ! Maximum size of the connectivity sets with precomputed optimal steiner trees
+  PartitionID maxPrecomputedConnectivity() const {
+    return _max_precomputed_connectitivty;
+  }
+
   // ! This function computes the weight of all steiner trees for all
-  // ! connectivity sets with connectivity at most m (:= max_connectivity),
+  // ! connectivity sets with connectivity at most m (:= max_connectivity).
+  // ! For large target graphs, m is reduced such that the precomputation
+  // ! stays within the memory and work limits (see maxFeasibleConnectivity(...)).
   void precomputeDistances(const size_t max_conectivity);
 
+  // ! Largest connectivity at most max_connectivity for which all optimal
+  // ! steiner trees can be precomputed on a target graph with k nodes
+  static size_t maxFeasibleConnectivity(const PartitionID k, const size_t max_connectivity);
+
   // ! Returns the weight of the optimal steiner tree between all blocks
   // ! in the connectivity set if precomputed. Otherwise, we compute
   // ! a 2-approximation of the optimal steiner tree
@@ -242,11 +260,26 @@ class TargetGraph {
       (multiplier == UL(_k) ? last_block * _k : 0) : 0;
   }
 
+  // ! Returns a unique key for the connectivity set. For k <= 64, the key is the bitset itself.
+  // ! Otherwise, we concatenate the block IDs (plus one) with _bits_per_block bits each, which
+  // ! is only possible for small connectivity sets. In that case, kInvalidHashKey is returned.
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE uint64_t computeHash(const ds::StaticBitset& connectivity_set) const {
     uint64_t index = 0;
-    for ( const PartitionID block : connectivity_set ) {
-      ASSERT(block != kInvalidPartition && block < _k && block < 64);
-      index |= (static_cast<uint64_t>(1) << block);
+    if ( _bits_per_block == 0 ) {
+      for ( const PartitionID block : connectivity_set ) {
+        ASSERT(block != kInvalidPartition && block < _k && block < 64);
+        index |= (static_cast<uint64_t>(1) << block);
+      }
+    } else {
+      size_t used_bits = 0;
+      for ( const PartitionID block : connectivity_set ) {
+        ASSERT(block != kInvalidPartition && block < _k);
+        used_bits += _bits_per_block;
+        if ( used_bits > HASH_KEY_BITS ) {
+          return kInvalidHashKey;
+        }
+        index = (index << _bits_per_block) | static_cast<uint64_t>(block + 1);
+      }
     }
     return index;
   }
@@ -270,6 +303,9 @@ class TargetGraph {
   // ! Number of blocks
   PartitionID _k;
 
+  // ! Number of bits per block in a hash key (zero if the key is a bitset)
+  size_t _bits_per_block;
+
   // ! Graph data structure representing the target graph
   ds::StaticGraph _graph;
 
@@ -316,8 +352,16 @@ class TargetGraph {
     return false;
   }
 
+  PartitionID maxPrecomputedConnectivity() const {
+    return 0;
+  }
+
   void precomputeDistances(const size_t) { }
 
+  static size_t maxFeasibleConnectivity(const PartitionID, const size_t) {
+    return 0;
+  }
+
   HyperedgeWeight distance(const ds::StaticBitset&) const {
     return 0;
   }
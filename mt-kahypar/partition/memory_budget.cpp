@@ -0,0 +1,292 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "memory_budget.h"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/sparse_pin_counts.h"
+#include "mt-kahypar/datastructures/pin_count_in_part.h"
+#include "mt-kahypar/datastructures/connectivity_set.h"
+#include "mt-kahypar/partition/refinement/gains/gain_cache_table.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/exception.h"
+
+namespace mt_kahypar {
+
+  namespace {
+    // Approximate number of bytes per pin of a flow problem (flow network,
+    // incidence arrays and the mapping to the original hypergraph)
+    static constexpr size_t FLOW_NETWORK_BYTES_PER_PIN = 48;
+
+    static constexpr size_t BYTES_PER_MB = 1000UL * 1000UL;
+
+    struct Phase {
+      explicit Phase(const std::string& name) :
+        name(name),
+        size_in_bytes(0),
+        data_structures() { }
+
+      void add(const std::string& data_structure, const size_t num_elements, const size_t element_size) {
+        const size_t size = num_elements * element_size;
+        size_in_bytes += size;
+        data_structures.emplace_back(data_structure, size);
+      }
+
+      std::string name;
+      size_t size_in_bytes;
+      std::vector<std::pair<std::string, size_t>> data_structures;
+    };
+
+    template<typename Hypergraph>
+    size_t size_of_hypergraph(const Hypergraph& hypergraph) {
+      const size_t num_hypernodes = hypergraph.initialNumNodes();
+      const size_t num_hyperedges = hypergraph.initialNumEdges();
+      const size_t num_pins = hypergraph.initialNumPins();
+      size_t size = num_hypernodes * (Hypergraph::SIZE_OF_HYPERNODE + sizeof(PartitionID) /* community ids */) +
+                    num_hyperedges * Hypergraph::SIZE_OF_HYPEREDGE;
+      if ( !Hypergraph::is_graph ) {
+        // incidence array and incident nets
+        size += num_pins * (sizeof(HypernodeID) + sizeof(HyperedgeID));
+      }
+      return size;
+    }
+
+    bool uses_sparse_connectivity_information(const Context& context) {
+      return context.partition.preset_type == PresetType::large_k ||
+        context.partition.partition_type == LARGE_K_PARTITIONING;
+    }
+
+    std::string to_megabytes(const size_t size_in_bytes) {
+      std::stringstream ss;
+      ss << (size_in_bytes + BYTES_PER_MB - 1) / BYTES_PER_MB << " MB";
+      return ss.str();
+    }
+  }
+
+  size_t estimate_peak_memory(const mt_kahypar_hypergraph_t hypergraph,
+                              const Context& context,
+                              utils::MemoryTreeNode& estimate) {
+    if ( hypergraph.type == STATIC_GRAPH ) {
+      return estimate_peak_memory(utils::cast_const<ds::StaticGraph>(hypergraph), context, estimate);
+    } else if ( hypergraph.type == DYNAMIC_GRAPH ) {
+      return estimate_peak_memory(utils::cast_const<ds::DynamicGraph>(hypergraph), context, estimate);
+    } else if ( hypergraph.type == STATIC_HYPERGRAPH ) {
+      return estimate_peak_memory(utils::cast_const<ds::StaticHypergraph>(hypergraph), context, estimate);
+    } else if ( hypergraph.type == DYNAMIC_HYPERGRAPH ) {
+      return estimate_peak_memory(utils::cast_const<ds::DynamicHypergraph>(hypergraph), context, estimate);
+    }
+    return 0;
+  }
+
+  template<typename Hypergraph>
+  size_t estimate_peak_memory(const Hypergraph& hypergraph,
+                              const Context& context,
+                              utils::MemoryTreeNode& estimate) {
+    const size_t num_hypernodes = hypergraph.initialNumNodes();
+    const size_t num_hyperedges = hypergraph.initialNumEdges();
+    const size_t num_pins = hypergraph.initialNumPins();
+    const size_t k = context.partition.k;
+
+    // The input hypergraph and the coarsening hierarchy are alive during the whole
+    // multilevel cycle. We assume that each level halves the size of its hypergraph
+    // such that the hierarchy is roughly as large as the input hypergraph.
+    const size_t input_size = size_of_hypergraph(hypergraph);
+    estimate.addChild("Input Hypergraph", input_size);
+    estimate.addChild("Coarsening Hierarchy", input_size + 2 * num_hypernodes * sizeof(HypernodeID));
+    if ( Hypergraph::is_static_hypergraph && context.preprocessing.node_ordering != NodeOrdering::none ) {
+      // The node reordering keeps the original hypergraph alive until the partition is restored
+      estimate.addChild("Original Hypergraph (Node Reordering)",
+        input_size + num_hypernodes * sizeof(HypernodeID));
+    }
+
+    // ########## Preprocessing Memory ##########
+    Phase preprocessing("Preprocessing");
+    if ( context.preprocessing.use_community_detection ) {
+      const bool is_graph = hypergraph.maxEdgeSize() == 2;
+      const size_t num_star_expansion_nodes = num_hypernodes + (is_graph ? 0 : num_hyperedges);
+      const size_t num_star_expansion_edges = is_graph ? num_pins : (2UL * num_pins);
+      preprocessing.add("Louvain Graph", num_star_expansion_nodes + 1, sizeof(size_t));
+      preprocessing.add("Louvain Arcs", num_star_expansion_edges, sizeof(Arc));
+      preprocessing.add("Louvain Node Volumes", num_star_expansion_nodes, sizeof(ArcWeight));
+      // Louvain contracts the graph into a second copy of it (unless low-memory contraction is used)
+      preprocessing.add("Louvain Coarse Graph", num_star_expansion_nodes + 1, sizeof(size_t));
+      preprocessing.add("Louvain Coarse Arcs", num_star_expansion_edges, sizeof(Arc));
+      if ( !context.preprocessing.community_detection.low_memory_contraction ) {
+        preprocessing.add("Louvain Contraction Buffers", num_star_expansion_nodes,
+          2 * sizeof(parallel::IntegralAtomicWrapper<size_t>) + sizeof(parallel::AtomicWrapper<ArcWeight>));
+        preprocessing.add("Louvain Contraction Arcs", num_star_expansion_edges, sizeof(Arc) + sizeof(size_t));
+      }
+    }
+
+    // ########## Coarsening Memory ##########
+    Phase coarsening("Coarsening");
+    coarsening.add("Clustering", num_hypernodes, sizeof(HypernodeID) + sizeof(HypernodeWeight));
+    if ( Hypergraph::is_graph ) {
+      coarsening.add("Contraction Buffers (Nodes)", num_hypernodes,
+        Hypergraph::SIZE_OF_HYPERNODE + sizeof(HypernodeID) + sizeof(HyperedgeID) +
+        sizeof(parallel::IntegralAtomicWrapper<HyperedgeID>) +
+        sizeof(parallel::IntegralAtomicWrapper<HypernodeWeight>));
+      coarsening.add("Contraction Buffers (Edges)", num_hyperedges,
+        Hypergraph::SIZE_OF_HYPEREDGE + sizeof(HyperedgeID));
+    } else {
+      coarsening.add("Contraction Buffers (Nodes)", num_hypernodes,
+        Hypergraph::SIZE_OF_HYPERNODE + sizeof(size_t) +
+        sizeof(parallel::IntegralAtomicWrapper<size_t>) +
+        sizeof(parallel::IntegralAtomicWrapper<HypernodeWeight>));
+      coarsening.add("Contraction Buffers (Edges)", num_hyperedges,
+        Hypergraph::SIZE_OF_HYPEREDGE + 2 * sizeof(size_t));
+      coarsening.add("Contraction Buffers (Pins)", num_pins, sizeof(HyperedgeID) + sizeof(HypernodeID));
+    }
+
+    // ########## Refinement Memory ##########
+    Phase refinement("Refinement");
+    const bool use_fm = context.refinement.fm.algorithm != FMAlgorithm::do_nothing;
+    refinement.add("Part IDs", num_hypernodes, sizeof(PartitionID));
+    refinement.add("Part Weights", k, sizeof(CAtomic<HypernodeWeight>));
+    if ( Hypergraph::is_graph ) {
+      refinement.add("Edge Synchronization", num_hyperedges, sizeof(SpinLock) + sizeof(uint32_t));
+      if ( use_fm ) {
+        refinement.add("Gain Cache", num_hypernodes * (k + 1), sizeof(CAtomic<HyperedgeWeight>));
+      }
+    } else {
+      const HypernodeID max_he_size = hypergraph.maxEdgeSize();
+      if ( uses_sparse_connectivity_information(context) ) {
+        refinement.add("Pin Count In Part",
+          ds::SparsePinCounts::num_elements(num_hyperedges, k, max_he_size),
+          sizeof(ds::SparsePinCounts::Value));
+      } else {
+        refinement.add("Pin Count In Part",
+          ds::PinCountInPart::num_elements(num_hyperedges, k, max_he_size),
+          sizeof(ds::PinCountInPart::Value));
+        refinement.add("Connectivity Set",
+          ds::ConnectivitySets::num_elements(num_hyperedges, k),
+          sizeof(ds::ConnectivitySets::UnsafeBlock));
+      }
+      refinement.add("Pin Count Update Ownership", num_hyperedges, sizeof(SpinLock));
+      if ( use_fm ) {
+        if ( context.partition.objective == Objective::steiner_tree && !context.mapping.use_two_phase_approach ) {
+          refinement.add("Gain Cache", num_hypernodes * k,
+            sizeof(CAtomic<HyperedgeWeight>) + sizeof(CAtomic<HyperedgeID>));
+        } else if ( context.refinement.sparse_gain_cache ) {
+          refinement.add("Gain Cache", num_hypernodes, GainCacheTable::size_of_sparse_node());
+        } else {
+          refinement.add("Gain Cache", num_hypernodes * (k + 1),
+            GainCacheTable::size_of_entry(Hypergraph::is_static_hypergraph));
+        }
+      }
+    }
+    if ( context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
+      // Each flow problem is grown around the cut of two blocks and is therefore
+      // bounded by the pins of two blocks (and the maximum size of a flow problem)
+      const size_t max_pins_per_flow_problem = std::min(
+        static_cast<size_t>(context.refinement.flows.max_num_pins),
+        k > 2 ? (2 * num_pins) / k + 1 : num_pins);
+      refinement.add("Flow Networks", context.shared_memory.num_threads * max_pins_per_flow_problem,
+        FLOW_NETWORK_BYTES_PER_PIN);
+    }
+
+    const Phase& peak_phase = std::max({ preprocessing, coarsening, refinement },
+      [](const Phase& lhs, const Phase& rhs) { return lhs.size_in_bytes < rhs.size_in_bytes; });
+    utils::MemoryTreeNode* phase_node = estimate.addChild(peak_phase.name);
+    for ( const auto& data_structure : peak_phase.data_structures ) {
+      phase_node->addChild(data_structure.first, data_structure.second);
+    }
+    estimate.finalize();
+    return estimate.size_in_bytes();
+  }
+
+  void apply_memory_budget(const mt_kahypar_hypergraph_t hypergraph, Context& context) {
+    if ( context.partition.max_memory == 0 ) {
+      return;
+    }
+
+    const size_t budget = context.partition.max_memory * BYTES_PER_MB;
+    auto estimate_fits_into_budget = [&](std::unique_ptr<utils::MemoryTreeNode>& estimate) {
+      estimate = std::make_unique<utils::MemoryTreeNode>("Estimated Peak Memory");
+      return estimate_peak_memory(hypergraph, context, *estimate) <= budget;
+    };
+    auto report_fallback = [&](const std::string& fallback) {
+      if ( context.partition.verbose_output ) {
+        LOG << "Estimated peak memory exceeds the memory budget of"
+            << to_megabytes(budget) << "=>" << fallback;
+      }
+    };
+
+    std::unique_ptr<utils::MemoryTreeNode> estimate;
+    bool fits = estimate_fits_into_budget(estimate);
+    if ( !fits && context.preprocessing.use_community_detection &&
+         !context.preprocessing.community_detection.low_memory_contraction ) {
+      report_fallback("Use low-memory contraction in community detection");
+      context.preprocessing.community_detection.low_memory_contraction = true;
+      fits = estimate_fits_into_budget(estimate);
+    }
+    if ( !fits && context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
+      report_fallback("Disable flow-based refinement");
+      context.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+      fits = estimate_fits_into_budget(estimate);
+    }
+    #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+    if ( !fits && context.partition.partition_type == MULTILEVEL_HYPERGRAPH_PARTITIONING &&
+         hypergraph.type == STATIC_HYPERGRAPH && context.partition.objective != Objective::steiner_tree ) {
+      report_fallback("Use sparse connectivity information");
+      context.partition.partition_type = LARGE_K_PARTITIONING;
+      fits = estimate_fits_into_budget(estimate);
+    }
+    #endif
+    if ( !fits && context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+      report_fallback("Disable FM refinement and gain cache");
+      context.refinement.fm.algorithm = FMAlgorithm::do_nothing;
+      fits = estimate_fits_into_budget(estimate);
+    }
+
+    if ( context.partition.verbose_output ) {
+      LOG << "\nEstimated Peak Memory Consumption";
+      LOG << *estimate;
+    }
+    if ( !fits ) {
+      std::stringstream ss;
+      ss << "The estimated peak memory consumption of " << to_megabytes(estimate->size_in_bytes())
+         << " exceeds the memory budget of " << to_megabytes(budget)
+         << " (even with all low-memory fallbacks). Increase the budget (--max-memory) or reduce k.";
+      throw SystemException(ss.str());
+    }
+  }
+
+  namespace {
+  #define ESTIMATE_PEAK_MEMORY(X) size_t estimate_peak_memory(const X& hypergraph,   \
+                                                            const Context& context,  \
+                                                            utils::MemoryTreeNode& estimate)
+  }
+
+  INSTANTIATE_FUNC_WITH_HYPERGRAPHS(ESTIMATE_PEAK_MEMORY)
+
+} // namespace mt_kahypar
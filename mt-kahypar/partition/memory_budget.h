@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include "include/mtkahypartypes.h"
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/utils/memory_tree.h"
+
+namespace mt_kahypar {
+
+// ! Estimates the peak memory consumption (in bytes) of partitioning the hypergraph
+// ! with the given context based on its number of nodes, edges, pins and k. The peak
+// ! is reached while the input hypergraph, the coarsening hierarchy and the largest of
+// ! the preprocessing, coarsening or refinement data structures are alive at the same
+// ! time. The corresponding breakdown is added to the memory tree.
+size_t estimate_peak_memory(const mt_kahypar_hypergraph_t hypergraph,
+                            const Context& context,
+                            utils::MemoryTreeNode& estimate);
+
+template<typename Hypergraph>
+size_t estimate_peak_memory(const Hypergraph& hypergraph,
+                            const Context& context,
+                            utils::MemoryTreeNode& estimate);
+
+// ! Adapts the context such that the estimated peak memory consumption fits into
+// ! the memory budget (context.partition.max_memory in MB, 0 = unlimited). The
+// ! following fallbacks are applied in this order until the estimate fits:
+// !  1.) low-memory contraction for the community detection
+// !  2.) no flow-based refinement
+// !  3.) sparse connectivity information (hypergraphs, if large-k features are enabled)
+// !  4.) no FM refinement (no gain cache)
+// ! Throws a SystemException if the budget cannot be met.
+void apply_memory_budget(const mt_kahypar_hypergraph_t hypergraph, Context& context);
+
+} // namespace mt_kahypar
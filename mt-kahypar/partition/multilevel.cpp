@@ -35,6 +35,7 @@
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/factories.h"
+#include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/degree_zero_hn_remover.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/large_he_remover.h"
 #include "mt-kahypar/partition/initial_partitioning/pool_initial_partitioner.h"
@@ -48,6 +49,7 @@
 #include "mt-kahypar/partition/coarsening/multilevel_uncoarsener.h"
 #include "mt-kahypar/partition/coarsening/nlevel_uncoarsener.h"
 #include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/randomize.h"
 #include "mt-kahypar/utils/utilities.h"
 #include "mt-kahypar/utils/exception.h"
 
@@ -73,21 +75,14 @@ namespace {
   }
 
   template<typename TypeTraits>
-  typename TypeTraits::PartitionedHypergraph multilevel_partitioning(
-    typename TypeTraits::Hypergraph& hypergraph,
-    const Context& context,
-    const TargetGraph* target_graph,
-    const bool is_vcycle) {
+  void coarsen_hypergraph(typename TypeTraits::Hypergraph& hypergraph,
+                          UncoarseningData<TypeTraits>& uncoarseningData,
+                          const Context& context) {
     using Hypergraph = typename TypeTraits::Hypergraph;
-    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
-    PartitionedHypergraph partitioned_hg;
 
     // ################## COARSENING ##################
     mt_kahypar::io::printCoarseningBanner(context);
 
-    const bool nlevel = context.isNLevelPartitioning();
-    UncoarseningData<TypeTraits> uncoarseningData(nlevel, hypergraph, context);
-
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("coarsening", "Coarsening");
     {
@@ -104,9 +99,20 @@ namespace {
       }
     }
     timer.stop_timer("coarsening");
+  }
+
+  template<typename TypeTraits>
+  void initial_partition(UncoarseningData<TypeTraits>& uncoarseningData,
+                         const Context& context,
+                         const TargetGraph* target_graph,
+                         const bool is_vcycle) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    const bool nlevel = uncoarseningData.nlevel;
 
     // ################## INITIAL PARTITIONING ##################
     io::printInitialPartitioningBanner(context);
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("initial_partitioning", "Initial Partitioning");
     PartitionedHypergraph& phg = uncoarseningData.coarsestPartitionedHypergraph();
 
@@ -185,8 +191,28 @@ namespace {
     }
     timer.stop_timer("initial_partitioning");
 
+    const utils::ProgressReporter& progress_reporter =
+      utils::Utilities::instance().getProgressReporter(context.utility_id);
+    if ( context.type == ContextType::main && progress_reporter.isEnabled() ) {
+      const size_t num_levels = nlevel ? uncoarseningData.removed_hyperedges_batches.size() :
+        uncoarseningData.hierarchy.size();
+      progress_reporter.report(utils::ProgressReporter::Phase::initial_partitioning,
+        num_levels, phg.initialNumNodes(), metrics::quality(phg, context));
+    }
+  }
+
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph uncoarsen(
+    typename TypeTraits::Hypergraph& hypergraph,
+    UncoarseningData<TypeTraits>& uncoarseningData,
+    const Context& context,
+    const TargetGraph* target_graph) {
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    PartitionedHypergraph partitioned_hg;
+
     // ################## UNCOARSENING ##################
     io::printLocalSearchBanner(context);
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("refinement", "Refinement");
     std::unique_ptr<IUncoarsener<TypeTraits>> uncoarsener(nullptr);
     if (uncoarseningData.nlevel) {
@@ -203,12 +229,108 @@ namespace {
 
     return partitioned_hg;
   }
+
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph initial_partitioning_and_uncoarsening(
+    typename TypeTraits::Hypergraph& hypergraph,
+    UncoarseningData<TypeTraits>& uncoarseningData,
+    const Context& context,
+    const TargetGraph* target_graph,
+    const bool is_vcycle) {
+    initial_partition(uncoarseningData, context, target_graph, is_vcycle);
+    return uncoarsen(hypergraph, uncoarseningData, context, target_graph);
+  }
+
+  template<typename TypeTraits>
+  struct PortfolioRun {
+    // ! Initial partitions are compared on the coarsest level (balanced first, then quality)
+    bool isBetterThan(const PortfolioRun& other) const {
+      return is_balanced > other.is_balanced ||
+        ( is_balanced == other.is_balanced && quality < other.quality );
+    }
+
+    std::unique_ptr<Context> context;
+    std::unique_ptr<UncoarseningData<TypeTraits>> uncoarseningData;
+    HyperedgeWeight quality = std::numeric_limits<HyperedgeWeight>::max();
+    bool is_balanced = false;
+  };
+
+  // ! Coarsens the hypergraph and computes an initial partition with several different
+  // ! seeds. Only the run with the best initial partition is refined to completion. The
+  // ! hierarchy of a dominated run is freed as soon as a better run is found.
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph portfolio_partitioning(
+    typename TypeTraits::Hypergraph& hypergraph,
+    const Context& context,
+    const TargetGraph* target_graph) {
+    const utils::TimeLimit& time_limit = utils::Utilities::instance().getTimeLimit(context.utility_id);
+    PortfolioRun<TypeTraits> best;
+    for ( size_t i = 0; i < context.partition.portfolio_size; ++i ) {
+      if ( i > 0 && time_limit.exceeded() ) {
+        // Each completed run provides an initial partition. Thus, we can
+        // skip the remaining runs if the time limit is exceeded.
+        if ( context.partition.verbose_output ) {
+          LOG << RED << ( time_limit.isCancelled() ? "Partitioning cancelled" : "Time limit exceeded" )
+              << "=> skip remaining portfolio runs" << END;
+        }
+        break;
+      }
+
+      PortfolioRun<TypeTraits> run;
+      run.context = std::make_unique<Context>(context);
+      run.context->partition.seed = context.partition.seed + static_cast<int>(i);
+      utils::Randomize::instance().setSeed(run.context->partition.seed);
+      run.uncoarseningData = std::make_unique<UncoarseningData<TypeTraits>>(
+        false, hypergraph, *run.context);
+      coarsen_hypergraph(hypergraph, *run.uncoarseningData, *run.context);
+      initial_partition(*run.uncoarseningData, *run.context, target_graph, false);
+
+      const auto& phg = run.uncoarseningData->coarsestPartitionedHypergraph();
+      run.quality = metrics::quality(phg, *run.context);
+      run.is_balanced = metrics::isBalanced(phg, *run.context);
+      if ( context.partition.verbose_output ) {
+        LOG << "Portfolio run" << (i + 1) << "with seed" << run.context->partition.seed
+            << ": initial" << context.partition.objective << "=" << run.quality
+            << (run.is_balanced ? "" : "(imbalanced)");
+      }
+
+      if ( !best.uncoarseningData || run.isBetterThan(best) ) {
+        best.uncoarseningData.reset();
+        best = std::move(run);
+      }
+    }
+
+    if ( context.partition.verbose_output ) {
+      LOG << "Refining the initial partition of the portfolio run with seed" << best.context->partition.seed;
+      io::printStripe();
+    }
+    return uncoarsen(hypergraph, *best.uncoarseningData, *best.context, target_graph);
+  }
+
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph multilevel_partitioning(
+    typename TypeTraits::Hypergraph& hypergraph,
+    const Context& context,
+    const TargetGraph* target_graph,
+    const bool is_vcycle) {
+    UncoarseningData<TypeTraits> uncoarseningData(
+      context.isNLevelPartitioning(), hypergraph, context);
+    coarsen_hypergraph(hypergraph, uncoarseningData, context);
+    return initial_partitioning_and_uncoarsening(
+      hypergraph, uncoarseningData, context, target_graph, is_vcycle);
+  }
 }
 
 template<typename TypeTraits>
 typename Multilevel<TypeTraits>::PartitionedHypergraph Multilevel<TypeTraits>::partition(
   Hypergraph& hypergraph, const Context& context, const TargetGraph* target_graph) {
-  PartitionedHypergraph partitioned_hg =
+  // The portfolio mode coarsens the hypergraph several times. This is not
+  // possible in n-level mode, since it contracts the input hypergraph in-place.
+  const bool use_portfolio = context.partition.portfolio_size > 1 &&
+    context.type == ContextType::main && context.partition.mode == Mode::direct &&
+    !context.isNLevelPartitioning();
+  PartitionedHypergraph partitioned_hg = use_portfolio ?
+    portfolio_partitioning<TypeTraits>(hypergraph, context, target_graph) :
     multilevel_partitioning<TypeTraits>(hypergraph, context, target_graph, false);
 
   // ################## V-CYCLES ##################
@@ -219,6 +341,28 @@ typename Multilevel<TypeTraits>::PartitionedHypergraph Multilevel<TypeTraits>::p
   return partitioned_hg;
 }
 
+template<typename TypeTraits>
+std::unique_ptr<UncoarseningData<TypeTraits>> Multilevel<TypeTraits>::coarsen(
+  Hypergraph& hypergraph, const Context& context) {
+  if ( context.isNLevelPartitioning() ) {
+    throw UnsupportedOperationException(
+      "Reusing the coarsening hierarchy is only supported in multilevel mode!");
+  }
+  auto hierarchy = std::make_unique<UncoarseningData<TypeTraits>>(false, hypergraph, context);
+  coarsen_hypergraph(hypergraph, *hierarchy, context);
+  return hierarchy;
+}
+
+template<typename TypeTraits>
+typename Multilevel<TypeTraits>::PartitionedHypergraph Multilevel<TypeTraits>::partition(
+  Hypergraph& hypergraph, UncoarseningData<TypeTraits>& hierarchy,
+  const Context& context, const TargetGraph* target_graph) {
+  ASSERT(!hierarchy.nlevel && hierarchy.is_finalized);
+  hierarchy.resetPartitionedHypergraph(context.partition.k);
+  return initial_partitioning_and_uncoarsening(
+    hypergraph, hierarchy, context, target_graph, false);
+}
+
 template<typename TypeTraits>
 void Multilevel<TypeTraits>::partition(PartitionedHypergraph& partitioned_hg,
                                        const Context& context,
@@ -238,7 +382,18 @@ void Multilevel<TypeTraits>::partitionVCycle(Hypergraph& hypergraph,
                                              const TargetGraph* target_graph) {
   ASSERT(context.partition.num_vcycles > 0);
 
+  const utils::TimeLimit& time_limit = utils::Utilities::instance().getTimeLimit(context.utility_id);
   for ( size_t i = 0; i < context.partition.num_vcycles; ++i ) {
+    if ( time_limit.exceeded() ) {
+      // V-cycles only improve the current partition. Thus, we can stop here
+      // and return the current partition if the time limit is exceeded.
+      if ( context.partition.verbose_output ) {
+        LOG << RED << ( time_limit.isCancelled() ? "Partitioning cancelled" : "Time limit exceeded" )
+            << "=> skip remaining V-cycles" << END;
+      }
+      break;
+    }
+
     // Reset memory pool
     hypergraph.reset();
     parallel::MemoryPool::instance().reset();
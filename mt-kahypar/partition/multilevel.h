@@ -27,12 +27,16 @@
 
 #pragma once
 
+#include <memory>
+
 #include "mt-kahypar/partition/context.h"
 
 namespace mt_kahypar {
 
 // Forward Declaration
 class TargetGraph;
+template<typename TypeTraits>
+class UncoarseningData;
 
 template<typename TypeTraits>
 class Multilevel {
@@ -51,6 +55,21 @@ class Multilevel {
                         const Context& context,
                         const TargetGraph* target_graph = nullptr);
 
+  // ! Coarsens the hypergraph and returns the multilevel hierarchy. The hierarchy
+  // ! can be reused for several partitioning runs with a different number of blocks
+  // ! or imbalance factor (see partition(hypergraph, hierarchy, context) below).
+  // ! Note that the contraction limit of the given context should be derived from
+  // ! the largest k for which the hierarchy is used.
+  static std::unique_ptr<UncoarseningData<TypeTraits>> coarsen(Hypergraph& hypergraph,
+                                                               const Context& context);
+
+  // ! Partitions a hypergraph using a previously computed multilevel hierarchy,
+  // ! i.e., only initial partitioning and uncoarsening are performed.
+  static PartitionedHypergraph partition(Hypergraph& hypergraph,
+                                         UncoarseningData<TypeTraits>& hierarchy,
+                                         const Context& context,
+                                         const TargetGraph* target_graph = nullptr);
+
   // ! Improves an existing partition using the iterated multilevel cycle technique
   // ! (also called V-cycle).
   static void partitionVCycle(Hypergraph& hypergraph,
@@ -27,15 +27,21 @@
 
 #include "partitioner.h"
 
+#include <algorithm>
+#include <memory>
+
 #include <tbb_kahypar/parallel_sort.h>
 #include <tbb_kahypar/parallel_reduce.h>
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/partition/multilevel.h"
+#include "mt-kahypar/partition/coarsening/coarsening_commons.h"
+#include "mt-kahypar/partition/coarsening/coarsening_snapshot.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/degree_zero_hn_remover.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/large_he_remover.h"
 #include "mt-kahypar/partition/preprocessing/community_detection/parallel_louvain.h"
+#include "mt-kahypar/partition/preprocessing/node_reordering.h"
 #include "mt-kahypar/partition/recursive_bipartitioning.h"
 #include "mt-kahypar/partition/deep_multilevel.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
@@ -64,15 +70,6 @@ namespace mt_kahypar {
     context.setupThreadsPerFlowSearch();
 
     if ( context.partition.gain_policy == GainPolicy::steiner_tree ) {
-      const PartitionID k = target_graph ? target_graph->numBlocks() : 1;
-      const PartitionID max_k = Hypergraph::is_graph ? 256 : 64;
-      if ( k  > max_k ) {
-        const std::string type = Hypergraph::is_graph ? "graphs" : "hypergraphs";
-        throw InvalidInputException(
-          "We currently only support mappings of " + type + " onto target graphs with at "
-          "most " + STR(max_k) + "nodes!");
-      }
-
       if ( context.mapping.largest_he_fraction > 0.0 ) {
         // Determine a threshold of what we consider a large hyperedge in
         // the steiner tree gain cache
@@ -136,6 +133,27 @@ namespace mt_kahypar {
           "Deep multilevel partitioning scheme does not support fixed vertices!");
       }
     }
+
+    // Check coarsening snapshot compatibility
+    if ( context.partition.coarsening_snapshot_input_file != "" ||
+         context.partition.coarsening_snapshot_output_file != "" ) {
+      if ( context.partition.mode != Mode::direct || context.isNLevelPartitioning() ) {
+        throw UnsupportedOperationException(
+          "Coarsening snapshots are only supported in multilevel mode with direct k-way partitioning!");
+      }
+      if ( hypergraph.hasFixedVertices() ) {
+        throw UnsupportedOperationException("Coarsening snapshots do not support fixed vertices!");
+      }
+      if ( context.partition.portfolio_size > 1 ) {
+        throw InvalidParameterException(
+          "Coarsening snapshots store a single hierarchy and can not be combined with the portfolio mode!");
+      }
+      if ( context.preprocessing.node_ordering == NodeOrdering::community ) {
+        // Community detection is skipped when reading a snapshot
+        throw InvalidParameterException(
+          "Coarsening snapshots can not be combined with the community node ordering!");
+      }
+    }
   }
 
   template<typename Hypergraph>
@@ -245,6 +263,13 @@ namespace mt_kahypar {
       target_graph->precomputeDistances(max_steiner_tree_size);
       timer.stop_timer("precompute_steiner_trees");
     }
+    if ( target_graph && target_graph->isInitialized() &&
+         target_graph->maxPrecomputedConnectivity() <
+         static_cast<PartitionID>(context.mapping.max_steiner_tree_size) ) {
+      // Steiner trees of larger connectivity sets are approximated (e.g., if the
+      // target graph is too large to precompute all trees of the requested size)
+      context.mapping.max_steiner_tree_size = target_graph->maxPrecomputedConnectivity();
+    }
   }
 
   template<typename Hypergraph>
@@ -290,6 +315,46 @@ namespace mt_kahypar {
     parallel::MemoryPool::instance().release_mem_group("Preprocessing");
   }
 
+  // ! Multilevel partitioning that reads the coarsening hierarchy from a snapshot file
+  // ! instead of coarsening the hypergraph and/or writes it to a snapshot file
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph partitionWithCoarseningSnapshot(
+    typename TypeTraits::Hypergraph& hypergraph, Context& context, const TargetGraph* target_graph) {
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    std::unique_ptr<UncoarseningData<TypeTraits>> hierarchy;
+    if ( context.partition.coarsening_snapshot_input_file != "" ) {
+      timer.start_timer("read_coarsening_snapshot", "Read Coarsening Snapshot");
+      hierarchy = CoarseningSnapshot<TypeTraits>::read(
+        context.partition.coarsening_snapshot_input_file, hypergraph, context);
+      timer.stop_timer("read_coarsening_snapshot");
+      if ( context.partition.verbose_output ) {
+        LOG << "Read coarsening hierarchy with" << hierarchy->hierarchy.size() << "levels from"
+            << context.partition.coarsening_snapshot_input_file;
+        io::printStripe();
+      }
+    } else {
+      hierarchy = Multilevel<TypeTraits>::coarsen(hypergraph, context);
+    }
+
+    if ( context.partition.coarsening_snapshot_output_file != "" ) {
+      timer.start_timer("write_coarsening_snapshot", "Write Coarsening Snapshot");
+      CoarseningSnapshot<TypeTraits>::write(
+        context.partition.coarsening_snapshot_output_file, hypergraph, *hierarchy, context);
+      timer.stop_timer("write_coarsening_snapshot");
+    }
+
+    PartitionedHypergraph partitioned_hg =
+      Multilevel<TypeTraits>::partition(hypergraph, *hierarchy, context, target_graph);
+    hierarchy.reset();
+
+    // ################## V-CYCLES ##################
+    if ( context.partition.num_vcycles > 0 ) {
+      Multilevel<TypeTraits>::partitionVCycle(hypergraph, partitioned_hg, context, target_graph);
+    }
+    return partitioned_hg;
+  }
+
   template<typename PartitionedHypergraph>
   void forceFixedVertexAssignment(PartitionedHypergraph& partitioned_hg,
                                   const Context& context) {
@@ -319,6 +384,7 @@ namespace mt_kahypar {
   template<typename TypeTraits>
   typename Partitioner<TypeTraits>::PartitionedHypergraph Partitioner<TypeTraits>::partition(
     Hypergraph& hypergraph, Context& context, TargetGraph* target_graph) {
+    utils::Utilities::instance().getTimeLimit(context.utility_id).start(context.partition.time_limit);
     configurePreprocessing(hypergraph, context);
     setupContext(hypergraph, context, target_graph);
 
@@ -341,13 +407,27 @@ namespace mt_kahypar {
     timer.start_timer("preprocessing", "Preprocessing");
     DegreeZeroHypernodeRemover<TypeTraits> degree_zero_hn_remover(context);
     LargeHyperedgeRemover<TypeTraits> large_he_remover(context);
-    preprocess(hypergraph, context, target_graph);
+    NodeReordering<TypeTraits> node_reordering(context);
+    const bool use_coarsening_snapshot = context.partition.coarsening_snapshot_input_file != "" ||
+      context.partition.coarsening_snapshot_output_file != "";
+    if ( context.partition.coarsening_snapshot_input_file != "" ) {
+      // Communities are only used to guide coarsening, which is
+      // replaced by reading the hierarchy from the snapshot
+      precomputeSteinerTrees(hypergraph, target_graph, context);
+    } else {
+      preprocess(hypergraph, context, target_graph);
+    }
+    timer.start_timer("node_reordering", "Node Reordering");
+    node_reordering.reorder(hypergraph);
+    timer.stop_timer("node_reordering");
     sanitize(hypergraph, context, degree_zero_hn_remover, large_he_remover);
     timer.stop_timer("preprocessing");
 
     // ################## MULTILEVEL & VCYCLE ##################
     PartitionedHypergraph partitioned_hypergraph;
-    if (context.partition.mode == Mode::direct) {
+    if (use_coarsening_snapshot) {
+      partitioned_hypergraph = partitionWithCoarseningSnapshot<TypeTraits>(hypergraph, context, target_graph);
+    } else if (context.partition.mode == Mode::direct) {
       partitioned_hypergraph = Multilevel<TypeTraits>::partition(hypergraph, context, target_graph);
     } else if (context.partition.mode == Mode::recursive_bipartitioning) {
       partitioned_hypergraph = RecursiveBipartitioning<TypeTraits>::partition(hypergraph, context, target_graph);
@@ -391,6 +471,13 @@ namespace mt_kahypar {
     }
     #endif
 
+    if ( node_reordering.isReordered() ) {
+      // Map partition back to the original node IDs
+      timer.start_timer("restore_node_order", "Restore Node Order");
+      partitioned_hypergraph = node_reordering.restoreOriginalOrder(partitioned_hypergraph, hypergraph);
+      timer.stop_timer("restore_node_order");
+    }
+
     if (context.partition.verbose_output) {
       io::printHypergraphInfo(partitioned_hypergraph.hypergraph(), context,
         "Uncoarsened Hypergraph", context.partition.show_memory_consumption);
@@ -401,10 +488,102 @@ namespace mt_kahypar {
   }
 
 
+  template<typename TypeTraits>
+  vec<typename Partitioner<TypeTraits>::PartitionedHypergraph> Partitioner<TypeTraits>::partitionForMultipleK(
+    Hypergraph& hypergraph, vec<Context>& contexts) {
+    vec<PartitionedHypergraph> partitions;
+    partitions.reserve(contexts.size());
+
+    // The coarsening hierarchy can only be shared in multilevel mode. V-cycles coarsen the
+    // hypergraph again and are therefore also performed with independent runs.
+    const bool reuse_hierarchy = contexts.size() > 1 &&
+      !hypergraph.hasFixedVertices() &&
+      std::all_of(contexts.begin(), contexts.end(), [&](const Context& context) {
+        return context.partition.mode == Mode::direct &&
+               !context.isNLevelPartitioning() &&
+               context.partition.objective != Objective::steiner_tree &&
+               context.partition.num_vcycles == 0;
+      });
+    if ( !reuse_hierarchy ) {
+      for ( Context& context : contexts ) {
+        partitions.push_back(partition(hypergraph, context));
+      }
+      return partitions;
+    }
+
+    for ( Context& context : contexts ) {
+      configurePreprocessing(hypergraph, context);
+      setupContext(hypergraph, context, nullptr);
+    }
+
+    // The hierarchy is computed with the contraction limit of the largest k.
+    // To keep the hierarchy valid for all contexts, the maximum allowed node
+    // weight is the minimum over all contexts.
+    const size_t coarsening_idx = std::max_element(contexts.begin(), contexts.end(),
+      [&](const Context& lhs, const Context& rhs) {
+        return lhs.coarsening.contraction_limit < rhs.coarsening.contraction_limit;
+      }) - contexts.begin();
+    Context coarsening_context(contexts[coarsening_idx]);
+    for ( const Context& context : contexts ) {
+      coarsening_context.coarsening.max_allowed_node_weight = std::min(
+        coarsening_context.coarsening.max_allowed_node_weight,
+        context.coarsening.max_allowed_node_weight);
+    }
+    for ( Context& context : contexts ) {
+      context.coarsening = coarsening_context.coarsening;
+    }
+
+    io::printContext(coarsening_context);
+    io::printMemoryPoolConsumption(coarsening_context);
+    io::printInputInformation(coarsening_context, hypergraph);
+
+    // ################## PREPROCESSING ##################
+    utils::Timer& timer = utils::Utilities::instance().getTimer(coarsening_context.utility_id);
+    utils::TimeLimit& time_limit = utils::Utilities::instance().getTimeLimit(coarsening_context.utility_id);
+    time_limit.start(coarsening_context.partition.time_limit);
+    timer.start_timer("preprocessing", "Preprocessing");
+    DegreeZeroHypernodeRemover<TypeTraits> degree_zero_hn_remover(coarsening_context);
+    LargeHyperedgeRemover<TypeTraits> large_he_remover(coarsening_context);
+    preprocess(hypergraph, coarsening_context, nullptr);
+    sanitize(hypergraph, coarsening_context, degree_zero_hn_remover, large_he_remover);
+    timer.stop_timer("preprocessing");
+
+    // ################## COARSENING ##################
+    std::unique_ptr<UncoarseningData<TypeTraits>> hierarchy =
+      Multilevel<TypeTraits>::coarsen(hypergraph, coarsening_context);
+
+    // ################## INITIAL PARTITIONING & UNCOARSENING ##################
+    for ( size_t i = 0; i < contexts.size(); ++i ) {
+      if ( i > 0 ) {
+        // The time limit applies to each partitioning run
+        time_limit.start(contexts[i].partition.time_limit);
+      }
+      partitions.push_back(Multilevel<TypeTraits>::partition(hypergraph, *hierarchy, contexts[i]));
+    }
+    hierarchy.reset();
+
+    // ################## POSTPROCESSING ##################
+    // All partitions share the same hypergraph. Thus, we restore the removed
+    // hyperedges and vertices only after all partitioning runs are completed.
+    timer.start_timer("postprocessing", "Postprocessing");
+    large_he_remover.restoreLargeHyperedges(partitions);
+    degree_zero_hn_remover.restoreDegreeZeroHypernodes(partitions, contexts);
+    timer.stop_timer("postprocessing");
+
+    if (coarsening_context.partition.verbose_output) {
+      io::printHypergraphInfo(hypergraph, coarsening_context,
+        "Uncoarsened Hypergraph", coarsening_context.partition.show_memory_consumption);
+      io::printStripe();
+    }
+
+    return partitions;
+  }
+
   template<typename TypeTraits>
   void Partitioner<TypeTraits>::partitionVCycle(PartitionedHypergraph& partitioned_hg,
                                                 Context& context,
                                                 TargetGraph* target_graph) {
+    utils::Utilities::instance().getTimeLimit(context.utility_id).start(context.partition.time_limit);
     Hypergraph& hypergraph = partitioned_hg.hypergraph();
     configurePreprocessing(hypergraph, context);
     setupContext(hypergraph, context, target_graph);
@@ -45,6 +45,14 @@ class Partitioner {
                                          Context& context,
                                          TargetGraph* target_graph = nullptr);
 
+  // ! Partitions the hypergraph once for each context (e.g., with different numbers of
+  // ! blocks or imbalance factors). In multilevel mode, the hypergraph is coarsened only
+  // ! once using the contraction limit of the largest k and each run only performs initial
+  // ! partitioning and uncoarsening on the shared hierarchy. Otherwise, the hypergraph is
+  // ! partitioned independently for each context.
+  static vec<PartitionedHypergraph> partitionForMultipleK(Hypergraph& hypergraph,
+                                                          vec<Context>& contexts);
+
   static void partitionVCycle(PartitionedHypergraph& partitioned_hg,
                               Context& context,
                               TargetGraph* target_graph = nullptr);
@@ -27,6 +27,8 @@
 
 #include "mt-kahypar/partition/partitioner_facade.h"
 
+#include <memory>
+
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/partitioner.h"
 #include "mt-kahypar/io/partitioning_output.h"
@@ -59,6 +61,26 @@ namespace internal {
         new PartitionedHypergraph(std::move(partitioned_hg))), PartitionedHypergraph::TYPE };
   }
 
+  template<typename TypeTraits>
+  std::vector<mt_kahypar_partitioned_hypergraph_t> partitionForMultipleK(mt_kahypar_hypergraph_t hypergraph,
+                                                                         vec<Context>& contexts) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
+
+    // Partition Hypergraph
+    vec<PartitionedHypergraph> partitions =
+      Partitioner<TypeTraits>::partitionForMultipleK(hg, contexts);
+
+    std::vector<mt_kahypar_partitioned_hypergraph_t> partitioned_hgs;
+    for ( PartitionedHypergraph& partitioned_hg : partitions ) {
+      partitioned_hgs.push_back(mt_kahypar_partitioned_hypergraph_t {
+        reinterpret_cast<mt_kahypar_partitioned_hypergraph_s*>(
+          new PartitionedHypergraph(std::move(partitioned_hg))), PartitionedHypergraph::TYPE });
+    }
+    return partitioned_hgs;
+  }
+
   template<typename TypeTraits>
   void improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                Context& context,
@@ -70,6 +92,34 @@ namespace internal {
     Partitioner<TypeTraits>::partitionVCycle(phg, context, target_graph);
   }
 
+  template<typename TypeTraits>
+  mt_kahypar_partitioned_hypergraph_t repartitionIncrementally(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                               const HypergraphDelta& delta,
+                                                               Context& context,
+                                                               mt_kahypar_hypergraph_t& updated_hg) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    const PartitionedHypergraph& phg = utils::cast_const<PartitionedHypergraph>(partitioned_hg);
+    std::unique_ptr<Hypergraph> hg = std::make_unique<Hypergraph>(
+      IncrementalRepartitioner<TypeTraits>::applyDelta(phg, delta));
+    PartitionedHypergraph updated_phg =
+      IncrementalRepartitioner<TypeTraits>::repartition(phg, delta, *hg, context);
+    updated_hg = mt_kahypar_hypergraph_t {
+      reinterpret_cast<mt_kahypar_hypergraph_s*>(hg.release()), Hypergraph::TYPE };
+    return mt_kahypar_partitioned_hypergraph_t {
+      reinterpret_cast<mt_kahypar_partitioned_hypergraph_s*>(
+        new PartitionedHypergraph(std::move(updated_phg))), PartitionedHypergraph::TYPE };
+  }
+
+  mt_kahypar_partition_type_t partition_type_of(const Context& context) {
+    // The memory budget may select the sparse data structures of the large-k
+    // partitioning mode for a preset that otherwise uses the dense ones
+    if ( context.partition.partition_type == LARGE_K_PARTITIONING ) {
+      return LARGE_K_PARTITIONING;
+    }
+    return to_partition_c_type(context.partition.preset_type, context.partition.instance_type);
+  }
+
   void check_if_feature_is_enabled(const mt_kahypar_partition_type_t type) {
     unused(type);
     #ifndef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
@@ -100,8 +150,7 @@ namespace internal {
   mt_kahypar_partitioned_hypergraph_t PartitionerFacade::partition(mt_kahypar_hypergraph_t hypergraph,
                                                                    Context& context,
                                                                    TargetGraph* target_graph) {
-    const mt_kahypar_partition_type_t type = to_partition_c_type(
-      context.partition.preset_type, context.partition.instance_type);
+    const mt_kahypar_partition_type_t type = internal::partition_type_of(context);
     internal::check_if_feature_is_enabled(type);
     switch ( type ) {
       #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
@@ -129,11 +178,42 @@ namespace internal {
   }
 
 
+  std::vector<mt_kahypar_partitioned_hypergraph_t> PartitionerFacade::partitionForMultipleK(mt_kahypar_hypergraph_t hypergraph,
+                                                                                          vec<Context>& contexts) {
+    if ( contexts.empty() ) {
+      return { };
+    }
+    const mt_kahypar_partition_type_t type = internal::partition_type_of(contexts[0]);
+    internal::check_if_feature_is_enabled(type);
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        return internal::partitionForMultipleK<StaticGraphTypeTraits>(hypergraph, contexts);
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        return internal::partitionForMultipleK<StaticHypergraphTypeTraits>(hypergraph, contexts);
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        return internal::partitionForMultipleK<LargeKHypergraphTypeTraits>(hypergraph, contexts);
+      #endif
+      #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case N_LEVEL_GRAPH_PARTITIONING:
+        return internal::partitionForMultipleK<DynamicGraphTypeTraits>(hypergraph, contexts);
+      #endif
+      case N_LEVEL_HYPERGRAPH_PARTITIONING:
+        return internal::partitionForMultipleK<DynamicHypergraphTypeTraits>(hypergraph, contexts);
+      #endif
+      default:
+        return { };
+    }
+    return { };
+  }
+
   void PartitionerFacade::improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                   Context& context,
                                   TargetGraph* target_graph) {
-    const mt_kahypar_partition_type_t type = to_partition_c_type(
-      context.partition.preset_type, context.partition.instance_type);
+    const mt_kahypar_partition_type_t type = internal::partition_type_of(context);
     internal::check_if_feature_is_enabled(type);
     switch ( type ) {
       #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
@@ -158,6 +238,37 @@ namespace internal {
     }
   }
 
+  mt_kahypar_partitioned_hypergraph_t PartitionerFacade::repartitionIncrementally(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                                                 const HypergraphDelta& delta,
+                                                                                 Context& context,
+                                                                                 mt_kahypar_hypergraph_t& updated_hg) {
+    const mt_kahypar_partition_type_t type = partitioned_hg.type;
+    internal::check_if_feature_is_enabled(type);
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        return internal::repartitionIncrementally<StaticGraphTypeTraits>(partitioned_hg, delta, context, updated_hg);
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        return internal::repartitionIncrementally<StaticHypergraphTypeTraits>(partitioned_hg, delta, context, updated_hg);
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        return internal::repartitionIncrementally<LargeKHypergraphTypeTraits>(partitioned_hg, delta, context, updated_hg);
+      #endif
+      #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case N_LEVEL_GRAPH_PARTITIONING:
+        return internal::repartitionIncrementally<DynamicGraphTypeTraits>(partitioned_hg, delta, context, updated_hg);
+      #endif
+      case N_LEVEL_HYPERGRAPH_PARTITIONING:
+        return internal::repartitionIncrementally<DynamicHypergraphTypeTraits>(partitioned_hg, delta, context, updated_hg);
+      #endif
+      default:
+        return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+    }
+    return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+  }
+
   void PartitionerFacade::printPartitioningResults(const mt_kahypar_partitioned_hypergraph_t phg,
                                                    const Context& context,
                                                    const std::chrono::duration<double>& elapsed_seconds) {
@@ -248,30 +359,31 @@ namespace internal {
   }
 
   void PartitionerFacade::writePartitionFile(const mt_kahypar_partitioned_hypergraph_t phg,
-                                             const std::string& filename) {
+                                             const std::string& filename,
+                                             const FileFormat format) {
     const mt_kahypar_partition_type_t type = phg.type;
     switch ( type ) {
       #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
       case MULTILEVEL_GRAPH_PARTITIONING:
-        io::writePartitionFile(utils::cast_const<StaticPartitionedGraph>(phg), filename);
+        io::writePartitionFile(utils::cast_const<StaticPartitionedGraph>(phg), filename, format);
         break;
       #endif
       case MULTILEVEL_HYPERGRAPH_PARTITIONING:
-        io::writePartitionFile(utils::cast_const<StaticPartitionedHypergraph>(phg), filename);
+        io::writePartitionFile(utils::cast_const<StaticPartitionedHypergraph>(phg), filename, format);
         break;
       #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
       case LARGE_K_PARTITIONING:
-        io::writePartitionFile(utils::cast_const<StaticSparsePartitionedHypergraph>(phg), filename);
+        io::writePartitionFile(utils::cast_const<StaticSparsePartitionedHypergraph>(phg), filename, format);
         break;
       #endif
       #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
       #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
       case N_LEVEL_GRAPH_PARTITIONING:
-        io::writePartitionFile(utils::cast_const<DynamicPartitionedGraph>(phg), filename);
+        io::writePartitionFile(utils::cast_const<DynamicPartitionedGraph>(phg), filename, format);
         break;
       #endif
       case N_LEVEL_HYPERGRAPH_PARTITIONING:
-        io::writePartitionFile(utils::cast_const<DynamicPartitionedHypergraph>(phg), filename);
+        io::writePartitionFile(utils::cast_const<DynamicPartitionedHypergraph>(phg), filename, format);
         break;
       #endif
       default: break;
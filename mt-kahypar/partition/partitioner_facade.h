@@ -27,9 +27,12 @@
 
 #pragma once
 
+#include <vector>
+
 #include "include/mtkahypartypes.h"
 
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/incremental_repartitioner.h"
 
 namespace mt_kahypar {
 
@@ -43,11 +46,24 @@ class PartitionerFacade {
                                                        Context& context,
                                                        TargetGraph* target_graph = nullptr);
 
+  // ! Partitions the hypergraph once for each context. In multilevel mode, all
+  // ! partitioning runs share the same coarsening hierarchy.
+  static std::vector<mt_kahypar_partitioned_hypergraph_t> partitionForMultipleK(mt_kahypar_hypergraph_t hypergraph,
+                                                                                vec<Context>& contexts);
+
   // ! Improves a given partition
   static void improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                       Context& context,
                       TargetGraph* target_graph = nullptr);
 
+  // ! Applies a small modification to the hypergraph of the given partition and repairs
+  // ! the partition locally. The updated hypergraph is stored in 'updated_hg' and must
+  // ! outlive the returned partitioned hypergraph.
+  static mt_kahypar_partitioned_hypergraph_t repartitionIncrementally(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                                      const HypergraphDelta& delta,
+                                                                      Context& context,
+                                                                      mt_kahypar_hypergraph_t& updated_hg);
+
   // ! Prints timings and metrics to output
   static void printPartitioningResults(const mt_kahypar_partitioned_hypergraph_t phg,
                                        const Context& context,
@@ -66,7 +82,8 @@ class PartitionerFacade {
 
   // ! Writes the partition to the corresponding file
   static void writePartitionFile(const mt_kahypar_partitioned_hypergraph_t phg,
-                                 const std::string& filename);
+                                 const std::string& filename,
+                                 const FileFormat format = FileFormat::hMetis);
 };
 
 }  // namespace mt_kahypar
@@ -0,0 +1,260 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <tbb_kahypar/parallel_for.h>
+#include <tbb_kahypar/parallel_invoke.h>
+#include <tbb_kahypar/parallel_sort.h>
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/datastructures/fixed_vertex_support.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/bit_ops.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Relabels the nodes of a static (hyper)graph such that nodes that are likely to be
+ * accessed together (same community, same BFS layer, similar degree) have consecutive IDs.
+ * The input order of most instances is essentially random, which scatters the pins of
+ * a net across memory in all phases of the multilevel algorithm. The original hypergraph
+ * is kept and restored after partitioning, such that the partition that is returned to
+ * the caller refers to the original node IDs.
+ */
+template<typename TypeTraits>
+class NodeReordering {
+
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using HypergraphFactory = typename Hypergraph::Factory;
+
+ public:
+  NodeReordering(const Context& context) :
+    _context(context),
+    _original_hg(),
+    _new_id(),
+    _is_reordered(false) { }
+
+  NodeReordering(const NodeReordering&) = delete;
+  NodeReordering & operator= (const NodeReordering &) = delete;
+
+  NodeReordering(NodeReordering&&) = delete;
+  NodeReordering & operator= (NodeReordering &&) = delete;
+
+  bool isReordered() const {
+    return _is_reordered;
+  }
+
+  // ! ID of node hn of the original hypergraph in the reordered hypergraph
+  HypernodeID reorderedID(const HypernodeID hn) const {
+    ASSERT(_is_reordered && hn < _new_id.size());
+    return _new_id[hn];
+  }
+
+  // ! Replaces the hypergraph with a copy whose nodes are relabeled according to
+  // ! the node ordering of the context. Only supported for static (hyper)graphs.
+  void reorder(Hypergraph& hypergraph) {
+    if constexpr ( Hypergraph::is_static_hypergraph ) {
+      if ( _context.preprocessing.node_ordering == NodeOrdering::none ||
+           hypergraph.numRemovedHypernodes() > 0 ) {
+        return;
+      }
+
+      computeNewNodeIDs(hypergraph);
+      Hypergraph reordered_hg = constructReorderedHypergraph(hypergraph);
+      _original_hg = std::move(hypergraph);
+      hypergraph = std::move(reordered_hg);
+      if ( _original_hg.hasFixedVertices() ) {
+        ds::FixedVertexSupport<Hypergraph> fixed_vertices(
+          hypergraph.initialNumNodes(), _context.partition.k);
+        fixed_vertices.setHypergraph(&hypergraph);
+        _original_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+          if ( _original_hg.isFixed(hn) ) {
+            fixed_vertices.fixToBlock(_new_id[hn], _original_hg.fixedVertexBlock(hn));
+          }
+        });
+        hypergraph.addFixedVertexSupport(std::move(fixed_vertices));
+      }
+      _is_reordered = true;
+    } else {
+      unused(hypergraph);
+    }
+  }
+
+  // ! Restores the original hypergraph and returns a partition of it, in which each
+  // ! node is assigned to the block of its relabeled counterpart in partitioned_hg.
+  PartitionedHypergraph restoreOriginalOrder(PartitionedHypergraph& partitioned_hg,
+                                             Hypergraph& hypergraph) {
+    ASSERT(_is_reordered);
+    const PartitionID k = partitioned_hg.k();
+    const TargetGraph* target_graph = partitioned_hg.hasTargetGraph() ?
+      partitioned_hg.targetGraph() : nullptr;
+    vec<PartitionID> part(_original_hg.initialNumNodes(), kInvalidPartition);
+    _original_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      part[hn] = partitioned_hg.partID(_new_id[hn]);
+    });
+    partitioned_hg = PartitionedHypergraph();
+    hypergraph = std::move(_original_hg);
+    _is_reordered = false;
+
+    PartitionedHypergraph original_phg(k, hypergraph, parallel_tag_t { });
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      original_phg.setOnlyNodePart(hn, part[hn]);
+    });
+    original_phg.initializePartition();
+    if ( target_graph ) {
+      original_phg.setTargetGraph(target_graph);
+    }
+    return original_phg;
+  }
+
+ private:
+  void computeNewNodeIDs(const Hypergraph& hypergraph) {
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    vec<HypernodeID> order(num_nodes);
+    if ( _context.preprocessing.node_ordering == NodeOrdering::bfs ) {
+      computeBFSOrder(hypergraph, order);
+    } else {
+      tbb_kahypar::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+        order[hn] = hn;
+      });
+      if ( _context.preprocessing.node_ordering == NodeOrdering::community ) {
+        // Nodes of the same community are placed consecutively
+        tbb_kahypar::parallel_sort(order.begin(), order.end(),
+          [&](const HypernodeID lhs, const HypernodeID rhs) {
+            return std::make_pair(hypergraph.communityID(lhs), lhs) <
+              std::make_pair(hypergraph.communityID(rhs), rhs);
+          });
+      } else if ( _context.preprocessing.node_ordering == NodeOrdering::degree ) {
+        // Nodes are grouped into buckets of exponentially increasing degree
+        auto bucket = [&](const HypernodeID hn) {
+          return utils::highest_set_bit_64(UL(hypergraph.nodeDegree(hn)) + 1);
+        };
+        tbb_kahypar::parallel_sort(order.begin(), order.end(),
+          [&](const HypernodeID lhs, const HypernodeID rhs) {
+            return std::make_pair(bucket(lhs), lhs) < std::make_pair(bucket(rhs), rhs);
+          });
+      }
+    }
+
+    _new_id.assign(num_nodes, kInvalidHypernode);
+    tbb_kahypar::parallel_for(ID(0), num_nodes, [&](const HypernodeID pos) {
+      _new_id[order[pos]] = pos;
+    });
+  }
+
+  // ! Breadth-first search order. Each net is expanded at most once,
+  // ! which bounds the running time by the number of pins.
+  void computeBFSOrder(const Hypergraph& hypergraph, vec<HypernodeID>& order) {
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    vec<bool> visited_node(num_nodes, false);
+    vec<bool> visited_edge(hypergraph.initialNumEdges(), false);
+    size_t head = 0;
+    size_t tail = 0;
+    for ( HypernodeID start = 0; start < num_nodes; ++start ) {
+      if ( !visited_node[start] ) {
+        visited_node[start] = true;
+        order[tail++] = start;
+        while ( head < tail ) {
+          const HypernodeID hn = order[head++];
+          for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+            if ( !visited_edge[he] ) {
+              visited_edge[he] = true;
+              for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+                if ( !visited_node[pin] ) {
+                  visited_node[pin] = true;
+                  order[tail++] = pin;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    ASSERT(tail == num_nodes);
+  }
+
+  Hypergraph constructReorderedHypergraph(const Hypergraph& hypergraph) {
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    const HyperedgeID num_edges = Hypergraph::is_graph ?
+      hypergraph.initialNumEdges() / 2 : hypergraph.initialNumEdges();
+    vec<size_t> edge_indices(num_edges + 1, 0);
+    vec<HypernodeID> pins;
+    vec<HyperedgeWeight> edge_weight(num_edges, 0);
+    vec<HypernodeWeight> node_weight(num_nodes, 0);
+    vec<PartitionID> community_ids(num_nodes, 0);
+    tbb_kahypar::parallel_invoke([&] {
+      if constexpr ( Hypergraph::is_graph ) {
+        // Each undirected edge is stored in both directions, but passed only once to the factory
+        pins.assign(2 * UL(num_edges), kInvalidHypernode);
+        hypergraph.doParallelForAllEdges([&](const HyperedgeID& e) {
+          const HypernodeID source = hypergraph.edgeSource(e);
+          const HypernodeID target = hypergraph.edgeTarget(e);
+          if ( source < target ) {
+            const HyperedgeID id = hypergraph.uniqueEdgeID(e);
+            pins[2 * UL(id)] = _new_id[source];
+            pins[2 * UL(id) + 1] = _new_id[target];
+            edge_weight[id] = hypergraph.edgeWeight(e);
+          }
+        });
+        tbb_kahypar::parallel_for(ID(0), num_edges + 1, [&](const HyperedgeID id) {
+          edge_indices[id] = 2 * UL(id);
+        });
+      } else {
+        for ( HyperedgeID he = 0; he < num_edges; ++he ) {
+          edge_indices[he + 1] = edge_indices[he] + hypergraph.edgeSize(he);
+        }
+        pins.assign(edge_indices[num_edges], kInvalidHypernode);
+        hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
+          size_t pos = edge_indices[he];
+          for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+            pins[pos++] = _new_id[pin];
+          }
+          edge_weight[he] = hypergraph.edgeWeight(he);
+        });
+      }
+    }, [&] {
+      hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+        node_weight[_new_id[hn]] = hypergraph.nodeWeight(hn);
+        community_ids[_new_id[hn]] = hypergraph.communityID(hn);
+      });
+    });
+
+    Hypergraph reordered_hg = HypergraphFactory::construct_from_csr(num_nodes, num_edges,
+      edge_indices.data(), pins.data(), edge_weight.data(), node_weight.data(),
+      _context.preprocessing.stable_construction_of_incident_edges);
+    reordered_hg.setCommunityIDs(std::move(community_ids));
+    return reordered_hg;
+  }
+
+  const Context& _context;
+  Hypergraph _original_hg;
+  vec<HypernodeID> _new_id;
+  bool _is_reordered;
+};
+
+}  // namespace mt_kahypar
@@ -71,6 +71,26 @@ class DegreeZeroHypernodeRemover {
 
   // ! Restore degree-zero vertices
   void restoreDegreeZeroHypernodes(PartitionedHypergraph& hypergraph) {
+    assignDegreeZeroHypernodes(hypergraph, _context, true);
+    _removed_hns.clear();
+  }
+
+  // ! Restore degree-zero vertices in several partitions of the same hypergraph.
+  // ! The vertices are reenabled in the hypergraph only once and each partition
+  // ! assigns them to its blocks based on its corresponding context.
+  void restoreDegreeZeroHypernodes(vec<PartitionedHypergraph>& partitions,
+                                   const vec<Context>& contexts) {
+    ASSERT(partitions.size() == contexts.size());
+    for ( size_t i = 0; i < partitions.size(); ++i ) {
+      assignDegreeZeroHypernodes(partitions[i], contexts[i], i == 0);
+    }
+    _removed_hns.clear();
+  }
+
+ private:
+  void assignDegreeZeroHypernodes(PartitionedHypergraph& hypergraph,
+                                  const Context& context,
+                                  const bool restore_in_hypergraph) {
     // Sort degree-zero vertices in decreasing order of their weight
     tbb_kahypar::parallel_sort(_removed_hns.begin(), _removed_hns.end(),
       [&](const HypernodeID& lhs, const HypernodeID& rhs) {
@@ -79,9 +99,9 @@ class DegreeZeroHypernodeRemover {
       });
     // Sort blocks of partition in increasing order of their weight
     auto distance_to_max = [&](const PartitionID block) {
-      return hypergraph.partWeight(block) - _context.partition.max_part_weights[block];
+      return hypergraph.partWeight(block) - context.partition.max_part_weights[block];
     };
-    parallel::scalable_vector<PartitionID> blocks(_context.partition.k, 0);
+    parallel::scalable_vector<PartitionID> blocks(context.partition.k, 0);
     std::iota(blocks.begin(), blocks.end(), 0);
     std::sort(blocks.begin(), blocks.end(),
       [&](const PartitionID& lhs, const PartitionID& rhs) {
@@ -91,18 +111,20 @@ class DegreeZeroHypernodeRemover {
     // Perform Bin-Packing
     for ( const HypernodeID& hn : _removed_hns ) {
       PartitionID to = blocks.front();
-      hypergraph.restoreDegreeZeroHypernode(hn, to);
+      if ( restore_in_hypergraph ) {
+        hypergraph.restoreDegreeZeroHypernode(hn, to);
+      } else {
+        hypergraph.setNodePart(hn, to);
+      }
       PartitionID i = 0;
-      while ( i + 1 < _context.partition.k &&
+      while ( i + 1 < context.partition.k &&
               distance_to_max(blocks[i]) > distance_to_max(blocks[i + 1]) ) {
         std::swap(blocks[i], blocks[i + 1]);
         ++i;
       }
     }
-    _removed_hns.clear();
   }
 
- private:
   const Context& _context;
   parallel::scalable_vector<HypernodeID> _removed_hns;
 };
@@ -92,6 +92,30 @@ class LargeHyperedgeRemover {
     }
   }
 
+  // ! Restores all previously removed large hyperedges in several partitions of
+  // ! the same hypergraph. The hyperedges are reinserted into the hypergraph via
+  // ! the first partition, all other partitions recompute their pin counts.
+  void restoreLargeHyperedges(vec<PartitionedHypergraph>& partitions) {
+    if ( partitions.empty() ) {
+      return;
+    }
+    restoreLargeHyperedges(partitions[0]);
+    if ( !_removed_hes.empty() ) {
+      for ( size_t i = 1; i < partitions.size(); ++i ) {
+        PartitionedHypergraph& phg = partitions[i];
+        vec<PartitionID> part_ids(phg.initialNumNodes(), kInvalidPartition);
+        phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+          part_ids[hn] = phg.partID(hn);
+        });
+        phg.resetData();
+        phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+          phg.setOnlyNodePart(hn, part_ids[hn]);
+        });
+        phg.initializePartition();
+      }
+    }
+  }
+
   HypernodeID largeHyperedgeThreshold() const {
     return std::max(
       _context.partition.large_hyperedge_size_threshold,
@@ -31,6 +31,7 @@
 #include "mt-kahypar/datastructures/concurrent_bucket_map.h"
 #include "mt-kahypar/datastructures/priority_queue.h"
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/execution_context.h"
 #include "mt-kahypar/parallel/work_stack.h"
 
 #include "kahypar-resources/datastructure/fast_reset_flag_array.h"
@@ -277,6 +278,10 @@ struct FMSharedData {
 
   bool release_nodes = true;
 
+  // ! Upper bound for the absolute gain values of the current level, if
+  // ! the vertex PQs should use bucket queues (0 = use binary heaps)
+  Gain vertexPQMaxKey = 0;
+
   FMSharedData(size_t numNodes, size_t numThreads) :
     numberOfNodes(numNodes),
     refinementNodes(), //numNodes, numThreads),
@@ -305,7 +310,7 @@ struct FMSharedData {
   FMSharedData(size_t numNodes) :
     FMSharedData(
       numNodes,
-      TBBInitializer::instance().total_number_of_threads())  { }
+      parallel::ExecutionContext::maxNumThreads())  { }
 
   FMSharedData() :
     FMSharedData(0, 0) { }
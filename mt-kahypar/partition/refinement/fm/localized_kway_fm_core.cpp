@@ -40,6 +40,12 @@ namespace mt_kahypar {
                                                   size_t taskID, size_t numSeeds) {
     localMoves.clear();
     thisSearch = ++sharedData.nodeTracker.highestActiveSearchID;
+    if ( vertexPQMaxKey != sharedData.vertexPQMaxKey ) {
+      vertexPQMaxKey = sharedData.vertexPQMaxKey;
+      for ( VertexPriorityQueue& pq : vertexPQs ) {
+        pq.setMaxKey(vertexPQMaxKey);
+      }
+    }
 
     HypernodeID seedNode;
     HypernodeID pushes = 0;
@@ -233,6 +239,7 @@ namespace mt_kahypar {
     }
     while ( static_cast<size_t>(new_k) > vertexPQs.size() ) {
       vertexPQs.emplace_back(sharedData.vertexPQHandles.data(), sharedData.numberOfNodes);
+      vertexPQs.back().setMaxKey(vertexPQMaxKey);
     }
   }
 
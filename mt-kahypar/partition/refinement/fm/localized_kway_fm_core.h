@@ -51,7 +51,7 @@ public:
   using DeltaGainCache = typename GraphAndGainTypes::DeltaGainCache;
   using DeltaPartitionedHypergraph = typename PartitionedHypergraph::template DeltaPartition<DeltaGainCache::requires_connectivity_set>;
   using BlockPriorityQueue = ds::ExclusiveHandleHeap< ds::MaxHeap<Gain, PartitionID> >;
-  using VertexPriorityQueue = ds::MaxHeap<Gain, HypernodeID>;    // these need external handles
+  using VertexPriorityQueue = ds::AdaptiveMaxQueue<Gain, HypernodeID>;    // these need external handles
 
 public:
   explicit LocalizedKWayFM(const Context& context,
@@ -60,6 +60,7 @@ public:
                            GainCache& gainCache) :
     context(context),
     thisSearch(0),
+    vertexPQMaxKey(0),
     deltaPhg(context),
     neighborDeduplicator(PartitionedHypergraph::is_graph ? 0 : numNodes, 0),
     gain_cache(gainCache),
@@ -100,6 +101,9 @@ private:
   // ! Unique search id associated with the current local search
   SearchID thisSearch;
 
+  // ! Key range of the bucket queues used as vertex PQs (0 = binary heaps)
+  Gain vertexPQMaxKey;
+
   // ! Local data members required for one localized search run
   //FMLocalData localData;
   vec< std::pair<Move, MoveID> > localMoves;
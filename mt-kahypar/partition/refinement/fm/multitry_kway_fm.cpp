@@ -27,12 +27,15 @@
 
 #include <set>
 
+#include <tbb_kahypar/parallel_reduce.h>
+
 #include "mt-kahypar/partition/refinement/fm/multitry_kway_fm.h"
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/utils/utilities.h"
 #include "mt-kahypar/partition/factories.h"   // TODO removing this could make compilation a lot faster
 #include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/parallel/execution_context.h"
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 #include "mt-kahypar/utils/memory_tree.h"
 #include "mt-kahypar/utils/cast.h"
@@ -99,8 +102,13 @@ namespace mt_kahypar {
     std::vector<HypernodeWeight> max_part_weights = setupMaxPartWeights(context);
     HighResClockTimepoint fm_start = std::chrono::high_resolution_clock::now();
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    const utils::TimeLimit& global_time_limit = utils::Utilities::instance().getTimeLimit(context.utility_id);
 
     for (size_t round = 0; round < context.refinement.fm.multitry_rounds; ++round) { // global multi try rounds
+      if ( global_time_limit.isCancelled() ) {
+        break;
+      }
+
       for (PartitionID i = 0; i < context.partition.k; ++i) {
         initialPartWeights[i] = phg.partWeight(i);
       }
@@ -130,7 +138,7 @@ namespace mt_kahypar {
       }
 
       timer.start_timer("find_moves", "Find Moves");
-      size_t num_tasks = std::min(num_border_nodes, size_t(TBBInitializer::instance().total_number_of_threads()));
+      size_t num_tasks = std::min(num_border_nodes, size_t(parallel::ExecutionContext::maxNumThreads()));
       sharedData.finishedTasks.store(0, std::memory_order_relaxed);
       fm_strategy->findMoves(utils::localized_fm_cast(ets_fm), hypergraph,
                              num_tasks, num_seeds, round);
@@ -239,7 +247,7 @@ namespace mt_kahypar {
           // our working queue for border nodes with which we initialize the localized
           // FM searches. For now, we do not know why this occurs but this prevents
           // the segmentation fault.
-          if ( task_id >= 0 && task_id < TBBInitializer::instance().total_number_of_threads() ) {
+          if ( task_id >= 0 && task_id < parallel::ExecutionContext::maxNumThreads() ) {
             for (HypernodeID u = r.begin(); u < r.end(); ++u) {
               if (phg.nodeIsEnabled(u) && phg.isBorderNode(u) && !phg.isFixed(u)) {
                 sharedData.refinementNodes.safe_push(u, task_id);
@@ -252,7 +260,7 @@ namespace mt_kahypar {
       tbb_kahypar::parallel_for(UL(0), refinement_nodes.size(), [&](const size_t i) {
         const HypernodeID u = refinement_nodes[i];
         const int task_id = tbb_kahypar::this_task_arena::current_thread_index();
-        if ( task_id >= 0 && task_id < TBBInitializer::instance().total_number_of_threads() ) {
+        if ( task_id >= 0 && task_id < parallel::ExecutionContext::maxNumThreads() ) {
           if (phg.nodeIsEnabled(u) && phg.isBorderNode(u) && !phg.isFixed(u)) {
             sharedData.refinementNodes.safe_push(u, task_id);
           }
@@ -416,6 +424,39 @@ namespace mt_kahypar {
     if (!gain_cache.isInitialized()) {
       gain_cache.initializeGainCache(phg);
     }
+    sharedData.vertexPQMaxKey = computeVertexPQMaxKey(phg);
+  }
+
+  template<typename GraphAndGainTypes>
+  Gain MultiTryKWayFM<GraphAndGainTypes>::computeVertexPQMaxKey(const PartitionedHypergraph& phg) const {
+    // The gain of a node is bounded by its weighted degree (twice that for the sum-of-external-degrees
+    // metric). Gains of the steiner tree metric are scaled by distances in the target graph, which is why
+    // we do not use bucket queues there. If the bound is violated anyway (e.g., due to the penalty terms
+    // of unconstrained FM), the vertex PQs fall back to binary heaps.
+    const Gain max_gain = context.refinement.fm.bucket_pq_max_gain;
+    if ( max_gain <= 0 || context.partition.objective == Objective::steiner_tree ) {
+      return 0;
+    }
+    const Gain max_weighted_degree = tbb_kahypar::parallel_reduce(
+      tbb_kahypar::blocked_range<HypernodeID>(ID(0), phg.initialNumNodes()), Gain(0),
+      [&](const tbb_kahypar::blocked_range<HypernodeID>& range, Gain init) {
+        Gain max_degree = init;
+        for (HypernodeID hn = range.begin(); hn < range.end(); ++hn) {
+          if ( phg.nodeIsEnabled(hn) ) {
+            Gain weighted_degree = 0;
+            for (const HyperedgeID& he : phg.incidentEdges(hn)) {
+              weighted_degree += phg.edgeWeight(he);
+            }
+            max_degree = std::max(max_degree, weighted_degree);
+          }
+        }
+        return max_degree;
+      }, [](const Gain& lhs, const Gain& rhs) {
+        return std::max(lhs, rhs);
+      });
+    const Gain bound = context.partition.objective == Objective::soed ?
+      2 * max_weighted_degree : max_weighted_degree;
+    return bound <= max_gain ? std::max(bound, Gain(1)) : 0;
   }
 
   template<typename GraphAndGainTypes>
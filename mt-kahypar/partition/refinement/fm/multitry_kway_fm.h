@@ -79,6 +79,8 @@ class MultiTryKWayFM final : public IRefiner {
 
   void initializeImpl(mt_kahypar_partitioned_hypergraph_t& phg) final ;
 
+  Gain computeVertexPQMaxKey(const PartitionedHypergraph& phg) const;
+
   void roundInitialization(PartitionedHypergraph& phg,
                            const vec<HypernodeID>& refinement_nodes);
 
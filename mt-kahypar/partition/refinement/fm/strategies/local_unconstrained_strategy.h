@@ -55,7 +55,7 @@ class LocalUnconstrainedStrategy {
 
  public:
   using BlockPriorityQueue = ds::ExclusiveHandleHeap< ds::MaxHeap<Gain, PartitionID> >;
-  using VertexPriorityQueue = ds::MaxHeap<Gain, HypernodeID>;    // these need external handles
+  using VertexPriorityQueue = ds::AdaptiveMaxQueue<Gain, HypernodeID>;    // these need external handles
 
   static constexpr bool uses_gain_cache = true;
   static constexpr bool maintain_gain_cache_between_rounds = true;
@@ -39,7 +39,7 @@ void CutGainCache::initializeGainCache(const PartitionedHypergraph& partitioned_
   ASSERT(!_is_initialized, "Gain cache is already initialized");
   ASSERT(_k <= 0 || _k >= partitioned_hg.k(),
     "Gain cache was already initialized for a different k" << V(_k) << V(partitioned_hg.k()));
-  allocateGainTable(partitioned_hg.topLevelNumNodes(), partitioned_hg.k());
+  allocateGainTable(partitioned_hg);
 
   // Gain calculation consist of two stages
   //  1. Compute gain of all low degree vertices
@@ -104,14 +104,16 @@ void CutGainCache::initializeGainCache(const PartitionedHypergraph& partitioned_
 
     // Aggregate thread locals to compute overall gain of the high degree vertex
     const HyperedgeWeight penalty_term = ets_mfp.combine(std::plus<HyperedgeWeight>());
-    _gain_cache[penalty_index(u)].store(penalty_term, std::memory_order_relaxed);
+    penalty_entry(u).store(penalty_term, std::memory_order_relaxed);
     for (PartitionID p = 0; p < _k; ++p) {
       HyperedgeWeight move_to_benefit = 0;
       for ( auto& l_move_to_benefit : ets_mtb ) {
         move_to_benefit += l_move_to_benefit[p];
         l_move_to_benefit[p] = 0;
       }
-      _gain_cache[benefit_index(u, p)].store(move_to_benefit, std::memory_order_relaxed);
+      if ( move_to_benefit != 0 || !_gain_cache.isSparse() ) {
+        benefit_entry(u, p).store(move_to_benefit, std::memory_order_relaxed);
+      }
     }
   }
 
@@ -141,26 +143,26 @@ void CutGainCache::deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
     if ( pin_count_in_from_part_after == edge_size - 1 ) {
       for ( const HypernodeID& u : partitioned_hg.pins(he) ) {
         ASSERT(nodeGainAssertions(u, from));
-        _gain_cache[penalty_index(u)].fetch_sub(edge_weight, std::memory_order_relaxed);
-        _gain_cache[benefit_index(u, from)].fetch_add(edge_weight, std::memory_order_relaxed);
+        penalty_entry(u).fetch_sub(edge_weight, std::memory_order_relaxed);
+        benefit_entry(u, from).fetch_add(edge_weight, std::memory_order_relaxed);
       }
     } else if ( pin_count_in_from_part_after == edge_size - 2 ) {
       for ( const HypernodeID& u : partitioned_hg.pins(he) ) {
         ASSERT(nodeGainAssertions(u, from));
-        _gain_cache[benefit_index(u, from)].fetch_sub(edge_weight, std::memory_order_relaxed);
+        benefit_entry(u, from).fetch_sub(edge_weight, std::memory_order_relaxed);
       }
     }
 
     if ( pin_count_in_to_part_after == edge_size ) {
       for ( const HypernodeID& u : partitioned_hg.pins(he) ) {
         ASSERT(nodeGainAssertions(u, to));
-        _gain_cache[penalty_index(u)].fetch_add(edge_weight, std::memory_order_relaxed);
-        _gain_cache[benefit_index(u, to)].fetch_sub(edge_weight, std::memory_order_relaxed);
+        penalty_entry(u).fetch_add(edge_weight, std::memory_order_relaxed);
+        benefit_entry(u, to).fetch_sub(edge_weight, std::memory_order_relaxed);
       }
     } else if ( pin_count_in_to_part_after == edge_size - 1 ) {
       for ( const HypernodeID& u : partitioned_hg.pins(he) ) {
         ASSERT(nodeGainAssertions(u, to));
-        _gain_cache[benefit_index(u, to)].fetch_add(edge_weight, std::memory_order_relaxed);
+        benefit_entry(u, to).fetch_add(edge_weight, std::memory_order_relaxed);
       }
     }
   }
@@ -194,26 +196,26 @@ void CutGainCache::uncontractUpdateAfterRestore(const PartitionedHypergraph& par
 
         for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
           if ( pin != v ) {
-            _gain_cache[benefit_index(pin, other_block)].fetch_sub(edge_weight, std::memory_order_relaxed);
+            benefit_entry(pin, other_block).fetch_sub(edge_weight, std::memory_order_relaxed);
           }
         }
       }
 
       for ( const PartitionID to : partitioned_hg.connectivitySet(he) ) {
         if ( partitioned_hg.pinCountInPart(he, to) == edge_size - 1 ) {
-          _gain_cache[benefit_index(v, to)].fetch_add(edge_weight, std::memory_order_relaxed);
+          benefit_entry(v, to).fetch_add(edge_weight, std::memory_order_relaxed);
         }
       }
     } else if ( pin_count_in_part_after == edge_size ) {
       // In this case, we have to add w(e) to the penalty term of v
-      _gain_cache[penalty_index(v)].fetch_add(edge_weight, std::memory_order_relaxed);
+      penalty_entry(v).fetch_add(edge_weight, std::memory_order_relaxed);
       if ( edge_size == 2 ) {
         // Special case: Hyperedge is not a single-pin net anymore. Since we do not consider
         // single-pin nets in the penalty terms, we have to add w(e) to the penalty term of u.
         for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
           if ( pin != v ) {
             // Note that u may be replaced by another uncontraction.
-            _gain_cache[penalty_index(pin)].fetch_add(edge_weight, std::memory_order_relaxed);
+            penalty_entry(pin).fetch_add(edge_weight, std::memory_order_relaxed);
           }
         }
       }
@@ -233,16 +235,16 @@ void CutGainCache::uncontractUpdateAfterReplacement(const PartitionedHypergraph&
       const HyperedgeWeight edge_weight = partitioned_hg.edgeWeight(he);
       if ( partitioned_hg.pinCountInPart(he, block) == edge_size ) {
         // u is no longer part of the hyperedge => transfer penalty term to v
-        _gain_cache[penalty_index(u)].fetch_sub(edge_weight, std::memory_order_relaxed);
-        _gain_cache[penalty_index(v)].fetch_add(edge_weight, std::memory_order_relaxed);
+        penalty_entry(u).fetch_sub(edge_weight, std::memory_order_relaxed);
+        penalty_entry(v).fetch_add(edge_weight, std::memory_order_relaxed);
       }
 
       if ( partitioned_hg.connectivity(he) == 2 ) {
         for ( const PartitionID to : partitioned_hg.connectivitySet(he) ) {
           if ( partitioned_hg.pinCountInPart(he, to) == edge_size - 1 ) {
             // u is no longer part of the hyperedge => transfer benefit term to v
-            _gain_cache[benefit_index(u, to)].fetch_sub(edge_weight, std::memory_order_relaxed);
-            _gain_cache[benefit_index(v, to)].fetch_add(edge_weight, std::memory_order_relaxed);
+            benefit_entry(u, to).fetch_sub(edge_weight, std::memory_order_relaxed);
+            benefit_entry(v, to).fetch_add(edge_weight, std::memory_order_relaxed);
           }
         }
       }
@@ -271,11 +273,8 @@ void CutGainCache::initializeGainCacheEntryForNode(const PartitionedHypergraph&
     }
   }
 
-  _gain_cache[penalty_index(u)].store(penalty, std::memory_order_relaxed);
-  for (PartitionID i = 0; i < _k; ++i) {
-    _gain_cache[benefit_index(u, i)].store(benefit_aggregator[i], std::memory_order_relaxed);
-    benefit_aggregator[i] = 0;
-  }
+  penalty_entry(u).store(penalty, std::memory_order_relaxed);
+  _gain_cache.storeBenefitTerms(partitioned_hg, u, benefit_aggregator);
 }
 
 
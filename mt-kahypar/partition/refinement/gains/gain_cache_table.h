@@ -0,0 +1,546 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <limits>
+#include <memory>
+
+#include <tbb_kahypar/parallel_for.h>
+#include <tbb_kahypar/concurrent_vector.h>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/range.h"
+
+namespace mt_kahypar {
+
+/**
+ * Storage for the benefit and penalty terms of the gain caches, which store a fixed
+ * number of entries per node (e.g., k + 1 for the connectivity metric).
+ *
+ * For static hypergraphs, the entries are stored in 16 bits if possible. Each entry of a node is
+ * bounded by its weighted degree (times a factor given by the gain cache), which is checked
+ * each time the gain cache is initialized. Nodes that do not fit are marked with a special value
+ * in their first compact entry and store their entries in a 32-bit side table instead. If too many
+ * nodes do not fit when the table is allocated, all entries are stored in 32 bits.
+ * Dynamic hypergraphs always use 32-bit entries, since the weighted degree of a node changes
+ * during uncontractions.
+ *
+ * The first entry of a node is its penalty term and entry i > 0 is its benefit term for block i - 1.
+ * For large k, the table can use a sparse layout instead, which only stores the benefit terms of
+ * blocks that were adjacent to a node since the last initialization. Each node has a small inline
+ * slab of (block, benefit) pairs, which is extended by overflow slabs of increasing size on demand.
+ * Slabs are never moved, such that existing entries can be updated without locking. Only inserting
+ * a block into the slab of a node requires its lock. The entry of a non-adjacent block is zero.
+ */
+class GainCacheTable {
+
+  using CompactValue = int16_t;
+
+  static constexpr CompactValue SPILL_MARKER = std::numeric_limits<CompactValue>::min();
+
+  // ! Number of benefit terms stored inline per node in the sparse layout
+  // ! (such that a node occupies one cache line)
+  static constexpr size_t SPARSE_INLINE_ENTRIES = 5;
+
+  struct SparseEntry {
+    PartitionID block = kInvalidPartition;
+    CAtomic<HyperedgeWeight> value;
+  };
+
+  struct SparseSlab {
+    explicit SparseSlab(const size_t capacity) :
+      entries(capacity),
+      next(nullptr) { }
+
+    vec<SparseEntry> entries;
+    SparseSlab* next;
+  };
+
+  struct SparseNode {
+    CAtomic<HyperedgeWeight> penalty;
+    // ! Number of entries in the inline and overflow slabs of the node
+    CAtomic<uint32_t> size;
+    SpinLock lock;
+    std::array<SparseEntry, SPARSE_INLINE_ENTRIES> entries;
+    SparseSlab* overflow = nullptr;
+  };
+
+ public:
+  // ! Nodes whose entries can exceed this value are stored in the side table. We leave
+  // ! some headroom, since concurrent delta gain updates can temporarily exceed the bound.
+  static constexpr HyperedgeWeight MAX_COMPACT_VALUE = std::numeric_limits<CompactValue>::max() / 2;
+
+  // ! If more nodes spill when the table is allocated, we use 32-bit entries
+  static constexpr double MAX_SPILL_FRACTION = 0.25;
+
+  // ! Reference to an entry, which behaves like a CAtomic<HyperedgeWeight>
+  class Entry {
+   public:
+    Entry(CAtomic<CompactValue>* compact, CAtomic<HyperedgeWeight>* wide) :
+      _compact(compact),
+      _wide(wide) { }
+
+    MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+    HyperedgeWeight load(const std::memory_order m = std::memory_order_seq_cst) const {
+      return _compact ? _compact->load(m) : _wide->load(m);
+    }
+
+    MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+    void store(const HyperedgeWeight value, const std::memory_order m = std::memory_order_seq_cst) {
+      if ( _compact ) {
+        ASSERT(value <= std::numeric_limits<CompactValue>::max() && value > SPILL_MARKER);
+        _compact->store(static_cast<CompactValue>(value), m);
+      } else {
+        _wide->store(value, m);
+      }
+    }
+
+    MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+    HyperedgeWeight fetch_add(const HyperedgeWeight value, const std::memory_order m = std::memory_order_seq_cst) {
+      return _compact ? _compact->fetch_add(static_cast<CompactValue>(value), m) : _wide->fetch_add(value, m);
+    }
+
+    MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+    HyperedgeWeight fetch_sub(const HyperedgeWeight value, const std::memory_order m = std::memory_order_seq_cst) {
+      return _compact ? _compact->fetch_sub(static_cast<CompactValue>(value), m) : _wide->fetch_sub(value, m);
+    }
+
+    MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+    HyperedgeWeight add_fetch(const HyperedgeWeight value, const std::memory_order m = std::memory_order_seq_cst) {
+      return fetch_add(value, m) + value;
+    }
+
+    MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+    HyperedgeWeight sub_fetch(const HyperedgeWeight value, const std::memory_order m = std::memory_order_seq_cst) {
+      return fetch_sub(value, m) - value;
+    }
+
+   private:
+    CAtomic<CompactValue>* _compact;
+    CAtomic<HyperedgeWeight>* _wide;
+  };
+
+  // ! Iterates over all blocks or, in the sparse layout, over the blocks with a
+  // ! non-zero entry of a node
+  class AdjacentBlocksIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = PartitionID;
+    using reference = PartitionID&;
+    using pointer = PartitionID*;
+    using difference_type = std::ptrdiff_t;
+
+    AdjacentBlocksIterator(const SparseNode* node, const size_t pos, const size_t end) :
+      _node(node),
+      _slab(nullptr),
+      _slab_begin(0),
+      _pos(pos),
+      _end(end) {
+      if ( _node ) {
+        next_valid_entry();
+      }
+    }
+
+    PartitionID operator*() const {
+      return _node ? current().block : static_cast<PartitionID>(_pos);
+    }
+
+    AdjacentBlocksIterator& operator++() {
+      ++_pos;
+      if ( _node ) {
+        next_valid_entry();
+      }
+      return *this;
+    }
+
+    bool operator==(const AdjacentBlocksIterator& o) const {
+      return _pos == o._pos && _end == o._end;
+    }
+
+    bool operator!=(const AdjacentBlocksIterator& o) const {
+      return !operator==(o);
+    }
+
+   private:
+    const SparseEntry& current() const {
+      return _pos < SPARSE_INLINE_ENTRIES ? _node->entries[_pos] : _slab->entries[_pos - _slab_begin];
+    }
+
+    void next_valid_entry() {
+      while ( _pos < _end ) {
+        if ( _pos == SPARSE_INLINE_ENTRIES ) {
+          _slab = _node->overflow;
+          _slab_begin = _pos;
+        } else if ( _slab && _pos - _slab_begin == _slab->entries.size() ) {
+          _slab_begin = _pos;
+          _slab = _slab->next;
+        }
+        if ( current().value.load(std::memory_order_relaxed) != 0 ) {
+          break;
+        }
+        ++_pos;
+      }
+    }
+
+    const SparseNode* _node;
+    const SparseSlab* _slab;
+    size_t _slab_begin;
+    size_t _pos;
+    size_t _end;
+  };
+
+  explicit GainCacheTable(const bool use_sparse_layout = false) :
+    _entries_per_node(0),
+    _num_nodes(0),
+    _num_blocks(0),
+    _is_compact(false),
+    _use_sparse_layout(use_sparse_layout),
+    _compact_entries(),
+    _wide_entries(),
+    _spill_entries(),
+    _spilled_nodes(),
+    _sparse_nodes(),
+    _sparse_slabs(),
+    _sparse_slab_lock() { }
+
+  GainCacheTable(const GainCacheTable&) = delete;
+  GainCacheTable & operator= (const GainCacheTable &) = delete;
+
+  GainCacheTable(GainCacheTable&& other) = default;
+  GainCacheTable & operator= (GainCacheTable&& other) = default;
+
+  // ! Expected size of an entry (assuming that only few nodes spill)
+  static constexpr size_t size_of_entry(const bool is_static_hypergraph) {
+    return is_static_hypergraph ? sizeof(CAtomic<CompactValue>) : sizeof(CAtomic<HyperedgeWeight>);
+  }
+
+  // ! Size of the inline slab and penalty term of a node in the sparse layout
+  static constexpr size_t size_of_sparse_node() {
+    return sizeof(SparseNode);
+  }
+
+  bool isAllocated() const {
+    return _entries_per_node > 0;
+  }
+
+  bool isCompact() const {
+    return _is_compact;
+  }
+
+  bool isSparse() const {
+    return _use_sparse_layout;
+  }
+
+  // ! Number of entries (including the ones of spilled nodes)
+  size_t size() const {
+    return _num_nodes * _entries_per_node;
+  }
+
+  size_t numSpilledNodes() const {
+    return _spilled_nodes.size();
+  }
+
+  size_t size_in_bytes() const {
+    size_t size_of_overflow_slabs = 0;
+    for ( const auto& slab : _sparse_slabs ) {
+      size_of_overflow_slabs += slab->entries.size() * sizeof(SparseEntry);
+    }
+    return _compact_entries.size() * sizeof(CAtomic<CompactValue>) +
+      _wide_entries.size() * sizeof(CAtomic<HyperedgeWeight>) +
+      _spill_entries.capacity() * sizeof(CAtomic<HyperedgeWeight>) +
+      _sparse_nodes.size() * sizeof(SparseNode) + size_of_overflow_slabs;
+  }
+
+  // ! Allocates the table on the first call and determines which nodes of the current
+  // ! hypergraph must be stored in the side table. Must be called before the entries are
+  // ! initialized. Entries of a node are bounded by factor times its weighted degree.
+  template<typename PartitionedHypergraph>
+  void prepare(const PartitionedHypergraph& partitioned_hg,
+               const size_t entries_per_node,
+               const HyperedgeWeight factor) {
+    ASSERT(entries_per_node >= 3);
+    tbb_kahypar::concurrent_vector<HypernodeID> heavy_nodes;
+    if constexpr ( PartitionedHypergraph::is_static_hypergraph ) {
+      if ( !_use_sparse_layout ) {
+        partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+          HyperedgeWeight weighted_degree = 0;
+          for ( const HyperedgeID& he : partitioned_hg.incidentEdges(hn) ) {
+            weighted_degree += partitioned_hg.edgeWeight(he);
+            if ( factor * weighted_degree > MAX_COMPACT_VALUE ) {
+              heavy_nodes.push_back(hn);
+              break;
+            }
+          }
+        });
+      }
+    }
+
+    if ( !isAllocated() ) {
+      const size_t num_nodes = partitioned_hg.topLevelNumNodes();
+      _entries_per_node = entries_per_node;
+      _num_nodes = num_nodes;
+      _num_blocks = entries_per_node - 1;
+      _is_compact = PartitionedHypergraph::is_static_hypergraph && !_use_sparse_layout &&
+        heavy_nodes.size() <= MAX_SPILL_FRACTION * num_nodes;
+      if ( _use_sparse_layout ) {
+        _sparse_nodes.resize("Refinement", "gain_cache", num_nodes, true);
+      } else if ( _is_compact ) {
+        _compact_entries.resize("Refinement", "gain_cache", num_nodes * entries_per_node, true);
+      } else {
+        _wide_entries.resize("Refinement", "gain_cache", num_nodes * entries_per_node, true);
+      }
+    }
+    ASSERT(entries_per_node == _entries_per_node);
+
+    if ( _is_compact ) {
+      // Reset spilled nodes of the previous initialization
+      for ( const HypernodeID& hn : _spilled_nodes ) {
+        _compact_entries[compact_index(hn)].store(0, std::memory_order_relaxed);
+      }
+      _spilled_nodes.assign(heavy_nodes.begin(), heavy_nodes.end());
+      _spill_entries.assign(_spilled_nodes.size() * _entries_per_node, CAtomic<HyperedgeWeight>(0));
+      tbb_kahypar::parallel_for(UL(0), _spilled_nodes.size(), [&](const size_t slot) {
+        const size_t idx = compact_index(_spilled_nodes[slot]);
+        _compact_entries[idx].store(SPILL_MARKER, std::memory_order_relaxed);
+        _compact_entries[idx + 1].store(static_cast<CompactValue>(slot & 0xFFFF), std::memory_order_relaxed);
+        _compact_entries[idx + 2].store(static_cast<CompactValue>(slot >> 16), std::memory_order_relaxed);
+      });
+    } else if ( _use_sparse_layout ) {
+      // Drop the entries of the previous initialization
+      tbb_kahypar::parallel_for(UL(0), _num_nodes, [&](const size_t u) {
+        _sparse_nodes[u].size.store(0, std::memory_order_relaxed);
+        _sparse_nodes[u].overflow = nullptr;
+      });
+      _sparse_slabs.clear();
+    }
+  }
+
+  // ! Returns the i-th entry of node u
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  Entry entry(const HypernodeID u, const size_t i) {
+    ASSERT(i < _entries_per_node);
+    if ( _is_compact ) {
+      const size_t idx = compact_index(u);
+      if ( _compact_entries[idx].load(std::memory_order_relaxed) != SPILL_MARKER ) {
+        return Entry(&_compact_entries[idx + i], nullptr);
+      }
+      return Entry(nullptr, &_spill_entries[spill_slot(idx) * _entries_per_node + i]);
+    } else if ( _use_sparse_layout ) {
+      SparseNode& node = _sparse_nodes[u];
+      return Entry(nullptr, i == 0 ? &node.penalty :
+        &find_or_insert_sparse_entry(node, static_cast<PartitionID>(i - 1)).value);
+    }
+    return Entry(nullptr, &_wide_entries[compact_index(u) + i]);
+  }
+
+  // ! Returns the value of the i-th entry of node u
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight load(const HypernodeID u, const size_t i) const {
+    ASSERT(i < _entries_per_node);
+    if ( _is_compact ) {
+      const size_t idx = compact_index(u);
+      if ( _compact_entries[idx].load(std::memory_order_relaxed) != SPILL_MARKER ) {
+        return _compact_entries[idx + i].load(std::memory_order_relaxed);
+      }
+      return _spill_entries[spill_slot(idx) * _entries_per_node + i].load(std::memory_order_relaxed);
+    } else if ( _use_sparse_layout ) {
+      const SparseNode& node = _sparse_nodes[u];
+      if ( i == 0 ) {
+        return node.penalty.load(std::memory_order_relaxed);
+      }
+      const SparseEntry* entry = find_sparse_entry(node, static_cast<PartitionID>(i - 1));
+      return entry ? entry->value.load(std::memory_order_relaxed) : 0;
+    }
+    return _wide_entries[compact_index(u) + i].load(std::memory_order_relaxed);
+  }
+
+  // ! Stores the benefit terms of node u accumulated in the aggregator and resets it.
+  // ! In the sparse layout, only the blocks of the incident nets are visited.
+  template<typename PartitionedHypergraph>
+  void storeBenefitTerms(const PartitionedHypergraph& partitioned_hg,
+                         const HypernodeID u,
+                         vec<HyperedgeWeight>& benefit_aggregator) {
+    if ( _use_sparse_layout ) {
+      for ( const HyperedgeID& he : partitioned_hg.incidentEdges(u) ) {
+        for ( const PartitionID& block : partitioned_hg.connectivitySet(he) ) {
+          if ( benefit_aggregator[block] != 0 ) {
+            entry(u, block + 1).store(benefit_aggregator[block], std::memory_order_relaxed);
+            benefit_aggregator[block] = 0;
+          }
+        }
+      }
+    } else {
+      for ( PartitionID p = 0; p < static_cast<PartitionID>(_entries_per_node - 1); ++p ) {
+        entry(u, p + 1).store(benefit_aggregator[p], std::memory_order_relaxed);
+        benefit_aggregator[p] = 0;
+      }
+    }
+  }
+
+  // ! Returns whether the benefit term of node u for block p is stored (always true
+  // ! for the dense layouts)
+  bool blockIsAdjacent(const HypernodeID u, const PartitionID p) const {
+    if ( _use_sparse_layout ) {
+      const SparseEntry* entry = find_sparse_entry(_sparse_nodes[u], p);
+      return entry && entry->value.load(std::memory_order_relaxed) != 0;
+    }
+    return true;
+  }
+
+  // ! Returns the blocks adjacent to node u (all blocks for the dense layouts)
+  IteratorRange<AdjacentBlocksIterator> adjacentBlocks(const HypernodeID u) const {
+    if ( _use_sparse_layout ) {
+      const SparseNode* node = &_sparse_nodes[u];
+      const size_t size = node->size.load(std::memory_order_acquire);
+      return IteratorRange<AdjacentBlocksIterator>(
+        AdjacentBlocksIterator(node, 0, size), AdjacentBlocksIterator(node, size, size));
+    }
+    return IteratorRange<AdjacentBlocksIterator>(
+      AdjacentBlocksIterator(nullptr, 0, _num_blocks),
+      AdjacentBlocksIterator(nullptr, _num_blocks, _num_blocks));
+  }
+
+  void changeNumberOfBlocks(const PartitionID new_k) {
+    ASSERT(static_cast<size_t>(new_k) <= _num_blocks);
+    _num_blocks = new_k;
+  }
+
+ private:
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  size_t compact_index(const HypernodeID u) const {
+    return size_t(u) * _entries_per_node;
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  size_t spill_slot(const size_t idx) const {
+    return static_cast<uint16_t>(_compact_entries[idx + 1].load(std::memory_order_relaxed)) |
+      ( size_t(static_cast<uint16_t>(_compact_entries[idx + 2].load(std::memory_order_relaxed))) << 16 );
+  }
+
+  // ! Returns the entry of block p in the sparse layout (or nullptr if the block was
+  // ! not adjacent to the node since the last initialization)
+  const SparseEntry* find_sparse_entry(const SparseNode& node, const PartitionID p) const {
+    // Entries are published by incrementing the size of the node
+    const size_t size = node.size.load(std::memory_order_acquire);
+    const size_t num_inline_entries = std::min(size, SPARSE_INLINE_ENTRIES);
+    for ( size_t i = 0; i < num_inline_entries; ++i ) {
+      if ( node.entries[i].block == p ) {
+        return &node.entries[i];
+      }
+    }
+    size_t remaining = size - num_inline_entries;
+    for ( const SparseSlab* slab = node.overflow; remaining > 0; slab = slab->next ) {
+      const size_t num_entries = std::min(remaining, slab->entries.size());
+      for ( size_t i = 0; i < num_entries; ++i ) {
+        if ( slab->entries[i].block == p ) {
+          return &slab->entries[i];
+        }
+      }
+      remaining -= num_entries;
+    }
+    return nullptr;
+  }
+
+  SparseEntry& find_or_insert_sparse_entry(SparseNode& node, const PartitionID p) {
+    SparseEntry* entry = const_cast<SparseEntry*>(find_sparse_entry(node, p));
+    if ( !entry ) {
+      node.lock.lock();
+      // Another thread may have inserted the block in the meantime
+      entry = const_cast<SparseEntry*>(find_sparse_entry(node, p));
+      if ( !entry ) {
+        entry = &append_sparse_entry(node, p);
+      }
+      node.lock.unlock();
+    }
+    return *entry;
+  }
+
+  // ! Appends an entry for block p to the slabs of the node. The caller must hold
+  // ! the lock of the node.
+  SparseEntry& append_sparse_entry(SparseNode& node, const PartitionID p) {
+    const size_t size = node.size.load(std::memory_order_relaxed);
+    SparseEntry* entry = nullptr;
+    if ( size < SPARSE_INLINE_ENTRIES ) {
+      entry = &node.entries[size];
+    } else {
+      size_t pos = size - SPARSE_INLINE_ENTRIES;
+      size_t capacity = SPARSE_INLINE_ENTRIES;
+      SparseSlab** slab = &node.overflow;
+      while ( *slab && pos >= (*slab)->entries.size() ) {
+        pos -= (*slab)->entries.size();
+        capacity += (*slab)->entries.size();
+        slab = &(*slab)->next;
+      }
+      if ( !*slab ) {
+        // All slabs are full => double the capacity of the node
+        ASSERT(pos == 0 && capacity < _entries_per_node - 1);
+        *slab = allocate_sparse_slab(std::min(capacity, _entries_per_node - 1 - capacity));
+      }
+      entry = &(*slab)->entries[pos];
+    }
+    entry->block = p;
+    entry->value.store(0, std::memory_order_relaxed);
+    node.size.store(size + 1, std::memory_order_release);
+    return *entry;
+  }
+
+  SparseSlab* allocate_sparse_slab(const size_t capacity) {
+    std::unique_ptr<SparseSlab> slab = std::make_unique<SparseSlab>(capacity);
+    SparseSlab* ptr = slab.get();
+    _sparse_slab_lock.lock();
+    _sparse_slabs.emplace_back(std::move(slab));
+    _sparse_slab_lock.unlock();
+    return ptr;
+  }
+
+  size_t _entries_per_node;
+  size_t _num_nodes;
+  // ! Number of blocks returned by adjacentBlocks(u) for the dense layouts
+  size_t _num_blocks;
+  bool _is_compact;
+  bool _use_sparse_layout;
+
+  // ! 16-bit entries of each node (if compact)
+  ds::Array< CAtomic<CompactValue> > _compact_entries;
+  // ! 32-bit entries of each node (if not compact)
+  ds::Array< CAtomic<HyperedgeWeight> > _wide_entries;
+  // ! 32-bit entries of nodes that do not fit into 16 bits
+  vec< CAtomic<HyperedgeWeight> > _spill_entries;
+  vec<HypernodeID> _spilled_nodes;
+  // ! Penalty term and inline slab of each node (if sparse)
+  ds::Array<SparseNode> _sparse_nodes;
+  // ! Owns the overflow slabs of all nodes (if sparse)
+  vec< std::unique_ptr<SparseSlab> > _sparse_slabs;
+  SpinLock _sparse_slab_lock;
+};
+
+}  // namespace mt_kahypar
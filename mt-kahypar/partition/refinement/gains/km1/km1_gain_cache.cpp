@@ -39,7 +39,7 @@ void Km1GainCache::initializeGainCache(const PartitionedHypergraph& partitioned_
   ASSERT(!_is_initialized, "Gain cache is already initialized");
   ASSERT(_k <= 0 || _k >= partitioned_hg.k(),
     "Gain cache was already initialized for a different k" << V(_k) << V(partitioned_hg.k()));
-  allocateGainTable(partitioned_hg.topLevelNumNodes(), partitioned_hg.k());
+  allocateGainTable(partitioned_hg);
 
 
   // Gain calculation consist of two stages
@@ -100,14 +100,16 @@ void Km1GainCache::initializeGainCache(const PartitionedHypergraph& partitioned_
 
     // Aggregate thread locals to compute overall gain of the high degree vertex
     const HyperedgeWeight penalty_term = ets_mfp.combine(std::plus<HyperedgeWeight>());
-    _gain_cache[penalty_index(u)].store(penalty_term, std::memory_order_relaxed);
+    penalty_entry(u).store(penalty_term, std::memory_order_relaxed);
     for (PartitionID p = 0; p < _k; ++p) {
       HyperedgeWeight move_to_benefit = 0;
       for ( auto& l_move_to_benefit : ets_mtb ) {
         move_to_benefit += l_move_to_benefit[p];
         l_move_to_benefit[p] = 0;
       }
-      _gain_cache[benefit_index(u, p)].store(move_to_benefit, std::memory_order_relaxed);
+      if ( move_to_benefit != 0 || !_gain_cache.isSparse() ) {
+        benefit_entry(u, p).store(move_to_benefit, std::memory_order_relaxed);
+      }
     }
   }
 
@@ -135,26 +137,26 @@ void Km1GainCache::deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
     for (const HypernodeID& u : partitioned_hg.pins(he)) {
       ASSERT(nodeGainAssertions(u, from));
       if (partitioned_hg.partID(u) == from) {
-        _gain_cache[penalty_index(u)].fetch_sub(edge_weight, std::memory_order_relaxed);
+        penalty_entry(u).fetch_sub(edge_weight, std::memory_order_relaxed);
       }
     }
   } else if (pin_count_in_from_part_after == 0) {
     for (const HypernodeID& u : partitioned_hg.pins(he)) {
       ASSERT(nodeGainAssertions(u, from));
-      _gain_cache[benefit_index(u, from)].fetch_sub(edge_weight, std::memory_order_relaxed);
+      benefit_entry(u, from).fetch_sub(edge_weight, std::memory_order_relaxed);
     }
   }
 
   if (pin_count_in_to_part_after == 1) {
     for (const HypernodeID& u : partitioned_hg.pins(he)) {
       ASSERT(nodeGainAssertions(u, to));
-      _gain_cache[benefit_index(u, to)].fetch_add(edge_weight, std::memory_order_relaxed);
+      benefit_entry(u, to).fetch_add(edge_weight, std::memory_order_relaxed);
     }
   } else if (pin_count_in_to_part_after == 2) {
     for (const HypernodeID& u : partitioned_hg.pins(he)) {
       ASSERT(nodeGainAssertions(u, to));
       if (partitioned_hg.partID(u) == to) {
-        _gain_cache[penalty_index(u)].fetch_add(edge_weight, std::memory_order_relaxed);
+        penalty_entry(u).fetch_add(edge_weight, std::memory_order_relaxed);
       }
     }
   }
@@ -178,17 +180,17 @@ void Km1GainCache::uncontractUpdateAfterRestore(const PartitionedHypergraph& par
       // add edge weight.
       for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
         if ( pin != v && partitioned_hg.partID(pin) == block ) {
-          _gain_cache[penalty_index(pin)].add_fetch(edge_weight, std::memory_order_relaxed);
+          penalty_entry(pin).add_fetch(edge_weight, std::memory_order_relaxed);
           break;
         }
       }
     }
 
-    _gain_cache[penalty_index(v)].add_fetch(edge_weight, std::memory_order_relaxed);
+    penalty_entry(v).add_fetch(edge_weight, std::memory_order_relaxed);
     // For all blocks contained in the connectivity set of hyperedge he
     // we increase the b(u, block) for vertex v by w(e)
     for ( const PartitionID block : partitioned_hg.connectivitySet(he) ) {
-      _gain_cache[benefit_index(v, block)].add_fetch(
+      benefit_entry(v, block).add_fetch(
         edge_weight, std::memory_order_relaxed);
     }
   }
@@ -207,21 +209,21 @@ void Km1GainCache::uncontractUpdateAfterReplacement(const PartitionedHypergraph&
     // Since u is no longer incident to hyperedge he its contribution for decreasing
     // the connectivity of he is shifted to vertex v
     if ( partitioned_hg.pinCountInPart(he, block) == 1 ) {
-      _gain_cache[penalty_index(u)].add_fetch(edge_weight, std::memory_order_relaxed);
-      _gain_cache[penalty_index(v)].sub_fetch(edge_weight, std::memory_order_relaxed);
+      penalty_entry(u).add_fetch(edge_weight, std::memory_order_relaxed);
+      penalty_entry(v).sub_fetch(edge_weight, std::memory_order_relaxed);
     }
 
-    _gain_cache[penalty_index(u)].sub_fetch(
+    penalty_entry(u).sub_fetch(
       edge_weight, std::memory_order_relaxed);
-    _gain_cache[penalty_index(v)].add_fetch(
+    penalty_entry(v).add_fetch(
       edge_weight, std::memory_order_relaxed);
     // For all blocks contained in the connectivity set of hyperedge he
     // we increase the move_to_benefit for vertex v by w(e) and decrease
     // it for vertex u by w(e)
     for ( const PartitionID block : partitioned_hg.connectivitySet(he) ) {
-      _gain_cache[benefit_index(u, block)].sub_fetch(
+      benefit_entry(u, block).sub_fetch(
         edge_weight, std::memory_order_relaxed);
-      _gain_cache[benefit_index(v, block)].add_fetch(
+      benefit_entry(v, block).add_fetch(
         edge_weight, std::memory_order_relaxed);
     }
   }
@@ -231,7 +233,7 @@ void Km1GainCache::restoreSinglePinHyperedge(const HypernodeID u,
                                              const PartitionID block_of_u,
                                              const HyperedgeWeight weight_of_he) {
   if ( _is_initialized ) {
-    _gain_cache[benefit_index(u, block_of_u)].add_fetch(
+    benefit_entry(u, block_of_u).add_fetch(
       weight_of_he, std::memory_order_relaxed);
   }
 }
@@ -252,11 +254,8 @@ void Km1GainCache::initializeGainCacheEntryForNode(const PartitionedHypergraph&
     }
   }
 
-  _gain_cache[penalty_index(u)].store(penalty, std::memory_order_relaxed);
-  for (PartitionID i = 0; i < _k; ++i) {
-    _gain_cache[benefit_index(u, i)].store(benefit_aggregator[i], std::memory_order_relaxed);
-    benefit_aggregator[i] = 0;
-  }
+  penalty_entry(u).store(penalty, std::memory_order_relaxed);
+  _gain_cache.storeBenefitTerms(partitioned_hg, u, benefit_aggregator);
 }
 
 namespace {
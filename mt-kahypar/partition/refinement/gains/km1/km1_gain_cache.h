@@ -38,6 +38,7 @@
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/utils/range.h"
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/refinement/gains/gain_cache_table.h"
 
 namespace mt_kahypar {
 
@@ -66,7 +67,7 @@ class Km1GainCache {
 
   static constexpr HyperedgeID HIGH_DEGREE_THRESHOLD = ID(100000);
 
-  using AdjacentBlocksIterator = IntegerRangeIterator<PartitionID>::const_iterator;
+  using AdjacentBlocksIterator = GainCacheTable::AdjacentBlocksIterator;
 
  public:
 
@@ -78,14 +79,12 @@ class Km1GainCache {
   Km1GainCache() :
     _is_initialized(false),
     _k(kInvalidPartition),
-    _gain_cache(),
-    _dummy_adjacent_blocks() { }
+    _gain_cache() { }
 
-  Km1GainCache(const Context&) :
+  Km1GainCache(const Context& context) :
     _is_initialized(false),
     _k(),
-    _gain_cache(),
-    _dummy_adjacent_blocks() { }
+    _gain_cache(context.refinement.sparse_gain_cache) { }
 
   Km1GainCache(const Km1GainCache&) = delete;
   Km1GainCache & operator= (const Km1GainCache &) = delete;
@@ -119,15 +118,14 @@ class Km1GainCache {
   }
 
   // ! Returns whether the block is adjacent to the node
-  bool blockIsAdjacent(const HypernodeID, const PartitionID) const {
-    return true;
+  bool blockIsAdjacent(const HypernodeID hn, const PartitionID block) const {
+    return _gain_cache.blockIsAdjacent(hn, block);
   }
 
-  IteratorRange<AdjacentBlocksIterator> adjacentBlocks(const HypernodeID) const {
-    // We do not maintain the adjacent blocks of a node in this gain cache.
-    // We therefore return an iterator over all blocks here
-    return IteratorRange<AdjacentBlocksIterator>(
-      _dummy_adjacent_blocks.cbegin(), _dummy_adjacent_blocks.cend());
+  IteratorRange<AdjacentBlocksIterator> adjacentBlocks(const HypernodeID hn) const {
+    // Adjacent blocks are only tracked if the gain cache uses the sparse layout.
+    // Otherwise, we return an iterator over all blocks here
+    return _gain_cache.adjacentBlocks(hn);
   }
 
   // ####################### Gain Computation #######################
@@ -138,7 +136,7 @@ class Km1GainCache {
   HyperedgeWeight penaltyTerm(const HypernodeID u,
                               const PartitionID /* only relevant for graphs */) const {
     ASSERT(_is_initialized, "Gain cache is not initialized");
-    return _gain_cache[penalty_index(u)].load(std::memory_order_relaxed);
+    return _gain_cache.load(u, 0);
   }
 
   // ! Recomputes the penalty term entry in the gain cache
@@ -147,7 +145,7 @@ class Km1GainCache {
   void recomputeInvalidTerms(const PartitionedHypergraph& partitioned_hg,
                              const HypernodeID u) {
     ASSERT(_is_initialized, "Gain cache is not initialized");
-    _gain_cache[penalty_index(u)].store(recomputePenaltyTerm(
+    penalty_entry(u).store(recomputePenaltyTerm(
       partitioned_hg, u), std::memory_order_relaxed);
   }
 
@@ -156,7 +154,7 @@ class Km1GainCache {
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   HyperedgeWeight benefitTerm(const HypernodeID u, const PartitionID to) const {
     ASSERT(_is_initialized, "Gain cache is not initialized");
-    return _gain_cache[benefit_index(u, to)].load(std::memory_order_relaxed);
+    return _gain_cache.load(u, to + 1);
   }
 
   // ! Returns the gain of moving node u from its current block to a target block V_j.
@@ -263,7 +261,7 @@ class Km1GainCache {
 
   void changeNumberOfBlocks(const PartitionID new_k) {
     ASSERT(new_k <= _k);
-    _dummy_adjacent_blocks = IntegerRangeIterator<PartitionID>(new_k);
+    _gain_cache.changeNumberOfBlocks(new_k);
   }
 
   template<typename PartitionedHypergraph>
@@ -285,17 +283,30 @@ class Km1GainCache {
     return size_t(u) * ( _k + 1 )  + p + 1;
   }
 
-  // ! Allocates the memory required to store the gain cache
-  void allocateGainTable(const HypernodeID num_nodes,
-                         const PartitionID k) {
-    if (_gain_cache.size() == 0 && k != kInvalidPartition) {
+  // ! Allocates the memory required to store the gain cache and determines the
+  // ! nodes whose entries do not fit into the compact representation
+  template<typename PartitionedHypergraph>
+  void allocateGainTable(const PartitionedHypergraph& partitioned_hg) {
+    const PartitionID k = partitioned_hg.k();
+    if (!_gain_cache.isAllocated() && k != kInvalidPartition) {
       _k = k;
-      _dummy_adjacent_blocks = IntegerRangeIterator<PartitionID>(k);
-      _gain_cache.resize(
-        "Refinement", "gain_cache", num_nodes * size_t(_k + 1), true);
+    }
+    if (k != kInvalidPartition) {
+      // Each entry of a node is bounded by its weighted degree
+      _gain_cache.prepare(partitioned_hg, size_t(_k + 1), 1);
     }
   }
 
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  GainCacheTable::Entry penalty_entry(const HypernodeID u) {
+    return _gain_cache.entry(u, 0);
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  GainCacheTable::Entry benefit_entry(const HypernodeID u, const PartitionID p) {
+    return _gain_cache.entry(u, p + 1);
+  }
+
   // ! Initializes the benefit and penalty terms for a node u
   template<typename PartitionedHypergraph>
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
@@ -325,11 +336,9 @@ class Km1GainCache {
   // ! Number of blocks
   PartitionID _k;
 
-  // ! Array of size |V| * (k + 1), which stores the benefit and penalty terms of each node.
-  ds::Array< CAtomic<HyperedgeWeight> > _gain_cache;
-
-  // ! Provides an iterator from 0 to k (:= number of blocks)
-  IntegerRangeIterator<PartitionID> _dummy_adjacent_blocks;
+  // ! Table of size |V| * (k + 1), which stores the benefit and penalty terms of each node
+  // ! (in 16 bits if they fit or only for adjacent blocks if sparse, see GainCacheTable).
+  GainCacheTable _gain_cache;
 };
 
 /**
@@ -39,7 +39,7 @@ void SoedGainCache::initializeGainCache(const PartitionedHypergraph& partitioned
   ASSERT(!_is_initialized, "Gain cache is already initialized");
   ASSERT(_k <= 0 || _k >= partitioned_hg.k(),
     "Gain cache was already initialized for a different k" << V(_k) << V(partitioned_hg.k()));
-  allocateGainTable(partitioned_hg.topLevelNumNodes(), partitioned_hg.k());
+  allocateGainTable(partitioned_hg);
 
 
   // Gain calculation consist of two stages
@@ -106,14 +106,16 @@ void SoedGainCache::initializeGainCache(const PartitionedHypergraph& partitioned
 
     // Aggregate thread locals to compute overall gain of the high degree vertex
     const HyperedgeWeight penalty_term = ets_mfp.combine(std::plus<HyperedgeWeight>());
-    _gain_cache[penalty_index(u)].store(penalty_term, std::memory_order_relaxed);
+    penalty_entry(u).store(penalty_term, std::memory_order_relaxed);
     for (PartitionID p = 0; p < _k; ++p) {
       HyperedgeWeight move_to_benefit = 0;
       for ( auto& l_move_to_benefit : ets_mtb ) {
         move_to_benefit += l_move_to_benefit[p];
         l_move_to_benefit[p] = 0;
       }
-      _gain_cache[benefit_index(u, p)].store(move_to_benefit, std::memory_order_relaxed);
+      if ( move_to_benefit != 0 || !_gain_cache.isSparse() ) {
+        benefit_entry(u, p).store(move_to_benefit, std::memory_order_relaxed);
+      }
     }
   }
 
@@ -148,26 +150,26 @@ void SoedGainCache::deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
       for (const HypernodeID& u : partitioned_hg.pins(he)) {
         ASSERT(nodeGainAssertions(u, from));
         if (partitioned_hg.partID(u) == from) {
-          _gain_cache[penalty_index(u)].fetch_sub(edge_weight, std::memory_order_relaxed);
+          penalty_entry(u).fetch_sub(edge_weight, std::memory_order_relaxed);
         }
       }
     } else if (pin_count_in_from_part_after == 0) {
       for (const HypernodeID& u : partitioned_hg.pins(he)) {
         ASSERT(nodeGainAssertions(u, from));
-        _gain_cache[benefit_index(u, from)].fetch_sub(edge_weight, std::memory_order_relaxed);
+        benefit_entry(u, from).fetch_sub(edge_weight, std::memory_order_relaxed);
       }
     }
 
     if (pin_count_in_to_part_after == 1) {
       for (const HypernodeID& u : partitioned_hg.pins(he)) {
         ASSERT(nodeGainAssertions(u, to));
-        _gain_cache[benefit_index(u, to)].fetch_add(edge_weight, std::memory_order_relaxed);
+        benefit_entry(u, to).fetch_add(edge_weight, std::memory_order_relaxed);
       }
     } else if (pin_count_in_to_part_after == 2) {
       for (const HypernodeID& u : partitioned_hg.pins(he)) {
         ASSERT(nodeGainAssertions(u, to));
         if (partitioned_hg.partID(u) == to) {
-          _gain_cache[penalty_index(u)].fetch_add(edge_weight, std::memory_order_relaxed);
+          penalty_entry(u).fetch_add(edge_weight, std::memory_order_relaxed);
         }
       }
     }
@@ -176,26 +178,26 @@ void SoedGainCache::deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
     if ( pin_count_in_from_part_after == edge_size - 1 ) {
       for ( const HypernodeID& u : partitioned_hg.pins(he) ) {
         ASSERT(nodeGainAssertions(u, from));
-        _gain_cache[penalty_index(u)].fetch_sub(edge_weight, std::memory_order_relaxed);
-        _gain_cache[benefit_index(u, from)].fetch_add(edge_weight, std::memory_order_relaxed);
+        penalty_entry(u).fetch_sub(edge_weight, std::memory_order_relaxed);
+        benefit_entry(u, from).fetch_add(edge_weight, std::memory_order_relaxed);
       }
     } else if ( pin_count_in_from_part_after == edge_size - 2 ) {
       for ( const HypernodeID& u : partitioned_hg.pins(he) ) {
         ASSERT(nodeGainAssertions(u, from));
-        _gain_cache[benefit_index(u, from)].fetch_sub(edge_weight, std::memory_order_relaxed);
+        benefit_entry(u, from).fetch_sub(edge_weight, std::memory_order_relaxed);
       }
     }
 
     if ( pin_count_in_to_part_after == edge_size ) {
       for ( const HypernodeID& u : partitioned_hg.pins(he) ) {
         ASSERT(nodeGainAssertions(u, to));
-        _gain_cache[penalty_index(u)].fetch_add(edge_weight, std::memory_order_relaxed);
-        _gain_cache[benefit_index(u, to)].fetch_sub(edge_weight, std::memory_order_relaxed);
+        penalty_entry(u).fetch_add(edge_weight, std::memory_order_relaxed);
+        benefit_entry(u, to).fetch_sub(edge_weight, std::memory_order_relaxed);
       }
     } else if ( pin_count_in_to_part_after == edge_size - 1 ) {
       for ( const HypernodeID& u : partitioned_hg.pins(he) ) {
         ASSERT(nodeGainAssertions(u, to));
-        _gain_cache[benefit_index(u, to)].fetch_add(edge_weight, std::memory_order_relaxed);
+        benefit_entry(u, to).fetch_add(edge_weight, std::memory_order_relaxed);
       }
     }
   }
@@ -224,12 +226,12 @@ void SoedGainCache::uncontractUpdateAfterRestore(const PartitionedHypergraph& pa
         // => search for other pin in the corresponding block and
         // add edge weight.
         if ( pin != v && partitioned_hg.partID(pin) == from ) {
-          _gain_cache[penalty_index(pin)].add_fetch(edge_weight, std::memory_order_relaxed);
+          penalty_entry(pin).add_fetch(edge_weight, std::memory_order_relaxed);
           if ( edge_size == 2 ) {
             // Special Case: We ignore single-pin nets during the initial gain computation.
             // In this case, he is not a single-pin net anymore and we have to add the weight
             // of the hyperedge to the benefit term of the corresponding pin.
-            _gain_cache[benefit_index(pin, from)].add_fetch(
+            benefit_entry(pin, from).add_fetch(
               edge_weight, std::memory_order_relaxed);
           }
           other_pin_of_block = pin;
@@ -254,34 +256,34 @@ void SoedGainCache::uncontractUpdateAfterRestore(const PartitionedHypergraph& pa
 
         for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
           if ( pin != v ) {
-            _gain_cache[benefit_index(pin, other_block)].fetch_sub(edge_weight, std::memory_order_relaxed);
+            benefit_entry(pin, other_block).fetch_sub(edge_weight, std::memory_order_relaxed);
           }
         }
       }
     }
 
-    _gain_cache[penalty_index(v)].add_fetch(edge_weight, std::memory_order_relaxed);
+    penalty_entry(v).add_fetch(edge_weight, std::memory_order_relaxed);
     // For all blocks contained in the connectivity set of hyperedge he
     // we increase the b(u, to) for vertex v by w(e) (connectivity metric)
     // and similary for all adjacent block with a pin count value equals
     // |e| - 1 (cut metric)
     for ( const PartitionID to : partitioned_hg.connectivitySet(he) ) {
-      _gain_cache[benefit_index(v, to)].add_fetch(edge_weight, std::memory_order_relaxed);
+      benefit_entry(v, to).add_fetch(edge_weight, std::memory_order_relaxed);
       if ( partitioned_hg.pinCountInPart(he, to) == edge_size - 1 ) {
-        _gain_cache[benefit_index(v, to)].fetch_add(edge_weight, std::memory_order_relaxed);
+        benefit_entry(v, to).fetch_add(edge_weight, std::memory_order_relaxed);
       }
     }
 
     // Special case for cut metric
     if ( pin_count_in_part_after == edge_size ) {
       // In this case, we have to add w(e) to the penalty term of v
-      _gain_cache[penalty_index(v)].fetch_add(edge_weight, std::memory_order_relaxed);
+      penalty_entry(v).fetch_add(edge_weight, std::memory_order_relaxed);
       if ( edge_size == 2 ) {
         // Special case: Hyperedge is not a single-pin net anymore. Since we do not consider
         // single-pin nets in the penalty terms, we have to add w(e) to the penalty term of u.
         // Note that u may be replaced by another node.
         ASSERT(other_pin_of_block != kInvalidHypernode);
-        _gain_cache[penalty_index(other_pin_of_block)].fetch_add(edge_weight, std::memory_order_relaxed);
+        penalty_entry(other_pin_of_block).fetch_add(edge_weight, std::memory_order_relaxed);
       }
     }
   }
@@ -303,14 +305,14 @@ void SoedGainCache::uncontractUpdateAfterReplacement(const PartitionedHypergraph
       if ( pin_count_from > 1 ) {
         // In this case, we shift the contribution of hyperedge he to the penalty term
         // of connectivity metric from u to v
-        _gain_cache[penalty_index(u)].sub_fetch(edge_weight, std::memory_order_relaxed);
-        _gain_cache[penalty_index(v)].add_fetch(edge_weight, std::memory_order_relaxed);
+        penalty_entry(u).sub_fetch(edge_weight, std::memory_order_relaxed);
+        penalty_entry(v).add_fetch(edge_weight, std::memory_order_relaxed);
       }
       if ( pin_count_from == edge_size ) {
         // In this case, we shift the contribution of hyperedge he to the penalty term
         // of cut metric from u to v
-        _gain_cache[penalty_index(u)].fetch_sub(edge_weight, std::memory_order_relaxed);
-        _gain_cache[penalty_index(v)].fetch_add(edge_weight, std::memory_order_relaxed);
+        penalty_entry(u).fetch_sub(edge_weight, std::memory_order_relaxed);
+        penalty_entry(v).fetch_add(edge_weight, std::memory_order_relaxed);
       }
 
       // For all blocks contained in the connectivity set of hyperedge he
@@ -320,12 +322,12 @@ void SoedGainCache::uncontractUpdateAfterReplacement(const PartitionedHypergraph
       // in which case we also transfer the contribution of hyperedge he to
       // the benefit term from u to v (cut metric).
       for ( const PartitionID to : partitioned_hg.connectivitySet(he) ) {
-        _gain_cache[benefit_index(u, to)].sub_fetch(edge_weight, std::memory_order_relaxed);
-        _gain_cache[benefit_index(v, to)].add_fetch(edge_weight, std::memory_order_relaxed);
+        benefit_entry(u, to).sub_fetch(edge_weight, std::memory_order_relaxed);
+        benefit_entry(v, to).add_fetch(edge_weight, std::memory_order_relaxed);
         if ( partitioned_hg.pinCountInPart(he, to) == edge_size - 1 ) {
           // u is no longer part of the hyperedge => transfer benefit term to v
-          _gain_cache[benefit_index(u, to)].fetch_sub(edge_weight, std::memory_order_relaxed);
-          _gain_cache[benefit_index(v, to)].fetch_add(edge_weight, std::memory_order_relaxed);
+          benefit_entry(u, to).fetch_sub(edge_weight, std::memory_order_relaxed);
+          benefit_entry(v, to).fetch_add(edge_weight, std::memory_order_relaxed);
         }
       }
     }
@@ -361,11 +363,8 @@ void SoedGainCache::initializeGainCacheEntryForNode(const PartitionedHypergraph&
     }
   }
 
-  _gain_cache[penalty_index(u)].store(penalty, std::memory_order_relaxed);
-  for (PartitionID i = 0; i < _k; ++i) {
-    _gain_cache[benefit_index(u, i)].store(benefit_aggregator[i], std::memory_order_relaxed);
-    benefit_aggregator[i] = 0;
-  }
+  penalty_entry(u).store(penalty, std::memory_order_relaxed);
+  _gain_cache.storeBenefitTerms(partitioned_hg, u, benefit_aggregator);
 }
 
 namespace {
@@ -31,6 +31,7 @@
 #include "mt-kahypar/datastructures/sparse_pin_counts.h"
 #include "mt-kahypar/datastructures/pin_count_in_part.h"
 #include "mt-kahypar/datastructures/connectivity_set.h"
+#include "mt-kahypar/partition/refinement/gains/gain_cache_table.h"
 #include "mt-kahypar/parallel/memory_pool.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/utils/utilities.h"
@@ -143,7 +144,8 @@ namespace mt_kahypar {
         }
       } else {
         const HypernodeID max_he_size = hypergraph.maxEdgeSize();
-        if ( context.partition.preset_type == PresetType::large_k ) {
+        if ( context.partition.preset_type == PresetType::large_k ||
+             context.partition.partition_type == LARGE_K_PARTITIONING ) {
           pool.register_memory_chunk("Refinement", "pin_count_in_part",
                                     ds::SparsePinCounts::num_elements(num_hyperedges, context.partition.k, max_he_size),
                                     sizeof(ds::SparsePinCounts::Value));
@@ -163,10 +165,13 @@ namespace mt_kahypar {
             pool.register_memory_chunk("Refinement", "num_incident_edges_of_block",
                                       static_cast<size_t>(num_hypernodes) * context.partition.k,
                                       sizeof(CAtomic<HyperedgeID>));
+          } else if ( context.refinement.sparse_gain_cache ) {
+            pool.register_memory_chunk("Refinement", "gain_cache",
+                                      num_hypernodes, GainCacheTable::size_of_sparse_node());
           } else {
             pool.register_memory_chunk("Refinement", "gain_cache",
                                       static_cast<size_t>(num_hypernodes) * ( context.partition.k + 1 ),
-                                      sizeof(CAtomic<HyperedgeWeight>));
+                                      GainCacheTable::size_of_entry(Hypergraph::is_static_hypergraph));
           }
         }
         pool.register_memory_chunk("Refinement", "pin_count_update_ownership",
@@ -40,6 +40,10 @@ inline int lowest_set_bit_64(const uint64_t x) {
   return __builtin_ctzll(x);
 }
 
+inline int highest_set_bit_64(const uint64_t x) {
+  return 63 - __builtin_clzll(x);
+}
+
 constexpr int log2(const int x) {
     return x <= 1 ? 0 : 1 + log2(x >> 1);
 }
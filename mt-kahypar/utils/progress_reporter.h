@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace mt_kahypar {
+namespace utils {
+
+/**
+ * Forwards the progress of a partitioning run to a user-defined callback
+ * (see mt_kahypar_partition_with_callbacks(...)). Progress is only reported
+ * at sequential points of the main partitioning context, i.e., after each
+ * coarsening pass, after initial partitioning and after each uncoarsening level.
+ */
+class ProgressReporter {
+
+ public:
+  enum class Phase : uint8_t {
+    coarsening,
+    initial_partitioning,
+    refinement
+  };
+
+  // Receives the current phase, the current level of the multilevel hierarchy,
+  // the number of nodes on the current level and the current objective
+  // (zero during coarsening)
+  using Callback = std::function<void(Phase, size_t, uint64_t, int64_t)>;
+
+  ProgressReporter() :
+    _callback() { }
+
+  void setCallback(Callback callback) {
+    _callback = std::move(callback);
+  }
+
+  bool isEnabled() const {
+    return static_cast<bool>(_callback);
+  }
+
+  void report(const Phase phase,
+              const size_t level,
+              const uint64_t num_nodes,
+              const int64_t objective) const {
+    if ( _callback ) {
+      _callback(phase, level, num_nodes, objective);
+    }
+  }
+
+ private:
+  Callback _callback;
+};
+
+}  // namespace utils
+}  // namespace mt_kahypar
@@ -39,6 +39,10 @@
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 
 
+namespace mt_kahypar::parallel {
+class ExecutionContext;
+}  // namespace mt_kahypar::parallel
+
 namespace mt_kahypar::utils {
 
 class Randomize {
@@ -106,7 +110,12 @@ class Randomize {
   };
 
  public:
+  // ! Returns the randomization of the execution context in which
+  // ! the calling thread currently runs or the global instance
   static Randomize& instance() {
+    if ( Randomize* local = local_instance() ) {
+      return *local;
+    }
     static Randomize instance;
     return instance;
   }
@@ -243,6 +252,13 @@ class Randomize {
   }
 
  private:
+  friend class parallel::ExecutionContext;
+
+  static Randomize*& local_instance() {
+    static thread_local Randomize* instance = nullptr;
+    return instance;
+  }
+
   explicit Randomize() :
     _rand(std::thread::hardware_concurrency()),
     _perform_localized_random_shuffle(false),
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KAHYPAR_HAS_SIMD_DISPATCH
+#include <immintrin.h>
+#define KAHYPAR_TARGET_AVX2 __attribute__((target("avx2")))
+#define KAHYPAR_TARGET_AVX512 __attribute__((target("avx512f")))
+// Functions with a target attribute can not be inlined into functions compiled
+// for the default target. Flattening a function that dispatches to an instruction
+// set inlines all (transitive) calls into it, including calls to SIMD helpers.
+#define KAHYPAR_TARGET_AVX2_FLATTEN __attribute__((target("avx2"), flatten))
+#define KAHYPAR_TARGET_AVX512_FLATTEN __attribute__((target("avx512f"), flatten))
+#endif
+
+namespace mt_kahypar::utils {
+
+enum class SIMDInstructionSet : uint8_t {
+  scalar,
+  avx2,
+  avx512
+};
+
+// ! Returns the widest instruction set that is supported by the CPU. Code paths
+// ! using these instructions are compiled with function-level target attributes,
+// ! such that the binary also runs on CPUs without AVX2 or AVX-512.
+inline SIMDInstructionSet supportedSIMDInstructionSet() {
+  static const SIMDInstructionSet instruction_set = [] {
+    #ifdef KAHYPAR_HAS_SIMD_DISPATCH
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") ) {
+      return SIMDInstructionSet::avx512;
+    } else if ( __builtin_cpu_supports("avx2") ) {
+      return SIMDInstructionSet::avx2;
+    }
+    #endif
+    return SIMDInstructionSet::scalar;
+  }();
+  return instruction_set;
+}
+
+// ! Returns true, if the CPU supports the given instruction set
+inline bool isSupported(const SIMDInstructionSet instruction_set) {
+  return static_cast<uint8_t>(instruction_set) <=
+    static_cast<uint8_t>(supportedSIMDInstructionSet());
+}
+
+inline std::ostream& operator<< (std::ostream& os, const SIMDInstructionSet& instruction_set) {
+  switch ( instruction_set ) {
+    case SIMDInstructionSet::scalar: return os << "scalar";
+    case SIMDInstructionSet::avx2: return os << "avx2";
+    case SIMDInstructionSet::avx512: return os << "avx512";
+  }
+  return os << static_cast<uint8_t>(instruction_set);
+}
+
+}  // namespace mt_kahypar::utils
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace mt_kahypar {
+namespace utils {
+
+/**
+ * Wall-clock budget of a partitioning run (see --time-limit). The clock is
+ * started once at the beginning of Partitioner::partition(...) and is then
+ * queried by all phases of the multilevel scheme. If a phase exceeds its share
+ * of the budget, it switches to a cheaper configuration (coarsening terminates,
+ * initial partitioning performs only one run per algorithm, refinement uses only
+ * label propagation and V-cycles are skipped), such that we always return the
+ * best partition found within (roughly) the given time.
+ * A partitioning run can also be cancelled cooperatively via a cancellation flag
+ * (see mt_kahypar_partition_with_callbacks(...)). A cancelled run behaves as if the
+ * budget is exhausted and additionally skips all remaining refinement.
+ */
+class TimeLimit {
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  // Coarsening terminates if it has consumed this fraction of the budget
+  static constexpr double COARSENING_SHARE = 0.4;
+  // Initial partitioning performs only one run per algorithm if coarsening and
+  // initial partitioning have consumed this fraction of the budget
+  static constexpr double INITIAL_PARTITIONING_SHARE = 0.6;
+
+  TimeLimit() :
+    _enabled(false),
+    _limit(std::numeric_limits<double>::max()),
+    _start(),
+    _cancellation_flag(nullptr) { }
+
+  void start(const double time_limit_in_seconds) {
+    _enabled = time_limit_in_seconds > 0;
+    _limit = _enabled ? time_limit_in_seconds : std::numeric_limits<double>::max();
+    _start = Clock::now();
+  }
+
+  void disable() {
+    _enabled = false;
+    _limit = std::numeric_limits<double>::max();
+  }
+
+  // The flag can be set asynchronously by an other thread (with an atomic store).
+  // The run is cancelled as soon as the flag is non-zero.
+  void setCancellationFlag(const int* cancellation_flag) {
+    _cancellation_flag = cancellation_flag;
+  }
+
+  bool isCancelled() const {
+    return _cancellation_flag &&
+      __atomic_load_n(_cancellation_flag, __ATOMIC_RELAXED) != 0;
+  }
+
+  bool isEnabled() const {
+    return _enabled || isCancelled();
+  }
+
+  double elapsed() const {
+    return std::chrono::duration<double>(Clock::now() - _start).count();
+  }
+
+  // Remaining time in seconds (infinite, if no time limit is set)
+  double remaining() const {
+    if ( isCancelled() ) {
+      return 0.0;
+    }
+    return _enabled ? std::max(0.0, _limit - elapsed()) : std::numeric_limits<double>::max();
+  }
+
+  // Returns true, if the given fraction of the time limit is exceeded
+  bool exceeded(const double share = 1.0) const {
+    return isCancelled() || ( _enabled && elapsed() >= share * _limit );
+  }
+
+ private:
+  bool _enabled;
+  double _limit;
+  Clock::time_point _start;
+  const int* _cancellation_flag;
+};
+
+}  // namespace utils
+}  // namespace mt_kahypar
@@ -34,6 +34,8 @@
 #include "mt-kahypar/utils/stats.h"
 #include "mt-kahypar/utils/initial_partitioning_stats.h"
 #include "mt-kahypar/utils/timer.h"
+#include "mt-kahypar/utils/time_limit.h"
+#include "mt-kahypar/utils/progress_reporter.h"
 
 namespace mt_kahypar {
 namespace utils {
@@ -45,11 +47,15 @@ class Utilities {
     UtilityObjects() :
       stats(),
       ip_stats(),
-      timer() { }
+      timer(),
+      time_limit(),
+      progress_reporter() { }
 
     Stats stats;
     InitialPartitioningStats ip_stats;
     Timer timer;
+    TimeLimit time_limit;
+    ProgressReporter progress_reporter;
   };
 
  public:
@@ -86,6 +92,16 @@ class Utilities {
     return _utilities[id].timer;
   }
 
+  TimeLimit& getTimeLimit(const size_t id) {
+    ASSERT(id < _utilities.size());
+    return _utilities[id].time_limit;
+  }
+
+  ProgressReporter& getProgressReporter(const size_t id) {
+    ASSERT(id < _utilities.size());
+    return _utilities[id].progress_reporter;
+  }
+
  private:
   explicit Utilities() :
     _utility_mutex(),
@@ -28,13 +28,23 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 
 #include <boost_kahypar/range/irange.hpp>
 
 #include <tbb_kahypar/parallel_for.h>
+#include <tbb_kahypar/parallel_reduce.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #ifndef KAHYPAR_DISABLE_HWLOC
@@ -79,21 +89,196 @@ namespace {
     }
   }
 
+  // NumPy arrays are passed through without a copy if they are C-contiguous and have
+  // the expected dtype. Otherwise, pybind converts them (which copies the data).
   template<typename T>
-  void ensure_correct_size(size_t expected, const vec<T>& data, const char* data_kind) {
-    if (data.size() != expected) {
+  using numpy_array = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+  template<typename Container>
+  void ensure_correct_size(size_t expected, const Container& data, const char* data_kind) {
+    if (static_cast<size_t>(data.size()) != expected) {
       throw InvalidInputException(std::string("Number of ") + data_kind + " does not match length of input data!");
     }
   }
 
+  template<typename T>
+  const T* data_or_null(const std::optional<numpy_array<T>>& data) {
+    return data ? data->data() : nullptr;
+  }
+
+  // Checks that the adjacency array is well-formed, i.e. the indices are non-decreasing,
+  // start at zero and end at the number of pins and all pins are valid node IDs
+  void ensure_valid_adjacency_array(const HypernodeID num_nodes,
+                                    const numpy_array<size_t>& indices,
+                                    const numpy_array<HypernodeID>& pins) {
+    if (indices.ndim() != 1 || indices.size() == 0) {
+      throw InvalidInputException("Hyperedge indices must be a non-empty one-dimensional array!");
+    }
+    const size_t num_edges = indices.size() - 1;
+    const size_t* index = indices.data();
+    const HypernodeID* pin = pins.data();
+    if (index[0] != 0 || index[num_edges] != static_cast<size_t>(pins.size())) {
+      throw InvalidInputException("Hyperedge indices must start at zero and end at the number of pins!");
+    }
+    const bool valid = tbb_kahypar::parallel_reduce(
+      tbb_kahypar::blocked_range<size_t>(UL(0), num_edges), true,
+      [&](const tbb_kahypar::blocked_range<size_t>& range, bool is_valid) {
+        for (size_t e = range.begin(); is_valid && e < range.end(); ++e) {
+          is_valid = index[e] <= index[e + 1];
+          for (size_t i = index[e]; is_valid && i < index[e + 1]; ++i) {
+            is_valid = pin[i] < num_nodes;
+          }
+        }
+        return is_valid;
+      }, std::logical_and<bool>());
+    if (!valid) {
+      throw InvalidInputException("Hyperedge indices must be non-decreasing and pins must be valid node IDs!");
+    }
+  }
+
   const ds::StaticGraph& target_graph_cast(mt_kahypar_py_target_graph_t target_graph) {
     ASSERT(target_graph.type == STATIC_GRAPH);
     return utils::cast_const<ds::StaticGraph>(target_graph);
   }
 
+  // The partitioner modifies its input hypergraph while it runs (and restores it
+  // afterwards). Since the partitioning calls release the GIL, calls on the same
+  // hypergraph are serialized with a mutex per hypergraph.
+  class HypergraphLocks {
+   public:
+    static std::shared_ptr<std::mutex> get(const mt_kahypar_hypergraph_t& hypergraph) {
+      std::lock_guard<std::mutex> lock(registry_mutex());
+      std::shared_ptr<std::mutex>& hypergraph_mutex = registry()[hypergraph.hypergraph];
+      if ( !hypergraph_mutex ) {
+        hypergraph_mutex = std::make_shared<std::mutex>();
+      }
+      return hypergraph_mutex;
+    }
+
+    static void remove(const mt_kahypar_hypergraph_t& hypergraph) {
+      std::lock_guard<std::mutex> lock(registry_mutex());
+      registry().erase(hypergraph.hypergraph);
+    }
+
+   private:
+    static std::mutex& registry_mutex() {
+      static std::mutex mutex;
+      return mutex;
+    }
+
+    static std::unordered_map<const void*, std::shared_ptr<std::mutex>>& registry() {
+      static std::unordered_map<const void*, std::shared_ptr<std::mutex>> locks;
+      return locks;
+    }
+  };
+
+  // Locks the hypergraph for the duration of a partitioning call
+  class HypergraphLock {
+   public:
+    explicit HypergraphLock(const mt_kahypar_hypergraph_t& hypergraph) :
+      _mutex(HypergraphLocks::get(hypergraph)),
+      _lock(*_mutex) { }
+
+   private:
+    std::shared_ptr<std::mutex> _mutex;
+    std::unique_lock<std::mutex> _lock;
+  };
+
+  // Handle to a partitioning call that runs in a separate thread. The call does
+  // not hold the GIL, such that Python code can continue in the meantime.
+  // All methods can be called concurrently from several Python threads.
+  class PartitioningFuture {
+    // The library reads the cancellation flag as a plain int with an atomic load
+    static_assert(sizeof(std::atomic<int>) == sizeof(int) && std::atomic<int>::is_always_lock_free);
+
+   public:
+    // f is invoked with the cancellation flag of the run
+    template<typename F>
+    explicit PartitioningFuture(F&& f) :
+      _cancellation_flag(std::make_unique<std::atomic<int>>(0)),
+      _future(),
+      _is_retrieved(false),
+      _result(),
+      _exception() {
+      _future = std::async(std::launch::async, std::forward<F>(f),
+        reinterpret_cast<const int*>(_cancellation_flag.get())).share();
+    }
+
+    PartitioningFuture(const PartitioningFuture&) = delete;
+    PartitioningFuture & operator= (const PartitioningFuture &) = delete;
+
+    ~PartitioningFuture() {
+      if ( !_is_retrieved ) {
+        // Nobody can retrieve the result anymore => stop the run as early as possible
+        cancel();
+        py::gil_scoped_release release;
+        try {
+          mt_kahypar_partitioned_hypergraph_t phg = _future.get();
+          utils::delete_partitioned_hypergraph(phg);
+        } catch ( ... ) { }
+      }
+    }
+
+    bool done() const {
+      return _future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    bool cancelled() const {
+      return _cancellation_flag->load(std::memory_order_relaxed) != 0;
+    }
+
+    // Returns false, if the run has already finished
+    bool cancel() {
+      if ( done() ) {
+        return false;
+      }
+      _cancellation_flag->store(1, std::memory_order_relaxed);
+      return true;
+    }
+
+    py::object result(const std::optional<double>& timeout) {
+      bool is_ready = true;
+      {
+        // Only const methods of the shared future are called concurrently
+        py::gil_scoped_release release;
+        if ( timeout ) {
+          is_ready = _future.wait_for(std::chrono::duration<double>(*timeout)) == std::future_status::ready;
+        } else {
+          _future.wait();
+        }
+      }
+      if ( !is_ready ) {
+        PyErr_SetString(PyExc_TimeoutError, "Partitioning did not finish within the given timeout");
+        throw py::error_already_set();
+      }
+      // The GIL serializes the threads that retrieve the result, such that
+      // the Python object takes ownership of the partition exactly once
+      if ( !_is_retrieved ) {
+        try {
+          _result = py::cast(_future.get());
+        } catch ( ... ) {
+          _exception = std::current_exception();
+        }
+        _is_retrieved = true;
+      }
+      if ( _exception ) {
+        std::rethrow_exception(_exception);
+      }
+      return _result;
+    }
+
+   private:
+    std::unique_ptr<std::atomic<int>> _cancellation_flag;
+    std::shared_future<mt_kahypar_partitioned_hypergraph_t> _future;
+    bool _is_retrieved;
+    py::object _result;
+    std::exception_ptr _exception;
+  };
+
   // Deleters
   struct HypergraphDeleter {
     void operator()(mt_kahypar_hypergraph_t* hg) {
+      HypergraphLocks::remove(*hg);
       utils::delete_hypergraph(*hg);
       std::default_delete<mt_kahypar_hypergraph_t>{}(hg);
     }
@@ -128,13 +313,16 @@ PYBIND11_MODULE(mtkahypar, m) {
   auto phg_class = py::class_<mt_kahypar_partitioned_hypergraph_t,
     std::unique_ptr<mt_kahypar_partitioned_hypergraph_t, PartitionedHypergraphDeleter>>(m, "PartitionedHypergraph");
 
+  auto future_class = py::class_<PartitioningFuture>(m, "PartitioningFuture");
+
 
   // ####################### Enum Types #######################
 
   using mt_kahypar::FileFormat;
   py::enum_<FileFormat>(m, "FileFormat", py::module_local())
     .value("HMETIS", FileFormat::hMetis)
-    .value("METIS", FileFormat::Metis);
+    .value("METIS", FileFormat::Metis)
+    .value("BINARY", FileFormat::binary);
 
   using mt_kahypar::PresetType;
   py::enum_<PresetType>(m, "PresetType", py::module_local())
@@ -184,6 +372,30 @@ PYBIND11_MODULE(mtkahypar, m) {
         return lib::context_from_file(config_file.c_str());
       }, "Creates a context from a configuration file.",
       py::arg("config_file"))
+    .def("partition_batch",
+      [](Initializer&, const std::vector<mt_kahypar_hypergraph_t*>& hypergraphs, const Context& context) {
+        std::vector<mt_kahypar_hypergraph_t> hgs;
+        for ( const mt_kahypar_hypergraph_t* hypergraph : hypergraphs ) {
+          hgs.push_back(*hypergraph);
+        }
+        // Lock the hypergraphs in a fixed order to prevent deadlocks (duplicates are rejected by partition_batch)
+        std::vector<mt_kahypar_hypergraph_t> sorted_hgs = hgs;
+        std::sort(sorted_hgs.begin(), sorted_hgs.end(), [](const auto& lhs, const auto& rhs) {
+          return std::less<void*>()(lhs.hypergraph, rhs.hypergraph);
+        });
+        sorted_hgs.erase(std::unique(sorted_hgs.begin(), sorted_hgs.end(), [](const auto& lhs, const auto& rhs) {
+          return lhs.hypergraph == rhs.hypergraph;
+        }), sorted_hgs.end());
+        std::vector<std::unique_ptr<HypergraphLock>> locks;
+        for ( const mt_kahypar_hypergraph_t& hypergraph : sorted_hgs ) {
+          locks.push_back(std::make_unique<HypergraphLock>(hypergraph));
+        }
+        return lib::partition_batch(hgs, context);
+      }, R"pbdoc(
+  Partitions a list of (hyper)graphs with the parameters given in the partitioning context and
+  returns the list of partitioned (hyper)graphs. The (hyper)graphs are partitioned concurrently,
+  which maximizes throughput when partitioning many small instances.
+          )pbdoc", py::call_guard<py::gil_scoped_release>(), py::arg("hypergraphs"), py::arg("context"))
     .def("create_hypergraph",
       [](Initializer&,
          const Context& context,
@@ -201,6 +413,7 @@ Construct an unweighted hypergraph.
 :param num_hyperedges: Number of hyperedges
 :param hyperedges: list containing all hyperedges (e.g., [[0,1],[0,2,3],...])
           )pbdoc",
+      py::call_guard<py::gil_scoped_release>(),
       py::arg("context"),
       py::arg("num_hypernodes"),
       py::arg("num_hyperedges"),
@@ -230,19 +443,56 @@ Construct a weighted hypergraph.
 :param node_weights: Weights of all hypernodes
 :param hyperedge_weights: Weights of all hyperedges
           )pbdoc",
+      py::call_guard<py::gil_scoped_release>(),
       py::arg("context"),
       py::arg("num_hypernodes"),
       py::arg("num_hyperedges"),
       py::arg("hyperedges"),
       py::arg("node_weights"),
       py::arg("hyperedge_weights"))
+    .def("create_hypergraph_from_csr",
+      [](Initializer&,
+         const Context& context,
+         const HypernodeID num_hypernodes,
+         const numpy_array<size_t>& hyperedge_indices,
+         const numpy_array<HypernodeID>& hyperedges,
+         const std::optional<numpy_array<HypernodeWeight>>& node_weights,
+         const std::optional<numpy_array<HyperedgeWeight>>& hyperedge_weights) {
+        ensure_valid_adjacency_array(num_hypernodes, hyperedge_indices, hyperedges);
+        const HyperedgeID num_hyperedges = hyperedge_indices.size() - 1;
+        if (node_weights) ensure_correct_size(num_hypernodes, *node_weights, "nodes");
+        if (hyperedge_weights) ensure_correct_size(num_hyperedges, *hyperedge_weights, "hyperedges");
+        return lib::create_hypergraph(context, num_hypernodes, num_hyperedges,
+          hyperedge_indices.data(), hyperedges.data(),
+          data_or_null(hyperedge_weights), data_or_null(node_weights));
+      }, R"pbdoc(
+Construct a hypergraph from an adjacency array in CSR format (e.g., the indptr and indices
+arrays of a scipy.sparse.csr_matrix). The pins of hyperedge e are stored in
+hyperedges[hyperedge_indices[e]:hyperedge_indices[e + 1]]. The arrays are not copied if
+they are C-contiguous NumPy arrays with dtype uint64 (indices), uint32 (pins) and int32 (weights).
+
+:param context: the partitioning context
+:param num_hypernodes: Number of nodes
+:param hyperedge_indices: array with the start index of each hyperedge (length: num_hyperedges + 1)
+:param hyperedges: array containing the pins of all hyperedges
+:param node_weights: Weights of all hypernodes (optional)
+:param hyperedge_weights: Weights of all hyperedges (optional)
+          )pbdoc",
+      py::call_guard<py::gil_scoped_release>(),
+      py::arg("context"),
+      py::arg("num_hypernodes"),
+      py::arg("hyperedge_indices"),
+      py::arg("hyperedges"),
+      py::arg("node_weights") = py::none(),
+      py::arg("hyperedge_weights") = py::none())
     .def("hypergraph_from_file",
       [](Initializer&,
          const std::string& file_name,
          const Context& context,
          const FileFormat file_format) {
         return lib::hypergraph_from_file(file_name, context, InstanceType::hypergraph, file_format);
-      }, "Reads a hypergraph from a file (supported file formats are METIS and HMETIS)",
+      }, "Reads a hypergraph from a file (supported file formats are METIS, HMETIS and BINARY)",
+      py::call_guard<py::gil_scoped_release>(),
       py::arg("filename"), py::arg("context"), py::arg("format") = FileFormat::hMetis)
     .def("create_graph",
       [](Initializer&,
@@ -261,6 +511,7 @@ Construct an unweighted graph.
 :param num_edges: Number of edges
 :param edges: list of tuples containing all edges (e.g., [(0,1),(0,2),(1,3),...])
           )pbdoc",
+      py::call_guard<py::gil_scoped_release>(),
       py::arg("context"),
       py::arg("num_nodes"),
       py::arg("num_edges"),
@@ -288,19 +539,65 @@ Construct a weighted graph.
 :param node_weights: Weights of all nodes
 :param edge_weights: Weights of all edges
           )pbdoc",
+      py::call_guard<py::gil_scoped_release>(),
       py::arg("context"),
       py::arg("num_nodes"),
       py::arg("num_edges"),
       py::arg("edges"),
       py::arg("node_weights"),
       py::arg("edge_weights"))
+    .def("create_graph_from_edge_array",
+      [](Initializer&,
+         const Context& context,
+         const HypernodeID num_nodes,
+         const numpy_array<HypernodeID>& edges,
+         const std::optional<numpy_array<HypernodeWeight>>& node_weights,
+         const std::optional<numpy_array<HyperedgeWeight>>& edge_weights) {
+        if (edges.size() % 2 != 0 || (edges.ndim() == 2 && edges.shape(1) != 2) || edges.ndim() > 2) {
+          throw InvalidInputException("Edges must be given as array of shape (num_edges, 2)!");
+        }
+        const HyperedgeID num_edges = edges.size() / 2;
+        const HypernodeID* endpoints = edges.data();
+        const bool valid = tbb_kahypar::parallel_reduce(
+          tbb_kahypar::blocked_range<size_t>(UL(0), static_cast<size_t>(edges.size())), true,
+          [&](const tbb_kahypar::blocked_range<size_t>& range, bool is_valid) {
+            for (size_t i = range.begin(); is_valid && i < range.end(); ++i) {
+              is_valid = endpoints[i] < num_nodes;
+            }
+            return is_valid;
+          }, std::logical_and<bool>());
+        if (!valid) {
+          throw InvalidInputException("Edges must only contain valid node IDs!");
+        }
+        if (node_weights) ensure_correct_size(num_nodes, *node_weights, "nodes");
+        if (edge_weights) ensure_correct_size(num_edges, *edge_weights, "edges");
+        return mt_kahypar_py_graph_t{lib::create_graph(context, num_nodes, num_edges,
+          endpoints, data_or_null(edge_weights), data_or_null(node_weights))};
+      }, R"pbdoc(
+Construct a graph from an array of shape (num_edges, 2) containing all edges (each undirected
+edge is given only once). The arrays are not copied if they are C-contiguous NumPy arrays
+with dtype uint32 (edges) and int32 (weights).
+
+:param context: the partitioning context
+:param num_nodes: Number of nodes
+:param edges: array containing the two endpoints of each edge (e.g., [[0,1],[0,2],[1,3],...])
+:param node_weights: Weights of all nodes (optional)
+:param edge_weights: Weights of all edges (optional)
+          )pbdoc",
+      py::call_guard<py::gil_scoped_release>(),
+      py::arg("context"),
+      py::arg("num_nodes"),
+      py::arg("edges"),
+      py::arg("node_weights") = py::none(),
+      py::arg("edge_weights") = py::none())
     .def("graph_from_file",
       [](Initializer&,
          const std::string& file_name,
          const Context& context,
          const FileFormat file_format) {
         return mt_kahypar_py_graph_t{lib::hypergraph_from_file(file_name, context, InstanceType::graph, file_format)};
-      }, "Reads a graph from a file (supported file formats are METIS and HMETIS)",
+      }, "Reads a graph from a file (supported file formats are METIS, HMETIS and BINARY)",
+      py::call_guard<py::gil_scoped_release>(),
       py::arg("filename"), py::arg("context"), py::arg("format") = FileFormat::Metis)
     .def("create_target_graph",
       [](Initializer&,
@@ -325,6 +622,7 @@ Construct a target graph.
 :param edges: list of tuples containing all edges (e.g., [(0,1),(0,2),(1,3),...])
 :param edge_weights: Weights of all edges
           )pbdoc",
+      py::call_guard<py::gil_scoped_release>(),
       py::arg("context"),
       py::arg("num_nodes"),
       py::arg("num_edges"),
@@ -340,7 +638,8 @@ Construct a target graph.
           reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::StaticGraph(
             io::readInputFile<ds::StaticGraph>(file_name, file_format, true))),
             STATIC_GRAPH };
-      }, "Reads a target graph from a file (supported file formats are METIS and HMETIS)",
+      }, "Reads a target graph from a file (supported file formats are METIS, HMETIS and BINARY)",
+      py::call_guard<py::gil_scoped_release>(),
       py::arg("filename"), py::arg("context"), py::arg("format") = FileFormat::Metis);
 
 
@@ -396,6 +695,26 @@ Construct a target graph.
       }, [](Context& context, const size_t num_vcycles) {
         context.partition.num_vcycles = num_vcycles;
       }, "Sets the number of V-cycles")
+    .def_property("time_limit",
+      [](const Context& context) {
+        return context.partition.time_limit;
+      }, [](Context& context, const int time_limit) {
+        context.partition.time_limit = time_limit;
+      }, "Sets a wall-clock time limit in seconds (0 disables the time limit)")
+    .def_property("portfolio_size",
+      [](const Context& context) {
+        return context.partition.portfolio_size;
+      }, [](Context& context, const size_t portfolio_size) {
+        context.partition.portfolio_size = portfolio_size;
+      }, "Sets the number of seeds for which the hypergraph is coarsened and initially partitioned "
+         "(only the run with the best initial partition is refined)")
+    .def_property("max_memory",
+      [](const Context& context) {
+        return context.partition.max_memory;
+      }, [](Context& context, const size_t max_memory) {
+        context.partition.max_memory = max_memory;
+      }, "Sets a memory budget in MB (0 disables the budget). If the estimated peak memory consumption "
+         "exceeds the budget, memory-saving data structures and algorithms are used or partitioning fails.")
     .def_property("logging",
       [](const Context& context) {
         return context.partition.verbose_output;
@@ -511,12 +830,45 @@ corresponding node or -1 if the node is not fixed.
       }, "Returns whether or not the given hypergraph can be partitioned with the preset", py::arg("preset"))
     .def("partition",
       [&](mt_kahypar_hypergraph_t hypergraph, const Context& context) {
+        HypergraphLock lock(hypergraph);
         return lib::partition(hypergraph, context);
       }, "Partitions the hypergraph with the parameters given in the partitioning context",
+      py::call_guard<py::gil_scoped_release>(),
       py::arg("context"))
+    .def("partition_async",
+      [&](mt_kahypar_hypergraph_t hypergraph, const Context& context) {
+        return std::make_unique<PartitioningFuture>(
+          [hypergraph, context](const int* cancellation_flag) {
+            HypergraphLock lock(hypergraph);
+            lib::PartitioningCallbacks callbacks;
+            callbacks.cancellation_flag = cancellation_flag;
+            return lib::partition(hypergraph, context, nullptr, &callbacks);
+          });
+      }, R"pbdoc(
+  Starts partitioning the hypergraph in a separate thread and returns a PartitioningFuture
+  that can be polled, cancelled or awaited. The hypergraph is modified temporarily during
+  partitioning. It must not be used while the future is pending (except for other partitioning
+  calls, which wait until the hypergraph is released).
+          )pbdoc", py::arg("context"),
+      // prevent hypergraph from being freed while the partitioning call is running
+      py::keep_alive<0, 1>())
+    .def("partition_for_multiple_k",
+      [&](mt_kahypar_hypergraph_t hypergraph,
+          const Context& context,
+          const std::vector<PartitionID>& ks,
+          const std::vector<double>& epsilons) {
+        HypergraphLock lock(hypergraph);
+        return lib::partition_for_multiple_k(hypergraph, context, ks, epsilons);
+      }, R"pbdoc(
+  Partitions the hypergraph into each number of blocks of the given list and returns the list of
+  partitioned hypergraphs. If a list of imbalance factors is given, the i-th partition uses the
+  i-th imbalance factor, otherwise the imbalance factor of the context. The hypergraph is coarsened
+  only once and all partitions share the same coarsening hierarchy.
+          )pbdoc", py::call_guard<py::gil_scoped_release>(), py::arg("context"), py::arg("ks"), py::arg("epsilons") = std::vector<double>())
     .def("map_onto_graph",
       [&](mt_kahypar_hypergraph_t hypergraph, mt_kahypar_py_target_graph_t graph, const Context& context) {
         TargetGraph target_graph(target_graph_cast(graph).copy());
+        HypergraphLock lock(hypergraph);
         return lib::map(hypergraph, target_graph, context);
       },
       R"pbdoc(
@@ -527,7 +879,24 @@ corresponding node or -1 if the node is not fixed.
   that spans a subset of the nodes (in our case the hyperedges) on the target graph. This objective function
   is able to acurately model wire-lengths in VLSI design or communication costs in a distributed system where some
   processors do not communicate directly with each other or different speeds.
-          )pbdoc", py::arg("target_graph"), py::arg("context"))
+          )pbdoc", py::call_guard<py::gil_scoped_release>(), py::arg("target_graph"), py::arg("context"))
+    .def("map_onto_graph_async",
+      [&](mt_kahypar_hypergraph_t hypergraph, mt_kahypar_py_target_graph_t graph, const Context& context) {
+        return std::make_unique<PartitioningFuture>(
+          [hypergraph, graph = target_graph_cast(graph).copy(), context](const int* cancellation_flag) mutable {
+            TargetGraph target_graph(std::move(graph));
+            HypergraphLock lock(hypergraph);
+            lib::PartitioningCallbacks callbacks;
+            callbacks.cancellation_flag = cancellation_flag;
+            return lib::map(hypergraph, target_graph, context, nullptr, &callbacks);
+          });
+      }, R"pbdoc(
+  Starts mapping the (hyper)graph onto the target graph in a separate thread (see map_onto_graph)
+  and returns a PartitioningFuture that can be polled, cancelled or awaited. As for partition_async,
+  the (hyper)graph must not be used while the future is pending.
+          )pbdoc", py::arg("target_graph"), py::arg("context"),
+      // prevent hypergraph from being freed while the mapping call is running
+      py::keep_alive<0, 1>())
   .def("create_partitioned_hypergraph",
     [&](mt_kahypar_hypergraph_t hypergraph,
         const Context& context,
@@ -545,6 +914,7 @@ Construct a partitioned hypergraph from this hypergraph.
 :param num_blocks: number of block in which the hypergraph should be partitioned into
 :param partition: list of block IDs for each node
         )pbdoc",
+    py::call_guard<py::gil_scoped_release>(),
     py::arg("num_blocks"), py::arg("context"),py::arg("partition"),
     // prevent hypergraph from being freed while the PHG is still alive
     py::keep_alive<0, 1>())
@@ -566,6 +936,7 @@ Construct a partitioned hypergraph from this hypergraph.
 :param num_blocks: number of block in which the hypergraph should be partitioned into
 :param partition_file: partition file containing block IDs for each node
         )pbdoc",
+    py::call_guard<py::gil_scoped_release>(),
     py::arg("num_blocks"), py::arg("context"), py::arg("partition_file"),
     // prevent hypergraph from being freed while the PHG is still alive
     py::keep_alive<0, 1>());
@@ -599,6 +970,31 @@ Construct a partitioned hypergraph from this hypergraph.
       }, "Target node of edge (e.g., (0,1) -> 1 is the target node)", py::arg("edge"));
 
 
+  // ####################### Partitioning Future #######################
+
+  future_class
+    .def("done", &PartitioningFuture::done,
+      "Returns true, if the partitioning call has finished")
+    .def("cancel", &PartitioningFuture::cancel, R"pbdoc(
+Requests to stop the partitioning call as early as possible. A cancelled call skips all remaining
+refinement, but still returns a valid partition. Returns false, if the call has already finished.
+        )pbdoc")
+    .def("cancelled", &PartitioningFuture::cancelled,
+      "Returns true, if cancellation was requested")
+    .def("result", &PartitioningFuture::result, R"pbdoc(
+Waits until the partitioning call has finished and returns the partitioned hypergraph. The GIL is
+released while waiting. Raises TimeoutError, if the call does not finish within the given timeout.
+
+:param timeout: maximum time to wait in seconds (waits indefinitely, if None)
+        )pbdoc", py::arg("timeout") = py::none())
+    .def("__await__",
+      [](py::object self) {
+        // Wait in the default executor of the event loop, such that other coroutines can continue
+        py::object loop = py::module_::import("asyncio").attr("get_running_loop")();
+        return loop.attr("run_in_executor")(py::none(), self.attr("result")).attr("__await__")();
+      }, "Allows to await the partitioning call in a coroutine");
+
+
   // ####################### Partitioned Hypergraph #######################
 
   phg_class
@@ -653,7 +1049,7 @@ Construct a partitioned hypergraph from this hypergraph.
           phg.setTargetGraph(&target_graph);
           return metrics::quality(phg, Objective::steiner_tree);
         });
-      }, "Computes the sum-of-external-degree metric of the partition", py::arg("target_graph"))
+      }, "Computes the sum-of-external-degree metric of the partition", py::call_guard<py::gil_scoped_release>(), py::arg("target_graph"))
     .def("is_compatible",
       [&](mt_kahypar_partitioned_hypergraph_t phg, PresetType preset) {
         return lib::is_compatible(phg, lib::get_preset_c_type(preset));
@@ -667,18 +1063,78 @@ Construct a partitioned hypergraph from this hypergraph.
         result.resize(num_nodes, 0);
         lib::get_partition<true>(phg, result.data());
         return result;
-      }, "Returns a list with the block to which each node is assigned.")
-    .def("write_partition_to_file", &lib::write_partition_to_file<true>,
-      "Writes the partition to a file", py::arg("partition_file"))
-    .def("improve_partition", &lib::improve,
-      "Improves the partition using the iterated multilevel cycle technique (V-cycles)",
+      }, "Returns a list with the block to which each node is assigned.",
+      py::call_guard<py::gil_scoped_release>())
+    .def("get_partition_array",
+      [&](mt_kahypar_partitioned_hypergraph_t phg) {
+        HypernodeID num_nodes = lib::switch_phg<HypernodeID, true>(phg, [=](const auto& p) {
+          return p.initialNumNodes();
+        });
+        py::array_t<PartitionID> result(static_cast<py::ssize_t>(num_nodes));
+        PartitionID* partition = result.mutable_data();
+        {
+          py::gil_scoped_release release;
+          lib::get_partition<true>(phg, partition);
+        }
+        return result;
+      }, "Returns a NumPy array (dtype int32) with the block to which each node is assigned.")
+    .def("write_partition_to_file",
+      [&](mt_kahypar_partitioned_hypergraph_t phg, const std::string& partition_file, const bool binary) {
+        lib::write_partition_to_file<true>(phg, partition_file,
+          binary ? FileFormat::binary : FileFormat::hMetis);
+      }, "Writes the partition to a file (one block ID per line or, if binary is true, in binary format "
+         "with one int32 block ID per node)", py::call_guard<py::gil_scoped_release>(),
+      py::arg("partition_file"), py::arg("binary") = false)
+    .def("improve_partition",
+      [&](mt_kahypar_partitioned_hypergraph_t phg, const Context& context, size_t num_vcycles) {
+        lib::improve(phg, context, num_vcycles);
+      }, "Improves the partition using the iterated multilevel cycle technique (V-cycles)",
+      py::call_guard<py::gil_scoped_release>(),
       py::arg("context"), py::arg("num_vcycles"))
     .def("improve_mapping",
       [&](mt_kahypar_partitioned_hypergraph_t phg, mt_kahypar_py_target_graph_t graph, const Context& context, size_t num_vcycles) {
         TargetGraph target_graph(target_graph_cast(graph).copy());
         lib::improve_mapping(phg, target_graph, context, num_vcycles);
       }, "Improves a mapping onto a graph using the iterated multilevel cycle technique (V-cycles)",
+      py::call_guard<py::gil_scoped_release>(),
       py::arg("target_graph"), py::arg("context"), py::arg("num_vcycles"))
+    .def("repartition_incrementally",
+      [&](mt_kahypar_partitioned_hypergraph_t phg,
+          const Context& context,
+          const vec<HypernodeID>& removed_nodes,
+          const vec<HyperedgeID>& removed_edges,
+          const vec<HypernodeWeight>& added_node_weights,
+          const vec<vec<HypernodeID>>& added_edges,
+          const vec<HyperedgeWeight>& added_edge_weights) {
+        const HypergraphDelta delta { removed_nodes, removed_edges,
+          added_node_weights, added_edges, added_edge_weights };
+        mt_kahypar_hypergraph_t updated_hg { nullptr, NULLPTR_HYPERGRAPH };
+        mt_kahypar_partitioned_hypergraph_t updated_phg { nullptr, NULLPTR_PARTITION };
+        {
+          py::gil_scoped_release release;
+          updated_phg = lib::repartition_incrementally(phg, delta, context, updated_hg);
+        }
+        py::object hg_obj = lib::get_instance_type(updated_hg) == InstanceType::graph ?
+          py::cast(mt_kahypar_py_graph_t{updated_hg}) : py::cast(std::move(updated_hg));
+        py::object phg_obj = py::cast(std::move(updated_phg));
+        // prevent the updated hypergraph from being freed while the PHG is still alive
+        py::detail::keep_alive_impl(phg_obj, hg_obj);
+        return py::make_tuple(hg_obj, phg_obj);
+      }, R"pbdoc(
+Applies a small modification to the underlying (hyper)graph and repairs the partition locally
+(instead of partitioning the modified (hyper)graph from scratch). Returns a tuple with the updated
+(hyper)graph and its partition. The remaining nodes keep their relative order and the added nodes
+are appended to them.
+
+:param removed_nodes: list of nodes that are removed
+:param removed_edges: list of (hyper)edges that are removed
+:param added_node_weights: list with the weights of the added nodes (the i-th added node has ID num_nodes() + i)
+:param added_edges: list of added (hyper)edges given as lists of pins (node IDs of the original (hyper)graph)
+:param added_edge_weights: list with the weights of the added (hyper)edges (unit weights if empty)
+        )pbdoc",
+      py::arg("context"), py::arg("removed_nodes") = vec<HypernodeID>{},
+      py::arg("removed_edges") = vec<HyperedgeID>{}, py::arg("added_node_weights") = vec<HypernodeWeight>{},
+      py::arg("added_edges") = vec<vec<HypernodeID>>{}, py::arg("added_edge_weights") = vec<HyperedgeWeight>{})
     .def("connectivity_set",
       [&](mt_kahypar_partitioned_hypergraph_t p, HyperedgeID he) {
         return lib::switch_phg<py::iterator, true>(p, [=](const auto& phg) {
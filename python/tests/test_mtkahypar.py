@@ -28,6 +28,13 @@ import unittest
 import os
 import multiprocessing
 import math
+import asyncio
+import threading
+
+try:
+  import numpy as np
+except ImportError:
+  np = None
 
 import mtkahypar
 
@@ -453,6 +460,21 @@ class MainTest(unittest.TestCase):
     if os.path.isfile(mydir + "/test_partition.part3"):
       os.remove(mydir + "/test_partition.part3")
 
+  def test_write_graph_partition_to_binary_file(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    graph = mtk.create_graph(context, 5, 6, [(0,1),(0,2),(1,2),(1,3),(2,3),(3,4)])
+    partitioned_graph = graph.create_partitioned_hypergraph(context, 3, [0,0,1,2,2])
+
+    partitioned_graph.write_partition_to_file(mydir + "/test_partition.bin.part3", binary=True)
+    # 24-byte header followed by one int32 block ID per node
+    self.assertEqual(os.path.getsize(mydir + "/test_partition.bin.part3"), 24 + 5 * 4)
+    partitioned_graph_2 = graph.partitioned_hypergraph_from_file(context, 3,
+      mydir + "/test_partition.bin.part3")
+
+    self.assertEqual(partitioned_graph_2.get_partition(), [0,0,1,2,2])
+
+    os.remove(mydir + "/test_partition.bin.part3")
+
   def test_for_hypergraph_if_all_nodes_are_in_correct_block(self):
     context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
     hypergraph = mtk.create_hypergraph(context, 7, 4, [[0,2],[0,1,3,4],[3,4,6],[2,5,6]])
@@ -1072,5 +1094,211 @@ class MainTest(unittest.TestCase):
     partitioner.partition()
     partitioner.improvePartition(1)
 
+  def test_partitions_a_batch_of_hypergraphs_and_graphs(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.CUT)
+    context.logging = logging
+    hypergraphs = [ mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context),
+                    mtk.graph_from_file(mydir + "/test_instances/delaunay_n15.graph", context),
+                    mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context) ]
+    partitioned_hgs = mtk.partition_batch(hypergraphs, context)
+    self.assertEqual(len(partitioned_hgs), len(hypergraphs))
+    for hypergraph, partitioned_hg in zip(hypergraphs, partitioned_hgs):
+      self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+      for hn in hypergraph.nodes():
+        self.assertGreaterEqual(partitioned_hg.block_id(hn), 0)
+        self.assertLess(partitioned_hg.block_id(hn), 4)
+
+  def test_partitions_a_hypergraph_with_a_seed_portfolio(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    context.portfolio_size = 3
+    context.logging = logging
+    self.assertEqual(context.portfolio_size, 3)
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    partitioned_hg = hypergraph.partition(context)
+    self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+
+  def test_partitions_a_hypergraph_within_a_memory_budget(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    context.max_memory = 1024
+    context.logging = logging
+    self.assertEqual(context.max_memory, 1024)
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    partitioned_hg = hypergraph.partition(context)
+    self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+
+    context.max_memory = 1
+    self.assertRaises(mtkahypar.SystemError, lambda: hypergraph.partition(context))
+
+  def test_partitions_a_hypergraph_for_multiple_k(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(2, 0.03, mtkahypar.Objective.KM1)
+    context.logging = logging
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    ks = [2, 4, 8]
+    partitioned_hgs = hypergraph.partition_for_multiple_k(context, ks)
+    self.assertEqual(len(partitioned_hgs), len(ks))
+    for k, partitioned_hg in zip(ks, partitioned_hgs):
+      context.set_partitioning_parameters(k, 0.03, mtkahypar.Objective.KM1)
+      self.assertEqual(partitioned_hg.num_blocks(), k)
+      self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+
+  def test_repartitions_a_hypergraph_incrementally(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    context.logging = logging
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    partitioned_hg = hypergraph.partition(context)
+    num_nodes = hypergraph.num_nodes()
+    updated_hg, updated_phg = partitioned_hg.repartition_incrementally(context,
+      removed_nodes = [0, 17], removed_edges = [3], added_node_weights = [1, 1],
+      added_edges = [[num_nodes, 100, 101], [num_nodes + 1, 200]])
+    self.assertEqual(updated_hg.num_nodes(), num_nodes)
+    self.assertLessEqual(updated_phg.imbalance(context), 0.03)
+    for hn in updated_hg.nodes():
+      self.assertGreaterEqual(updated_phg.block_id(hn), 0)
+      self.assertLess(updated_phg.block_id(hn), 4)
+
+  @unittest.skipIf(np is None, "requires numpy")
+  def test_create_hypergraph_from_csr_arrays(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    hypergraph = mtk.create_hypergraph_from_csr(context, 7,
+      np.array([0,2,6,9,12], dtype=np.uint64),
+      np.array([0,2,0,1,3,4,3,4,6,2,5,6], dtype=np.uint32),
+      node_weights=np.array([1,2,3,4,5,6,7], dtype=np.int32),
+      hyperedge_weights=np.array([1,2,3,4], dtype=np.int32))
+
+    self.assertEqual(hypergraph.num_nodes(), 7)
+    self.assertEqual(hypergraph.num_edges(), 4)
+    self.assertEqual(hypergraph.num_pins(), 12)
+    self.assertEqual(hypergraph.total_weight(), 28)
+    self.assertEqual([pin for pin in hypergraph.pins(1)], [0,1,3,4])
+    self.assertEqual([pin for pin in hypergraph.pins(3)], [2,5,6])
+    self.assertEqual(hypergraph.edge_weight(2), 3)
+
+  @unittest.skipIf(np is None, "requires numpy")
+  def test_create_hypergraph_from_csr_arrays_with_other_dtypes(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    hypergraph = mtk.create_hypergraph_from_csr(context, 7,
+      np.array([0,2,6,9,12]), np.array([0,2,0,1,3,4,3,4,6,2,5,6]))
+
+    self.assertEqual(hypergraph.num_pins(), 12)
+    self.assertEqual(hypergraph.total_weight(), 7)
+    self.assertEqual([pin for pin in hypergraph.pins(2)], [3,4,6])
+
+  @unittest.skipIf(np is None, "requires numpy")
+  def test_create_hypergraph_from_invalid_csr_arrays(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    self.assertRaises(mtkahypar.InvalidInputError, lambda: mtk.create_hypergraph_from_csr(
+      context, 7, np.array([0,2,6,9,13], dtype=np.uint64), np.array([0,2,0,1,3,4,3,4,6,2,5,6], dtype=np.uint32)))
+    self.assertRaises(mtkahypar.InvalidInputError, lambda: mtk.create_hypergraph_from_csr(
+      context, 7, np.array([0,6,2,9,12], dtype=np.uint64), np.array([0,2,0,1,3,4,3,4,6,2,5,6], dtype=np.uint32)))
+    self.assertRaises(mtkahypar.InvalidInputError, lambda: mtk.create_hypergraph_from_csr(
+      context, 7, np.array([0,2,6,9,12], dtype=np.uint64), np.array([0,2,0,1,3,4,3,4,7,2,5,6], dtype=np.uint32)))
+
+  @unittest.skipIf(np is None, "requires numpy")
+  def test_create_graph_from_edge_array(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    graph = mtk.create_graph_from_edge_array(context, 5,
+      np.array([[0,1],[0,2],[1,2],[1,3],[2,3],[3,4]], dtype=np.uint32),
+      edge_weights=np.array([1,2,3,4,5,6], dtype=np.int32))
+
+    self.assertEqual(graph.num_nodes(), 5)
+    self.assertEqual(graph.num_edges(), 12)
+    self.assertEqual(graph.num_undirected_edges(), 6)
+    self.assertEqual(graph.total_weight(), 5)
+    self.assertEqual(graph.node_degree(1), 3)
+    self.assertRaises(mtkahypar.InvalidInputError, lambda: mtk.create_graph_from_edge_array(
+      context, 5, np.array([[0,1],[0,5]], dtype=np.uint32)))
+
+  @unittest.skipIf(np is None, "requires numpy")
+  def test_get_partition_as_numpy_array(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    graph = mtk.create_graph(context, 5, 6, [(0,1),(0,2),(1,2),(1,3),(2,3),(3,4)])
+    partitioned_graph = graph.create_partitioned_hypergraph(context, 3, [0,0,1,2,2])
+
+    partition = partitioned_graph.get_partition_array()
+    self.assertEqual(partition.dtype, np.int32)
+    self.assertEqual(partition.tolist(), [0,0,1,2,2])
+
+  def test_partitions_a_hypergraph_asynchronously(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    context.logging = logging
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    future = hypergraph.partition_async(context)
+    partitioned_hg = future.result()
+    self.assertTrue(future.done())
+    self.assertFalse(future.cancel())
+    self.assertEqual(partitioned_hg.num_blocks(), 4)
+    self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+    # the result can be retrieved multiple times
+    self.assertEqual(future.result().km1(), partitioned_hg.km1())
+
+  def test_cancelled_partitioning_returns_valid_partition(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(8, 0.03, mtkahypar.Objective.KM1)
+    context.logging = logging
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    future = hypergraph.partition_async(context)
+    # cancellation fails if the call has already finished
+    is_cancelled = future.cancel()
+    partitioned_hg = future.result()
+    self.assertEqual(future.cancelled(), is_cancelled)
+    self.assertEqual(partitioned_hg.num_blocks(), 8)
+    for hn in hypergraph.nodes():
+      self.assertGreaterEqual(partitioned_hg.block_id(hn), 0)
+      self.assertLess(partitioned_hg.block_id(hn), 8)
+
+  def test_retrieves_result_of_future_from_several_threads(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    context.logging = logging
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    future = hypergraph.partition_async(context)
+    results = []
+    threads = [threading.Thread(target=lambda: results.append(future.result())) for _ in range(4)]
+    for thread in threads:
+      thread.start()
+    for thread in threads:
+      thread.join()
+    self.assertEqual(len(results), 4)
+    for partitioned_hg in results:
+      self.assertEqual(partitioned_hg.km1(), results[0].km1())
+      self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+
+  def test_awaits_asynchronous_partitioning(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(2, 0.03, mtkahypar.Objective.CUT)
+    context.logging = logging
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+
+    async def partition_both():
+      return await asyncio.gather(hypergraph.partition_async(context), hypergraph.partition_async(context))
+
+    partitioned_hgs = asyncio.run(partition_both())
+    self.assertEqual(len(partitioned_hgs), 2)
+    for partitioned_hg in partitioned_hgs:
+      self.assertEqual(partitioned_hg.num_blocks(), 2)
+      self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+
+  def test_partitioning_releases_the_gil(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    context.logging = logging
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    results = []
+    threads = [threading.Thread(target=lambda: results.append(hypergraph.partition(context))) for _ in range(2)]
+    for thread in threads:
+      thread.start()
+    for thread in threads:
+      thread.join()
+    self.assertEqual(len(results), 2)
+    for partitioned_hg in results:
+      self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+
+
 if __name__ == '__main__':
   unittest.main()
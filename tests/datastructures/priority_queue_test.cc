@@ -270,5 +270,172 @@ namespace BinaryHeap {
 
 }
 
+namespace BucketQueue {
+  using EBucketQueue = ExclusiveHandleHeap<BucketMaxQueue<int, int>>;
+  using EAdaptiveQueue = ExclusiveHandleHeap<AdaptiveMaxQueue<int, int>>;
+
+  TEST(ABucketQueue, ReturnsMax) {
+    EBucketQueue h(400);
+    h.setMaxKey(10);
+    h.insert(3, 4);
+    h.insert(2, 5);
+    h.insert(1, -10);
+    ASSERT_EQ(h.top(), 2);
+    ASSERT_EQ(h.topKey(), 5);
+    h.deleteTop();
+    ASSERT_EQ(h.top(), 3);
+    ASSERT_EQ(h.topKey(), 4);
+    h.deleteTop();
+    ASSERT_EQ(h.top(), 1);
+    ASSERT_EQ(h.topKey(), -10);
+  }
+
+  TEST(ABucketQueue, ReturnsElementsWithEqualKeyInLIFOOrder) {
+    EBucketQueue h(400);
+    h.setMaxKey(10);
+    h.insert(3, 4);
+    h.insert(2, 4);
+    h.insert(1, 4);
+    ASSERT_EQ(h.top(), 1);
+    h.deleteTop();
+    ASSERT_EQ(h.top(), 2);
+    h.deleteTop();
+    ASSERT_EQ(h.top(), 3);
+  }
+
+  TEST(ABucketQueue, AdjustKeyWorks) {
+    EBucketQueue h(400);
+    h.setMaxKey(100);
+    h.insert(3, 42);
+    h.insert(2, 54);
+    h.insert(1, 100);
+    h.insert(0, 50);
+    ASSERT_EQ(h.top(), 1);
+
+    h.adjustKey(1, -100);
+    ASSERT_EQ(h.top(), 2);
+    ASSERT_EQ(h.topKey(), 54);
+    ASSERT_EQ(h.keyOf(1), -100);
+
+    h.adjustKey(3, 60);
+    ASSERT_EQ(h.top(), 3);
+    ASSERT_EQ(h.topKey(), 60);
+  }
+
+  TEST(ABucketQueue, RemoveLeavesRestIntact) {
+    EBucketQueue h(400);
+    h.setMaxKey(20);
+    h.insert(5, 10);
+    h.insert(2, 11);
+    h.insert(1, 12);
+    h.insert(4, 9);
+    h.insert(0, 8);
+    h.insert(6, 14);
+    h.insert(7, 13);
+
+    ASSERT_TRUE(h.contains(2));
+    h.remove(2);
+    ASSERT_FALSE(h.contains(2));
+    h.remove(6);
+    ASSERT_FALSE(h.contains(6));
+
+    std::vector<int> expected_id_order = {7, 1, 5, 4, 0};
+    ASSERT_EQ(expected_id_order.size(), h.size());
+    size_t i = 0;
+    while (!h.empty()) {
+      ASSERT_EQ(h.top(), expected_id_order[i++]);
+      h.deleteTop();
+    }
+    ASSERT_TRUE(h.empty());
+  }
+
+  TEST(ABucketQueue, ClearResetsAllBuckets) {
+    EBucketQueue h(400);
+    h.setMaxKey(20);
+    h.insert(5, 10);
+    h.insert(2, 20);
+    h.clear();
+    ASSERT_TRUE(h.empty());
+    ASSERT_FALSE(h.contains(2));
+    h.insert(3, -5);
+    ASSERT_EQ(h.size(), 1);
+    ASSERT_EQ(h.top(), 3);
+    ASSERT_EQ(h.topKey(), -5);
+  }
+
+  TEST(ABucketQueue, BucketSort) {
+    size_t n = 50000;
+    EBucketQueue h(n);
+    h.setMaxKey(1000);
+    std::vector<std::pair<int, int>> kv_pairs;
+    std::mt19937 rng(420);
+    std::uniform_int_distribution dist(-1000, 1000);
+    for (size_t i = 0; i < n; ++i) {
+      kv_pairs.emplace_back(dist(rng), i);
+    }
+    std::shuffle(kv_pairs.begin(), kv_pairs.end(), rng);
+
+    for (auto& x : kv_pairs) {
+      h.insert(x.second, dist(rng));
+    }
+    for (auto& x : kv_pairs) {
+      h.adjustKey(x.second, x.first);
+    }
+
+    std::sort(kv_pairs.begin(), kv_pairs.end(), std::greater<std::pair<int, int>>());
+    size_t i = 0;
+    while (!h.empty()) {
+      ASSERT_EQ(h.topKey(), kv_pairs[i].first);
+      i++;
+      h.deleteTop();
+    }
+    ASSERT_EQ(i, n);
+  }
+
+  TEST(AnAdaptiveQueue, UsesBucketsIfKeysAreInRange) {
+    EAdaptiveQueue h(400);
+    h.setMaxKey(10);
+    ASSERT_TRUE(h.usesBuckets());
+    h.insert(3, 4);
+    h.insert(2, 5);
+    h.adjustKey(3, 10);
+    ASSERT_TRUE(h.usesBuckets());
+    ASSERT_EQ(h.top(), 3);
+    ASSERT_EQ(h.topKey(), 10);
+  }
+
+  TEST(AnAdaptiveQueue, FallsBackToHeapIfKeyIsOutOfRange) {
+    EAdaptiveQueue h(400);
+    h.setMaxKey(10);
+    h.insert(3, 4);
+    h.insert(2, 5);
+    h.insert(1, -3);
+    h.adjustKey(1, 500);
+    ASSERT_FALSE(h.usesBuckets());
+    ASSERT_EQ(h.size(), 3);
+    ASSERT_TRUE(h.contains(2));
+    ASSERT_TRUE(h.contains(3));
+
+    std::vector<int> expected_id_order = {1, 2, 3};
+    size_t i = 0;
+    while (!h.empty()) {
+      ASSERT_EQ(h.top(), expected_id_order[i++]);
+      h.deleteTop();
+    }
+    h.setMaxKey(10);
+    ASSERT_TRUE(h.usesBuckets());
+  }
+
+  TEST(AnAdaptiveQueue, UsesHeapIfMaxKeyIsZero) {
+    EAdaptiveQueue h(400);
+    h.setMaxKey(0);
+    ASSERT_FALSE(h.usesBuckets());
+    h.insert(3, 4000);
+    h.insert(2, -5000);
+    ASSERT_EQ(h.top(), 3);
+    ASSERT_EQ(h.topKey(), 4000);
+  }
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
@@ -30,6 +30,7 @@
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/datastructures/static_hypergraph.h"
 #include "mt-kahypar/datastructures/static_hypergraph_factory.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
 
 using ::testing::Test;
 
@@ -352,6 +353,58 @@ TEST_F(AStaticHypergraph, ContractsCommunities1) {
   verifyPins(c_hypergraph, { 0 }, { {0, 1, 2} });
 }
 
+TEST_F(AStaticHypergraph, ContractsCommunitiesWithSortBasedIdenticalNetDetection) {
+  parallel::scalable_vector<HypernodeID> c_mapping = {1, 4, 1, 5, 5, 4, 5};
+  StaticHypergraph c_hypergraph = hypergraph.contract(
+    c_mapping, false, IdenticalNetDetection::parallel_sort);
+
+  // Verify Stats
+  ASSERT_EQ(3, c_hypergraph.initialNumNodes());
+  ASSERT_EQ(1, c_hypergraph.initialNumEdges());
+  ASSERT_EQ(3, c_hypergraph.initialNumPins());
+  ASSERT_EQ(7, c_hypergraph.totalWeight());
+
+  // Verify Hyperedge Weights
+  ASSERT_EQ(2, c_hypergraph.edgeWeight(0));
+
+  // Verify Hypergraph Structure
+  verifyIncidentNets(c_hypergraph, 0, { 0 });
+  verifyIncidentNets(c_hypergraph, 1, { 0 });
+  verifyIncidentNets(c_hypergraph, 2, { 0 });
+  verifyPins(c_hypergraph, { 0 }, { {0, 1, 2} });
+}
+
+TEST_F(AStaticHypergraph, ContractsToSameHypergraphWithBucketMapAndSortBasedIdenticalNetDetection) {
+  StaticHypergraph ibm01 = io::readInputFile<StaticHypergraph>(
+    "../tests/instances/ibm01.hgr", FileFormat::hMetis, true);
+  parallel::scalable_vector<HypernodeID> bucket_map_mapping(ibm01.initialNumNodes());
+  for ( const HypernodeID& hn : ibm01.nodes() ) {
+    bucket_map_mapping[hn] = hn / 8;
+  }
+  parallel::scalable_vector<HypernodeID> parallel_sort_mapping = bucket_map_mapping;
+  StaticHypergraph bucket_map_hg = ibm01.contract(
+    bucket_map_mapping, false, IdenticalNetDetection::bucket_map);
+  StaticHypergraph parallel_sort_hg = ibm01.contract(
+    parallel_sort_mapping, false, IdenticalNetDetection::parallel_sort);
+
+  ASSERT_EQ(bucket_map_hg.initialNumNodes(), parallel_sort_hg.initialNumNodes());
+  ASSERT_EQ(bucket_map_hg.initialNumEdges(), parallel_sort_hg.initialNumEdges());
+  ASSERT_EQ(bucket_map_hg.initialNumPins(), parallel_sort_hg.initialNumPins());
+  ASSERT_LT(bucket_map_hg.initialNumEdges(), ibm01.initialNumEdges());
+  for ( const HyperedgeID& he : bucket_map_hg.edges() ) {
+    ASSERT_EQ(bucket_map_hg.edgeWeight(he), parallel_sort_hg.edgeWeight(he));
+    std::vector<HypernodeID> bucket_map_pins;
+    std::vector<HypernodeID> parallel_sort_pins;
+    for ( const HypernodeID& pin : bucket_map_hg.pins(he) ) {
+      bucket_map_pins.push_back(pin);
+    }
+    for ( const HypernodeID& pin : parallel_sort_hg.pins(he) ) {
+      parallel_sort_pins.push_back(pin);
+    }
+    ASSERT_EQ(bucket_map_pins, parallel_sort_pins);
+  }
+}
+
 TEST_F(AStaticHypergraph, ContractsCommunities2) {
   parallel::scalable_vector<HypernodeID> c_mapping = {1, 4, 1, 5, 5, 6, 5};
   StaticHypergraph c_hypergraph = hypergraph.contract(c_mapping);
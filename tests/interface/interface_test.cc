@@ -27,6 +27,8 @@
 
 #include "gmock/gmock.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <thread>
 
 #include <tbb_kahypar/parallel_invoke.h>
@@ -79,6 +81,9 @@ namespace mt_kahypar {
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, NUM_VCYCLES, "0", &error));
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, NUM_VCYCLES, "3", &error));
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, VERBOSE, "1", &error));
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, TIME_LIMIT, "60", &error));
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, PORTFOLIO_SIZE, "4", &error));
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, MAX_MEMORY, "1024", &error));
 
     ASSERT_EQ(INVALID_PARAMETER, mt_kahypar_set_context_parameter(context, NUM_BLOCKS, "x", &error));
     check_error_status();
@@ -90,6 +95,12 @@ namespace mt_kahypar {
     check_error_status();
     ASSERT_EQ(INVALID_PARAMETER, mt_kahypar_set_context_parameter(context, VERBOSE, "2", &error));
     check_error_status();
+    ASSERT_EQ(INVALID_PARAMETER, mt_kahypar_set_context_parameter(context, TIME_LIMIT, "t", &error));
+    check_error_status();
+    ASSERT_EQ(INVALID_PARAMETER, mt_kahypar_set_context_parameter(context, PORTFOLIO_SIZE, "p", &error));
+    check_error_status();
+    ASSERT_EQ(INVALID_PARAMETER, mt_kahypar_set_context_parameter(context, MAX_MEMORY, "m", &error));
+    check_error_status();
 
     Context& c = *reinterpret_cast<Context*>(context);
     ASSERT_EQ(4, c.partition.k);
@@ -97,6 +108,9 @@ namespace mt_kahypar {
     ASSERT_EQ(Objective::km1, c.partition.objective);
     ASSERT_EQ(3, c.partition.num_vcycles);
     ASSERT_TRUE(c.partition.verbose_output);
+    ASSERT_EQ(60, c.partition.time_limit);
+    ASSERT_EQ(4, c.partition.portfolio_size);
+    ASSERT_EQ(1024, c.partition.max_memory);
 
     mt_kahypar_free_context(context);
   }
@@ -598,6 +612,52 @@ namespace mt_kahypar {
     mt_kahypar_free_partitioned_hypergraph(partitioned_hg_2);
   }
 
+  TEST(MtKaHyPar, WritesAndLoadsBinaryHypergraphPartitionFile) {
+    mt_kahypar_error_t error;
+    mt_kahypar_context_t* context = mt_kahypar_context_from_preset(DEFAULT);
+    const mt_kahypar_hypernode_id_t num_vertices = 7;
+    const mt_kahypar_hyperedge_id_t num_hyperedges = 4;
+
+    std::unique_ptr<size_t[]> hyperedge_indices = std::make_unique<size_t[]>(5);
+    hyperedge_indices[0] = 0; hyperedge_indices[1] = 2; hyperedge_indices[2] = 6;
+    hyperedge_indices[3] = 9; hyperedge_indices[4] = 12;
+
+    std::unique_ptr<mt_kahypar_hyperedge_id_t[]> hyperedges = std::make_unique<mt_kahypar_hyperedge_id_t[]>(12);
+    hyperedges[0] = 0;  hyperedges[1] = 2;                                        // Hyperedge 0
+    hyperedges[2] = 0;  hyperedges[3] = 1; hyperedges[4] = 3;  hyperedges[5] = 4; // Hyperedge 1
+    hyperedges[6] = 3;  hyperedges[7] = 4; hyperedges[8] = 6;                     // Hyperedge 2
+    hyperedges[9] = 2; hyperedges[10] = 5; hyperedges[11] = 6;                    // Hyperedge 3
+
+    mt_kahypar_hypergraph_t hypergraph = mt_kahypar_create_hypergraph(
+      context, num_vertices, num_hyperedges, hyperedge_indices.get(), hyperedges.get(), nullptr, nullptr, &error);
+
+    std::unique_ptr<mt_kahypar_partition_id_t[]> partition = std::make_unique<mt_kahypar_partition_id_t[]>(7);
+    partition[0] = 0; partition[1] = 0; partition[2] = 0;
+    partition[3] = 1; partition[4] = 1; partition[5] = 1; partition[6] = 1;
+
+    mt_kahypar_partitioned_hypergraph_t partitioned_hg =
+      mt_kahypar_create_partitioned_hypergraph(hypergraph, context, 2, partition.get(), &error);
+
+    ASSERT_EQ(SUCCESS, mt_kahypar_write_partition_to_binary_file(partitioned_hg, "tmp.binary.partition", &error));
+
+    mt_kahypar_partitioned_hypergraph_t partitioned_hg_2 =
+      mt_kahypar_read_partition_from_file(hypergraph, context, 2, "tmp.binary.partition", &error);
+
+    std::unique_ptr<mt_kahypar_partition_id_t[]> actual_partition =
+      std::make_unique<mt_kahypar_partition_id_t[]>(7);
+    mt_kahypar_get_partition(partitioned_hg_2, actual_partition.get());
+
+    ASSERT_EQ(2, mt_kahypar_km1(partitioned_hg_2));
+    for ( mt_kahypar_hypernode_id_t hn = 0; hn < 5; ++hn ) {
+      ASSERT_EQ(partition[hn], actual_partition[hn]);
+    }
+
+    mt_kahypar_free_hypergraph(hypergraph);
+    mt_kahypar_free_partitioned_hypergraph(partitioned_hg);
+    mt_kahypar_free_partitioned_hypergraph(partitioned_hg_2);
+    std::remove("tmp.binary.partition");
+  }
+
   TEST(MtKaHyPar, ReportsPropertiesOfHypergraphPartition) {
     mt_kahypar_error_t error;
     mt_kahypar_context_t* context = mt_kahypar_context_from_preset(DEFAULT);
@@ -1049,6 +1109,16 @@ namespace mt_kahypar {
     Partition(GRAPH_FILE, METIS, LARGE_K, 4, 0.03, CUT, false);
   }
 
+  // The large k preset refines with FM on top of the sparse gain cache. With 72 blocks,
+  // the adjacent blocks of many nodes do not fit into the inline entries of the cache.
+  TEST_F(APartitioner, PartitionsAHypergraphInSeventyTwoBlocksWithLargeKPreset) {
+    Partition(HYPERGRAPH_FILE, HMETIS, LARGE_K, 72, 0.03, KM1, false);
+  }
+
+  TEST_F(APartitioner, PartitionsAGraphInSeventyTwoBlocksWithLargeKPreset) {
+    Partition(GRAPH_FILE, METIS, LARGE_K, 72, 0.03, CUT, false);
+  }
+
   TEST_F(APartitioner, PartitionsAHypergraphInTwoBlocksWithHighestQualityPreset) {
     Partition(HYPERGRAPH_FILE, HMETIS, HIGHEST_QUALITY, 2, 0.03, KM1, false);
   }
@@ -1253,6 +1323,36 @@ namespace mt_kahypar {
     ASSERT_EQ(objective_1, objective_3);
   }
 
+  TEST_F(APartitioner, MapsAGraphOntoATargetGraphWithMoreThan64Nodes) {
+    // 9 x 9 grid graph
+    const mt_kahypar_hypernode_id_t dim = 9;
+    const mt_kahypar_partition_id_t num_blocks = dim * dim;
+    std::vector<mt_kahypar_hypernode_id_t> edges;
+    for ( mt_kahypar_hypernode_id_t row = 0; row < dim; ++row ) {
+      for ( mt_kahypar_hypernode_id_t col = 0; col < dim; ++col ) {
+        const mt_kahypar_hypernode_id_t u = row * dim + col;
+        if ( col + 1 < dim ) { edges.push_back(u); edges.push_back(u + 1); }
+        if ( row + 1 < dim ) { edges.push_back(u); edges.push_back(u + dim); }
+      }
+    }
+    const mt_kahypar_hyperedge_id_t num_edges = edges.size() / 2;
+    std::vector<mt_kahypar_hyperedge_weight_t> edge_weights(num_edges, 1);
+
+    SetUpContext(DEFAULT, num_blocks, 0.03, KM1);
+    mt_kahypar_free_target_graph(target_graph);
+    target_graph = mt_kahypar_create_target_graph(
+      context, num_blocks, num_edges, edges.data(), edge_weights.data(), &error);
+    ASSERT_NE(target_graph, nullptr);
+    Load(GRAPH_FILE, METIS);
+    partitioned_hg = mt_kahypar_map(hypergraph, target_graph, context, &error);
+    ASSERT_EQ(SUCCESS, error.status);
+
+    ASSERT_EQ(num_blocks, mt_kahypar_num_blocks(partitioned_hg));
+    ASSERT_LE(mt_kahypar_imbalance(partitioned_hg, context), 0.03);
+    // Each cut edge is routed over at least one edge of the target graph
+    ASSERT_GE(mt_kahypar_steiner_tree(partitioned_hg, target_graph), mt_kahypar_km1(partitioned_hg));
+  }
+
   TEST_F(APartitioner, ImprovesHypergraphMappingWithOneVCycles) {
     Map(HYPERGRAPH_FILE, HMETIS, DEFAULT, 0.03, false);
     ImproveMapping(DEFAULT, 0.03, 1, false);
@@ -1316,6 +1416,75 @@ namespace mt_kahypar {
     PartitionNoSetup(4, 0.03, false);
   }
 
+  TEST_F(APartitioner, ReportsProgressOfPartitioningRun) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    std::vector<mt_kahypar_progress_t> reports;
+    partitioned_hg = mt_kahypar_partition_with_callbacks(hypergraph, context, nullptr,
+      [](const mt_kahypar_progress_t* progress, void* user_data) {
+        static_cast<std::vector<mt_kahypar_progress_t>*>(user_data)->push_back(*progress);
+      }, &reports, &error);
+    ASSERT_EQ(SUCCESS, error.status);
+
+    ASSERT_GE(reports.size(), 3);
+    ASSERT_EQ(PHASE_COARSENING, reports.front().phase);
+    size_t i = 0;
+    for ( ; i < reports.size() && reports[i].phase == PHASE_COARSENING; ++i ) {
+      ASSERT_EQ(i + 1, reports[i].level);
+    }
+    ASSERT_LT(i, reports.size());
+    ASSERT_EQ(PHASE_INITIAL_PARTITIONING, reports[i].phase);
+    ASSERT_EQ(i, reports[i].level);
+    for ( ++i; i < reports.size(); ++i ) {
+      ASSERT_EQ(PHASE_REFINEMENT, reports[i].phase);
+      ASSERT_GE(reports[i].objective, 0);
+      ASSERT_LE(reports[i].num_nodes, mt_kahypar_num_hypernodes(hypergraph));
+    }
+    ASSERT_EQ(0, reports.back().level);
+    ASSERT_EQ(mt_kahypar_num_hypernodes(hypergraph), reports.back().num_nodes);
+    ASSERT_EQ(mt_kahypar_km1(partitioned_hg), reports.back().objective);
+  }
+
+  TEST_F(APartitioner, ReturnsValidPartitionIfCancelled) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    const int cancellation_flag = 1;
+    partitioned_hg = mt_kahypar_partition_with_callbacks(
+      hypergraph, context, &cancellation_flag, nullptr, nullptr, &error);
+    ASSERT_EQ(SUCCESS, error.status);
+
+    std::vector<mt_kahypar_partition_id_t> partition(mt_kahypar_num_hypernodes(hypergraph));
+    mt_kahypar_get_partition(partitioned_hg, partition.data());
+    for ( const mt_kahypar_partition_id_t block : partition ) {
+      ASSERT_GE(block, 0);
+      ASSERT_LT(block, 4);
+    }
+  }
+
+  TEST_F(APartitioner, StopsRefinementIfCancelledDuringPartitioning) {
+    SetUpContext(QUALITY, 4, 0.03, KM1);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    struct CancellationState {
+      int cancellation_flag = 0;
+      size_t num_refinement_reports = 0;
+      mt_kahypar_hyperedge_weight_t objective = 0;
+    } state;
+    partitioned_hg = mt_kahypar_partition_with_callbacks(hypergraph, context, &state.cancellation_flag,
+      [](const mt_kahypar_progress_t* progress, void* user_data) {
+        CancellationState* state = static_cast<CancellationState*>(user_data);
+        if ( progress->phase == PHASE_INITIAL_PARTITIONING ) {
+          __atomic_store_n(&state->cancellation_flag, 1, __ATOMIC_RELAXED);
+          state->objective = progress->objective;
+        } else if ( progress->phase == PHASE_REFINEMENT ) {
+          ++state->num_refinement_reports;
+          // Refinement is skipped, objective only changes due to projections
+          ASSERT_EQ(state->objective, progress->objective);
+        }
+      }, &state, &error);
+    ASSERT_EQ(SUCCESS, error.status);
+    ASSERT_GT(state.num_refinement_reports, 0);
+  }
+
   TEST_F(APartitioner, PartitionsManyHypergraphsInParallel) {
     std::atomic<size_t> cnt(0);
     size_t max_runs = 100;
@@ -1326,4 +1495,355 @@ namespace mt_kahypar {
       }
     });
   }
+
+  TEST_F(APartitioner, PartitionsHypergraphsConcurrentlyInDifferentExecutionContexts) {
+    const size_t num_threads = std::max(2U, std::thread::hardware_concurrency()) / 2;
+    auto partition_in_execution_context = [&](const size_t seed, mt_kahypar_hyperedge_weight_t& km1) {
+      mt_kahypar_error_t local_error{};
+      mt_kahypar_execution_context_t* execution_context =
+        mt_kahypar_create_execution_context(num_threads, seed);
+      mt_kahypar_context_t* local_context = mt_kahypar_context_from_preset(DEFAULT);
+      mt_kahypar_set_partitioning_parameters(local_context, 4, 0.03, KM1);
+      mt_kahypar_set_context_parameter(local_context, VERBOSE, "0", &local_error);
+      mt_kahypar_hypergraph_t hg = mt_kahypar_read_hypergraph_from_file(
+        HYPERGRAPH_FILE, local_context, HMETIS, &local_error);
+      mt_kahypar_partitioned_hypergraph_t phg = mt_kahypar_partition_in_execution_context(
+        hg, local_context, execution_context, &local_error);
+      ASSERT_EQ(SUCCESS, local_error.status);
+      ASSERT_LE(mt_kahypar_imbalance(phg, local_context), 0.03);
+      km1 = mt_kahypar_km1(phg);
+      ASSERT_EQ(SUCCESS, mt_kahypar_improve_partition_in_execution_context(
+        phg, local_context, 1, execution_context, &local_error));
+      ASSERT_LE(mt_kahypar_km1(phg), km1);
+      mt_kahypar_free_partitioned_hypergraph(phg);
+      mt_kahypar_free_hypergraph(hg);
+      mt_kahypar_free_context(local_context);
+      mt_kahypar_free_execution_context(execution_context);
+    };
+
+    mt_kahypar_hyperedge_weight_t km1_1 = 0;
+    mt_kahypar_hyperedge_weight_t km1_2 = 0;
+    std::thread t1([&] { partition_in_execution_context(42, km1_1); });
+    std::thread t2([&] { partition_in_execution_context(420, km1_2); });
+    t1.join();
+    t2.join();
+    ASSERT_GT(km1_1, 0);
+    ASSERT_GT(km1_2, 0);
+  }
+
+  TEST_F(APartitioner, PartitionsABatchOfHypergraphsAndGraphs) {
+    mt_kahypar_context_t* batch_context = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_set_partitioning_parameters(batch_context, 4, 0.03, CUT);
+    mt_kahypar_set_context_parameter(batch_context, VERBOSE, "0", &error);
+
+    std::vector<mt_kahypar_hypergraph_t> hgs;
+    hgs.push_back(mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, batch_context, HMETIS, &error));
+    hgs.push_back(mt_kahypar_read_hypergraph_from_file(GRAPH_FILE, batch_context, METIS, &error));
+    hgs.push_back(mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, batch_context, HMETIS, &error));
+    std::vector<mt_kahypar_partitioned_hypergraph_t> phgs(hgs.size());
+    ASSERT_EQ(SUCCESS, mt_kahypar_partition_batch(
+      hgs.data(), hgs.size(), batch_context, phgs.data(), &error));
+
+    ASSERT_EQ(MULTILEVEL_HYPERGRAPH_PARTITIONING, phgs[0].type);
+    ASSERT_EQ(MULTILEVEL_GRAPH_PARTITIONING, phgs[1].type);
+    ASSERT_EQ(MULTILEVEL_HYPERGRAPH_PARTITIONING, phgs[2].type);
+    for ( size_t i = 0; i < hgs.size(); ++i ) {
+      ASSERT_LE(mt_kahypar_imbalance(phgs[i], batch_context), 0.03);
+      std::vector<mt_kahypar_partition_id_t> partition(mt_kahypar_num_hypernodes(hgs[i]));
+      mt_kahypar_get_partition(phgs[i], partition.data());
+      for ( const mt_kahypar_partition_id_t block : partition ) {
+        ASSERT_GE(block, 0);
+        ASSERT_LT(block, 4);
+      }
+      mt_kahypar_free_partitioned_hypergraph(phgs[i]);
+      mt_kahypar_free_hypergraph(hgs[i]);
+    }
+    mt_kahypar_free_context(batch_context);
+  }
+
+  TEST_F(APartitioner, PartitionsABatchDeterministically) {
+    mt_kahypar_context_t* batch_context = mt_kahypar_context_from_preset(DETERMINISTIC);
+    mt_kahypar_set_partitioning_parameters(batch_context, 4, 0.03, KM1);
+    mt_kahypar_set_context_parameter(batch_context, VERBOSE, "0", &error);
+
+    auto partition_batch = [&] {
+      std::vector<mt_kahypar_hypergraph_t> hgs;
+      hgs.push_back(mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, batch_context, HMETIS, &error));
+      hgs.push_back(mt_kahypar_read_hypergraph_from_file(GRAPH_FILE, batch_context, METIS, &error));
+      hgs.push_back(mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, batch_context, HMETIS, &error));
+      std::vector<mt_kahypar_partitioned_hypergraph_t> phgs(hgs.size());
+      EXPECT_EQ(SUCCESS, mt_kahypar_partition_batch(
+        hgs.data(), hgs.size(), batch_context, phgs.data(), &error));
+      std::vector<std::vector<mt_kahypar_partition_id_t>> partitions;
+      for ( size_t i = 0; i < hgs.size(); ++i ) {
+        partitions.emplace_back(mt_kahypar_num_hypernodes(hgs[i]));
+        mt_kahypar_get_partition(phgs[i], partitions.back().data());
+        mt_kahypar_free_partitioned_hypergraph(phgs[i]);
+        mt_kahypar_free_hypergraph(hgs[i]);
+      }
+      return partitions;
+    };
+
+    const std::vector<std::vector<mt_kahypar_partition_id_t>> partitions = partition_batch();
+    // Both instances of the same hypergraph are partitioned with the same seed
+    ASSERT_EQ(partitions[0], partitions[2]);
+    for ( size_t i = 0; i < 3; ++i ) {
+      ASSERT_EQ(partitions, partition_batch());
+    }
+    mt_kahypar_free_context(batch_context);
+  }
+
+  TEST_F(APartitioner, ReportsErrorIfAHypergraphOccursTwiceInABatch) {
+    mt_kahypar_context_t* batch_context = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_set_partitioning_parameters(batch_context, 4, 0.03, KM1);
+    mt_kahypar_set_context_parameter(batch_context, VERBOSE, "0", &error);
+
+    mt_kahypar_hypergraph_t hg = mt_kahypar_read_hypergraph_from_file(
+      HYPERGRAPH_FILE, batch_context, HMETIS, &error);
+    std::vector<mt_kahypar_hypergraph_t> hgs = { hg, hg };
+    std::vector<mt_kahypar_partitioned_hypergraph_t> phgs(hgs.size());
+    ASSERT_EQ(INVALID_INPUT, mt_kahypar_partition_batch(
+      hgs.data(), hgs.size(), batch_context, phgs.data(), &error));
+    ASSERT_EQ(nullptr, phgs[0].partitioned_hg);
+    ASSERT_EQ(nullptr, phgs[1].partitioned_hg);
+    mt_kahypar_free_error_content(&error);
+    mt_kahypar_free_hypergraph(hg);
+    mt_kahypar_free_context(batch_context);
+  }
+
+  TEST_F(APartitioner, ReportsErrorIfOneInstanceOfBatchIsIncompatible) {
+    mt_kahypar_context_t* batch_context = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_set_partitioning_parameters(batch_context, 4, 0.03, KM1);
+    mt_kahypar_set_context_parameter(batch_context, VERBOSE, "0", &error);
+    mt_kahypar_context_t* hq_context = mt_kahypar_context_from_preset(HIGHEST_QUALITY);
+
+    std::vector<mt_kahypar_hypergraph_t> hgs;
+    hgs.push_back(mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, batch_context, HMETIS, &error));
+    hgs.push_back(mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, hq_context, HMETIS, &error));
+    std::vector<mt_kahypar_partitioned_hypergraph_t> phgs(hgs.size());
+    ASSERT_NE(SUCCESS, mt_kahypar_partition_batch(
+      hgs.data(), hgs.size(), batch_context, phgs.data(), &error));
+    for ( size_t i = 0; i < hgs.size(); ++i ) {
+      ASSERT_EQ(nullptr, phgs[i].partitioned_hg);
+      mt_kahypar_free_hypergraph(hgs[i]);
+    }
+    mt_kahypar_free_error_content(&error);
+    mt_kahypar_free_context(hq_context);
+    mt_kahypar_free_context(batch_context);
+  }
+
+  TEST_F(APartitioner, PartitionsAHypergraphWithASeedPortfolio) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(context, PORTFOLIO_SIZE, "3", &error));
+    Load(HYPERGRAPH_FILE, HMETIS);
+    PartitionNoSetup(4, 0.03);
+  }
+
+  TEST_F(APartitioner, PartitionsAGraphWithASeedPortfolio) {
+    SetUpContext(DEFAULT, 4, 0.03, CUT);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(context, PORTFOLIO_SIZE, "3", &error));
+    Load(GRAPH_FILE, METIS);
+    PartitionNoSetup(4, 0.03);
+  }
+
+  TEST_F(APartitioner, PartitionsAHypergraphWithinAMemoryBudget) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(context, MAX_MEMORY, "1024", &error));
+    Load(HYPERGRAPH_FILE, HMETIS);
+    PartitionNoSetup(4, 0.03);
+  }
+
+  TEST_F(APartitioner, ReportsErrorIfMemoryBudgetCannotBeMet) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(context, MAX_MEMORY, "1", &error));
+    Load(HYPERGRAPH_FILE, HMETIS);
+    partitioned_hg = mt_kahypar_partition(hypergraph, context, &error);
+    ASSERT_EQ(SYSTEM_ERROR, error.status);
+    ASSERT_EQ(nullptr, partitioned_hg.partitioned_hg);
+    mt_kahypar_free_error_content(&error);
+  }
+
+  TEST_F(APartitioner, PartitionsAHypergraphForMultipleK) {
+    SetUpContext(DEFAULT, 2, 0.03, KM1);
+    Load(HYPERGRAPH_FILE, HMETIS);
+
+    std::vector<mt_kahypar_partition_id_t> ks = { 2, 4, 8, 16 };
+    std::vector<double> epsilons = { 0.03, 0.05, 0.03, 0.1 };
+    std::vector<mt_kahypar_partitioned_hypergraph_t> phgs(ks.size());
+    ASSERT_EQ(SUCCESS, mt_kahypar_partition_for_multiple_k(hypergraph, context,
+      ks.data(), epsilons.data(), ks.size(), phgs.data(), &error));
+
+    std::vector<mt_kahypar_partition_id_t> partition(mt_kahypar_num_hypernodes(hypergraph));
+    for ( size_t i = 0; i < ks.size(); ++i ) {
+      ASSERT_EQ(MULTILEVEL_HYPERGRAPH_PARTITIONING, phgs[i].type);
+      ASSERT_EQ(ks[i], mt_kahypar_num_blocks(phgs[i]));
+      mt_kahypar_set_partitioning_parameters(context, ks[i], epsilons[i], KM1);
+      ASSERT_LE(mt_kahypar_imbalance(phgs[i], context), epsilons[i]);
+      mt_kahypar_get_partition(phgs[i], partition.data());
+      for ( const mt_kahypar_partition_id_t block : partition ) {
+        ASSERT_GE(block, 0);
+        ASSERT_LT(block, ks[i]);
+      }
+      mt_kahypar_free_partitioned_hypergraph(phgs[i]);
+    }
+  }
+
+  TEST_F(APartitioner, PartitionsAGraphForMultipleK) {
+    SetUpContext(DEFAULT, 2, 0.03, CUT);
+    Load(GRAPH_FILE, METIS);
+
+    std::vector<mt_kahypar_partition_id_t> ks = { 8, 2, 4 };
+    std::vector<mt_kahypar_partitioned_hypergraph_t> phgs(ks.size());
+    ASSERT_EQ(SUCCESS, mt_kahypar_partition_for_multiple_k(hypergraph, context,
+      ks.data(), nullptr, ks.size(), phgs.data(), &error));
+
+    for ( size_t i = 0; i < ks.size(); ++i ) {
+      ASSERT_EQ(MULTILEVEL_GRAPH_PARTITIONING, phgs[i].type);
+      ASSERT_EQ(ks[i], mt_kahypar_num_blocks(phgs[i]));
+      mt_kahypar_set_partitioning_parameters(context, ks[i], 0.03, CUT);
+      ASSERT_LE(mt_kahypar_imbalance(phgs[i], context), 0.03);
+      mt_kahypar_free_partitioned_hypergraph(phgs[i]);
+    }
+  }
+
+  TEST_F(APartitioner, RestoresDegreeZeroVerticesInEachPartitionForMultipleK) {
+    SetUpContext(DEFAULT, 2, 0.03, KM1);
+    // The first half of the vertices forms a path of hyperedges,
+    // the second half of the vertices are isolated
+    const mt_kahypar_hypernode_id_t num_vertices = 4000;
+    const mt_kahypar_hyperedge_id_t num_hyperedges = num_vertices / 2 - 1;
+    std::vector<size_t> hyperedge_indices(num_hyperedges + 1, 0);
+    std::vector<mt_kahypar_hyperedge_id_t> hyperedges;
+    for ( mt_kahypar_hyperedge_id_t he = 0; he < num_hyperedges; ++he ) {
+      hyperedges.insert(hyperedges.end(), { he, he + 1 });
+      hyperedge_indices[he + 1] = hyperedges.size();
+    }
+    hypergraph = mt_kahypar_create_hypergraph(context, num_vertices, num_hyperedges,
+      hyperedge_indices.data(), hyperedges.data(), nullptr, nullptr, &error);
+
+    std::vector<mt_kahypar_partition_id_t> ks = { 2, 4 };
+    std::vector<mt_kahypar_partitioned_hypergraph_t> phgs(ks.size());
+    ASSERT_EQ(SUCCESS, mt_kahypar_partition_for_multiple_k(hypergraph, context,
+      ks.data(), nullptr, ks.size(), phgs.data(), &error));
+
+    std::vector<mt_kahypar_partition_id_t> partition(num_vertices);
+    for ( size_t i = 0; i < ks.size(); ++i ) {
+      mt_kahypar_set_partitioning_parameters(context, ks[i], 0.03, KM1);
+      ASSERT_LE(mt_kahypar_imbalance(phgs[i], context), 0.03);
+      mt_kahypar_get_partition(phgs[i], partition.data());
+      for ( const mt_kahypar_partition_id_t block : partition ) {
+        ASSERT_GE(block, 0);
+        ASSERT_LT(block, ks[i]);
+      }
+      mt_kahypar_free_partitioned_hypergraph(phgs[i]);
+    }
+  }
+
+  TEST_F(APartitioner, ReportsErrorIfIndividualBlockWeightsAreUsedForMultipleK) {
+    SetUpContext(DEFAULT, 2, 0.03, KM1);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    std::vector<mt_kahypar_hypernode_weight_t> block_weights = { 6000, 7000 };
+    mt_kahypar_set_individual_target_block_weights(context, 2, block_weights.data());
+
+    std::vector<mt_kahypar_partition_id_t> ks = { 2, 4 };
+    std::vector<mt_kahypar_partitioned_hypergraph_t> phgs(ks.size());
+    ASSERT_EQ(INVALID_INPUT, mt_kahypar_partition_for_multiple_k(hypergraph, context,
+      ks.data(), nullptr, ks.size(), phgs.data(), &error));
+    ASSERT_EQ(nullptr, phgs[0].partitioned_hg);
+    ASSERT_EQ(nullptr, phgs[1].partitioned_hg);
+    mt_kahypar_free_error_content(&error);
+  }
+
+  TEST_F(APartitioner, RepartitionsHypergraphIncrementallyAfterSmallModification) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DEFAULT, 4, 0.03, KM1, false);
+    const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    const mt_kahypar_hyperedge_id_t num_edges = mt_kahypar_num_hyperedges(hypergraph);
+    const mt_kahypar_hyperedge_weight_t km1_before = mt_kahypar_km1(partitioned_hg);
+
+    // Remove a few nodes and nets and connect each added node to two existing nodes
+    std::vector<mt_kahypar_hypernode_id_t> removed_nodes = { 0, 17, 42, 1000 };
+    std::vector<mt_kahypar_hyperedge_id_t> removed_edges = { 3, 99, 512 };
+    const mt_kahypar_hypernode_id_t num_added_nodes = 10;
+    std::vector<size_t> added_edge_indices = { 0 };
+    std::vector<mt_kahypar_hyperedge_id_t> added_edges;
+    for ( mt_kahypar_hypernode_id_t i = 0; i < num_added_nodes; ++i ) {
+      added_edges.insert(added_edges.end(), { num_nodes + i, 100 + 2 * i, 101 + 2 * i });
+      added_edge_indices.push_back(added_edges.size());
+    }
+    mt_kahypar_hypergraph_delta_t delta { };
+    delta.removed_nodes = removed_nodes.data();
+    delta.num_removed_nodes = removed_nodes.size();
+    delta.removed_edges = removed_edges.data();
+    delta.num_removed_edges = removed_edges.size();
+    delta.num_added_nodes = num_added_nodes;
+    delta.num_added_edges = num_added_nodes;
+    delta.added_edge_indices = added_edge_indices.data();
+    delta.added_edges = added_edges.data();
+
+    mt_kahypar_hypergraph_t updated_hg { nullptr, NULLPTR_HYPERGRAPH };
+    mt_kahypar_partitioned_hypergraph_t updated_phg =
+      mt_kahypar_repartition_incrementally(partitioned_hg, &delta, context, &updated_hg, &error);
+    ASSERT_EQ(SUCCESS, error.status);
+    ASSERT_EQ(num_nodes - removed_nodes.size() + num_added_nodes, mt_kahypar_num_hypernodes(updated_hg));
+    ASSERT_LE(mt_kahypar_num_hyperedges(updated_hg), num_edges - removed_edges.size() + num_added_nodes);
+    ASSERT_LE(mt_kahypar_imbalance(updated_phg, context), 0.03);
+    ASSERT_LE(mt_kahypar_km1(updated_phg), km1_before + static_cast<mt_kahypar_hyperedge_weight_t>(2 * num_added_nodes));
+
+    // The remaining nodes keep their relative order
+    std::vector<mt_kahypar_partition_id_t> partition(num_nodes);
+    std::vector<mt_kahypar_partition_id_t> updated_partition(mt_kahypar_num_hypernodes(updated_hg));
+    mt_kahypar_get_partition(partitioned_hg, partition.data());
+    mt_kahypar_get_partition(updated_phg, updated_partition.data());
+    size_t num_moved_nodes = 0;
+    for ( mt_kahypar_hypernode_id_t hn = 0, updated_hn = 0; hn < num_nodes; ++hn ) {
+      if ( std::find(removed_nodes.begin(), removed_nodes.end(), hn) == removed_nodes.end() ) {
+        num_moved_nodes += partition[hn] != updated_partition[updated_hn++];
+      }
+    }
+    ASSERT_LE(num_moved_nodes, num_nodes / 10);
+    mt_kahypar_free_partitioned_hypergraph(updated_phg);
+    mt_kahypar_free_hypergraph(updated_hg);
+  }
+
+  TEST_F(APartitioner, RepartitionsGraphIncrementallyAfterSmallModification) {
+    Partition(GRAPH_FILE, METIS, DEFAULT, 4, 0.03, CUT, false);
+    const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    std::vector<mt_kahypar_hypernode_id_t> removed_nodes = { 5, 500 };
+    std::vector<size_t> added_edge_indices = { 0, 2, 4 };
+    std::vector<mt_kahypar_hyperedge_id_t> added_edges = { num_nodes, 10, num_nodes, 11 };
+    mt_kahypar_hypergraph_delta_t delta { };
+    delta.removed_nodes = removed_nodes.data();
+    delta.num_removed_nodes = removed_nodes.size();
+    delta.num_added_nodes = 1;
+    delta.num_added_edges = 2;
+    delta.added_edge_indices = added_edge_indices.data();
+    delta.added_edges = added_edges.data();
+
+    mt_kahypar_hypergraph_t updated_graph { nullptr, NULLPTR_HYPERGRAPH };
+    mt_kahypar_partitioned_hypergraph_t updated_phg =
+      mt_kahypar_repartition_incrementally(partitioned_hg, &delta, context, &updated_graph, &error);
+    ASSERT_EQ(SUCCESS, error.status);
+    ASSERT_EQ(STATIC_GRAPH, updated_graph.type);
+    ASSERT_EQ(MULTILEVEL_GRAPH_PARTITIONING, updated_phg.type);
+    ASSERT_EQ(num_nodes - 1, mt_kahypar_num_hypernodes(updated_graph));
+    ASSERT_LE(mt_kahypar_imbalance(updated_phg, context), 0.03);
+    mt_kahypar_free_partitioned_hypergraph(updated_phg);
+    mt_kahypar_free_hypergraph(updated_graph);
+  }
+
+  TEST_F(APartitioner, ReportsErrorIfIncrementalModificationIsInvalid) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DEFAULT, 4, 0.03, KM1, false);
+    std::vector<mt_kahypar_hypernode_id_t> removed_nodes = { mt_kahypar_num_hypernodes(hypergraph) };
+    mt_kahypar_hypergraph_delta_t delta { };
+    delta.removed_nodes = removed_nodes.data();
+    delta.num_removed_nodes = removed_nodes.size();
+
+    mt_kahypar_hypergraph_t updated_hg { nullptr, NULLPTR_HYPERGRAPH };
+    mt_kahypar_partitioned_hypergraph_t updated_phg =
+      mt_kahypar_repartition_incrementally(partitioned_hg, &delta, context, &updated_hg, &error);
+    ASSERT_EQ(INVALID_INPUT, error.status);
+    ASSERT_EQ(nullptr, updated_phg.partitioned_hg);
+    ASSERT_EQ(nullptr, updated_hg.hypergraph);
+    mt_kahypar_free_error_content(&error);
+  }
 }
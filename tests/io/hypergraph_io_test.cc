@@ -24,10 +24,16 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+
 #include "gmock/gmock.h"
 
 #include "tests/definitions.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
 
 using ::testing::Test;
@@ -46,6 +52,34 @@ class AnInputReader : public Test {
     hypergraph = readInputFile<Hypergraph>(filename, format, true);
   }
 
+  void readHypergraphFromBinaryFile(const std::string& filename, const FileFormat format) {
+    // Convert input file to binary format
+    HyperedgeID num_edges = 0;
+    HypernodeID num_nodes = 0;
+    HyperedgeID num_removed_single_pin_hyperedges = 0;
+    HyperedgeVector edges;
+    vec<HyperedgeWeight> edges_weight;
+    vec<HypernodeWeight> nodes_weight;
+    if ( format == FileFormat::hMetis ) {
+      readHypergraphFile(filename, num_edges, num_nodes, num_removed_single_pin_hyperedges,
+        edges, edges_weight, nodes_weight);
+    } else {
+      readGraphFile(filename, num_edges, num_nodes, edges, edges_weight, nodes_weight);
+    }
+    vec<size_t> indices(num_edges + 1, 0);
+    vec<HypernodeID> pins;
+    for ( HyperedgeID he = 0; he < num_edges; ++he ) {
+      pins.insert(pins.end(), edges[he].begin(), edges[he].end());
+      indices[he + 1] = pins.size();
+    }
+    const std::string binary_filename = "tmp.binary.hgr";
+    writeBinaryHypergraphFile(binary_filename, num_nodes, num_edges, indices.data(), pins.data(),
+      edges_weight.empty() ? nullptr : edges_weight.data(),
+      nodes_weight.empty() ? nullptr : nodes_weight.data(),
+      nullptr, num_removed_single_pin_hyperedges, format == FileFormat::Metis);
+    hypergraph = readInputFile<Hypergraph>(binary_filename, FileFormat::binary, true);
+  }
+
   void verifyIncidentNets(const std::vector< std::set<HyperedgeID> >& references) {
     ASSERT(hypergraph.initialNumNodes() == references.size());
     for (HypernodeID hn = 0; hn < hypergraph.initialNumNodes(); ++hn) {
@@ -233,6 +267,34 @@ TYPED_TEST(AHypergraphReader, ReadsAnHypergraphWithNodeAndEdgeWeights) {
   ASSERT_EQ(8, this->hypergraph.edgeWeight(3));
 }
 
+TYPED_TEST(AHypergraphReader, ReadsAnHypergraphWithNodeAndEdgeWeightsFromBinaryFile) {
+  this->readHypergraphFromBinaryFile("../tests/instances/hypergraph_with_node_and_edge_weights.hgr", FileFormat::hMetis);
+
+  // Verify Incident Nets
+  this->verifyIncidentNets(
+    { { 0, 1 }, { 1 }, { 0, 3 }, { 1, 2 },
+      {1, 2}, { 3 }, { 2, 3 } });
+
+  // Verify Pins
+  this->verifyPins({ { 0, 2 }, { 0, 1, 3, 4 },
+    { 3, 4, 6 }, { 2, 5, 6 } });
+
+  // Verify Node Weights
+  ASSERT_EQ(5, this->hypergraph.nodeWeight(0));
+  ASSERT_EQ(8, this->hypergraph.nodeWeight(1));
+  ASSERT_EQ(2, this->hypergraph.nodeWeight(2));
+  ASSERT_EQ(3, this->hypergraph.nodeWeight(3));
+  ASSERT_EQ(4, this->hypergraph.nodeWeight(4));
+  ASSERT_EQ(9, this->hypergraph.nodeWeight(5));
+  ASSERT_EQ(8, this->hypergraph.nodeWeight(6));
+
+  // Verify Edge Weights
+  ASSERT_EQ(4, this->hypergraph.edgeWeight(0));
+  ASSERT_EQ(2, this->hypergraph.edgeWeight(1));
+  ASSERT_EQ(3, this->hypergraph.edgeWeight(2));
+  ASSERT_EQ(8, this->hypergraph.edgeWeight(3));
+}
+
 TYPED_TEST(AGraphReader, ReadsAMetisGraph) {
   this->readHypergraph("../tests/instances/unweighted_graph.graph", FileFormat::Metis);
 
@@ -343,5 +405,272 @@ TYPED_TEST(AGraphReader, ReadsAMetisGraphWithNodeAndEdgeWeights) {
   ASSERT_EQ(1, this->hypergraph.nodeWeight(7));
 }
 
+TYPED_TEST(AGraphReader, ReadsAMetisGraphWithNodeAndEdgeWeightsFromBinaryFile) {
+  this->readHypergraphFromBinaryFile("../tests/instances/graph_with_node_and_edge_weights.graph", FileFormat::Metis);
+
+  // Verify Neighbors and Edge Weights
+  this->verifyNeighborsAndEdgeWeights(
+    { { { 1, 1 }, { 2, 2 }, { 4, 1 } },
+      { { 0, 1 }, { 2, 2 }, { 3, 1 } },
+      { { 0, 2 }, { 1, 2 }, { 3, 2 }, { 4, 3 } },
+      { { 1, 1 }, { 2, 2 }, { 5, 2 }, { 6, 5 } },
+      { { 0, 1 }, { 2, 3 }, { 5, 2 } },
+      { { 3, 2 }, { 4, 2 }, { 6, 6 } },
+      { { 3, 5 }, { 5, 6 } },
+      { } } );
+
+  // Verify Node Weights
+  ASSERT_EQ(4, this->hypergraph.nodeWeight(0));
+  ASSERT_EQ(2, this->hypergraph.nodeWeight(1));
+  ASSERT_EQ(5, this->hypergraph.nodeWeight(2));
+  ASSERT_EQ(3, this->hypergraph.nodeWeight(3));
+  ASSERT_EQ(1, this->hypergraph.nodeWeight(4));
+  ASSERT_EQ(6, this->hypergraph.nodeWeight(5));
+  ASSERT_EQ(2, this->hypergraph.nodeWeight(6));
+  ASSERT_EQ(1, this->hypergraph.nodeWeight(7));
+  ASSERT_EQ(InstanceType::graph, instanceTypeOfBinaryFile("tmp.binary.hgr"));
+}
+
+TEST(AnAdjacencyArrayReader, ReadsAnHypergraphWithEdgeWeights) {
+  HyperedgeID num_edges = 0;
+  HypernodeID num_nodes = 0;
+  HyperedgeID num_removed_single_pin_hyperedges = 0;
+  vec<size_t> indices;
+  vec<HypernodeID> pins;
+  vec<HyperedgeWeight> edges_weight;
+  vec<HypernodeWeight> nodes_weight;
+  readHypergraphFile("../tests/instances/hypergraph_with_edge_weights.hgr", num_edges, num_nodes,
+    num_removed_single_pin_hyperedges, indices, pins, edges_weight, nodes_weight);
+
+  ASSERT_EQ(4, num_edges);
+  ASSERT_EQ(7, num_nodes);
+  ASSERT_EQ(0, num_removed_single_pin_hyperedges);
+  ASSERT_EQ(vec<size_t>({ 0, 2, 6, 9, 12 }), indices);
+  ASSERT_EQ(vec<HypernodeID>({ 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 }), pins);
+  ASSERT_EQ(vec<HyperedgeWeight>({ 4, 2, 3, 8 }), edges_weight);
+}
+
+TEST(AnAdjacencyArrayReader, RemovesSinglePinHyperedgesAndDuplicatedPins) {
+  const std::string filename = "tmp.duplicated_pins.hgr";
+  {
+    std::ofstream out(filename);
+    out << "% hyperedges with duplicated pins\n"
+        << "4 5\n"
+        << "1 3 3\n"
+        << "2\n"
+        << "5 4 5 1 4\n"
+        << "2 3\n";
+  }
+  HyperedgeID num_edges = 0;
+  HypernodeID num_nodes = 0;
+  HyperedgeID num_removed_single_pin_hyperedges = 0;
+  vec<size_t> indices;
+  vec<HypernodeID> pins;
+  vec<HyperedgeWeight> edges_weight;
+  vec<HypernodeWeight> nodes_weight;
+  readHypergraphFile(filename, num_edges, num_nodes, num_removed_single_pin_hyperedges,
+    indices, pins, edges_weight, nodes_weight);
+
+  ASSERT_EQ(3, num_edges);
+  ASSERT_EQ(5, num_nodes);
+  ASSERT_EQ(1, num_removed_single_pin_hyperedges);
+  ASSERT_EQ(vec<size_t>({ 0, 2, 5, 7 }), indices);
+  ASSERT_EQ(vec<HypernodeID>({ 0, 2, 0, 3, 4, 1, 2 }), pins);
+}
+
+TEST(AnAdjacencyArrayReader, HandlesCommentsWindowsLineEndingsAndLargeNumbers) {
+  const std::string filename = "tmp.comments.hgr";
+  {
+    std::ofstream out(filename, std::ios::binary);
+    out << "% header comment\r\n"
+        << "3 4 11\r\n"
+        << "% comment between hyperedges\r\n"
+        << "123456789 1 2\r\n"
+        << "12345678 2 3 4\r\n"
+        << "%\r\n"
+        << "7 1 4\r\n"
+        << "% comment between hyperedges and hypernode weights\r\n"
+        << "1\r\n"
+        << "22\r\n"
+        << "333\r\n"
+        << "4444";
+  }
+  HyperedgeID num_edges = 0;
+  HypernodeID num_nodes = 0;
+  HyperedgeID num_removed_single_pin_hyperedges = 0;
+  vec<size_t> indices;
+  vec<HypernodeID> pins;
+  vec<HyperedgeWeight> edges_weight;
+  vec<HypernodeWeight> nodes_weight;
+  readHypergraphFile(filename, num_edges, num_nodes, num_removed_single_pin_hyperedges,
+    indices, pins, edges_weight, nodes_weight);
+
+  ASSERT_EQ(3, num_edges);
+  ASSERT_EQ(4, num_nodes);
+  ASSERT_EQ(vec<size_t>({ 0, 2, 5, 7 }), indices);
+  ASSERT_EQ(vec<HypernodeID>({ 0, 1, 1, 2, 3, 0, 3 }), pins);
+  ASSERT_EQ(vec<HyperedgeWeight>({ 123456789, 12345678, 7 }), edges_weight);
+  ASSERT_EQ(vec<HypernodeWeight>({ 1, 22, 333, 4444 }), nodes_weight);
+}
+
+TEST(ABinaryHypergraphFile, RejectsFilesInOtherFormats) {
+  ASSERT_THROW(BinaryHypergraphFile("../tests/instances/unweighted_hypergraph.hgr"), InvalidInputException);
+}
+
+TEST(ABinaryHypergraphFile, RejectsInvalidPins) {
+  const std::string filename = "tmp.invalid_pins.mtkhb";
+  const vec<size_t> indices = { 0, 2, 4 };
+  const vec<HypernodeID> pins = { 0, 1, 2, 4 };
+  writeBinaryHypergraphFile(filename, 4, 2, indices.data(), pins.data());
+  ASSERT_THROW(BinaryHypergraphFile file(filename), InvalidInputException);
+  std::remove(filename.c_str());
+}
+
+TEST(ABinaryHypergraphFile, RejectsDecreasingHyperedgeIndices) {
+  const std::string filename = "tmp.invalid_indices.mtkhb";
+  const vec<size_t> indices = { 0, 3, 2, 4 };
+  const vec<HypernodeID> pins = { 0, 1, 2, 3 };
+  writeBinaryHypergraphFile(filename, 4, 3, indices.data(), pins.data());
+  ASSERT_THROW(BinaryHypergraphFile file(filename), InvalidInputException);
+  std::remove(filename.c_str());
+}
+
+TEST(ABinaryHypergraphFile, RejectsHeaderWithTooManyHyperedges) {
+  const std::string filename = "tmp.invalid_header.mtkhb";
+  const vec<size_t> indices = { 0, 2, 4 };
+  const vec<HypernodeID> pins = { 0, 1, 2, 3 };
+  writeBinaryHypergraphFile(filename, 4, 2, indices.data(), pins.data());
+  {
+    // (m + 1) * sizeof(size_t) overflows
+    std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+    const uint64_t num_hyperedges = std::numeric_limits<uint64_t>::max() / sizeof(size_t);
+    file.seekp(offsetof(BinaryHypergraphHeader, num_hyperedges));
+    file.write(reinterpret_cast<const char*>(&num_hyperedges), sizeof(uint64_t));
+  }
+  ASSERT_THROW(BinaryHypergraphFile file(filename), InvalidInputException);
+  std::remove(filename.c_str());
+}
+
+class APartitionFile : public Test {
+
+ public:
+  using Hypergraph = ds::StaticHypergraph;
+  using PartitionedHypergraph = StaticPartitionedHypergraph;
+
+  // Spans several chunks that are parsed and formatted in parallel
+  static constexpr HypernodeID NUM_NODES = 200000;
+
+  APartitionFile() :
+    hypergraph(ds::StaticHypergraphFactory::construct(NUM_NODES, 0, { })),
+    phg(8, hypergraph, parallel_tag_t { }) {
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      phg.setOnlyNodePart(hn, hn % 8);
+    }
+    phg.initializePartition();
+  }
+
+  void TearDown() override {
+    std::remove("tmp.partition");
+    std::remove("tmp.binary.partition");
+  }
+
+  void verifyPartition(const std::vector<PartitionID>& partition) {
+    ASSERT_EQ(NUM_NODES, partition.size());
+    for ( HypernodeID hn = 0; hn < NUM_NODES; ++hn ) {
+      ASSERT_EQ(phg.partID(hn), partition[hn]) << V(hn);
+    }
+  }
+
+  Hypergraph hypergraph;
+  PartitionedHypergraph phg;
+};
+
+TEST_F(APartitionFile, WritesAndReadsTextFormat) {
+  writePartitionFile(phg, "tmp.partition");
+  std::vector<PartitionID> partition;
+  readPartitionFile("tmp.partition", NUM_NODES, partition);
+  verifyPartition(partition);
+
+  // One block ID per line
+  std::ifstream file("tmp.partition");
+  std::string line;
+  for ( HypernodeID hn = 0; hn < 3; ++hn ) {
+    std::getline(file, line);
+    ASSERT_EQ(std::to_string(hn % 8), line);
+  }
+}
+
+TEST_F(APartitionFile, WritesAndReadsBinaryFormat) {
+  writePartitionFile(phg, "tmp.binary.partition", FileFormat::binary);
+  std::vector<PartitionID> partition;
+  readPartitionFile("tmp.binary.partition", NUM_NODES, partition);
+  verifyPartition(partition);
+
+  std::ifstream file("tmp.binary.partition", std::ios::binary | std::ios::ate);
+  ASSERT_EQ(sizeof(BinaryPartitionHeader) + NUM_NODES * sizeof(int32_t), static_cast<size_t>(file.tellg()));
+}
+
+TEST_F(APartitionFile, ReadsNegativeBlockIDsAndWindowsLineEndings) {
+  {
+    std::ofstream out("tmp.partition");
+    out << "1\r\n-1\r\n 12 \r\n0";
+  }
+  std::vector<PartitionID> partition;
+  readPartitionFile("tmp.partition", 4, partition);
+  ASSERT_EQ(std::vector<PartitionID>({ 1, -1, 12, 0 }), partition);
+}
+
+TEST_F(APartitionFile, ReadsBlockIDsSurroundedByTabs) {
+  {
+    std::ofstream out("tmp.partition");
+    out << "\t1\n2\t\n \t3 \t\n";
+  }
+  std::vector<PartitionID> partition;
+  readPartitionFile("tmp.partition", 3, partition);
+  ASSERT_EQ(std::vector<PartitionID>({ 1, 2, 3 }), partition);
+}
+
+TEST_F(APartitionFile, RejectsFilesWithWrongNumberOfEntries) {
+  writePartitionFile(phg, "tmp.partition");
+  writePartitionFile(phg, "tmp.binary.partition", FileFormat::binary);
+  std::vector<PartitionID> partition;
+  ASSERT_THROW(readPartitionFile("tmp.partition", NUM_NODES + 1, partition), InvalidInputException);
+  ASSERT_THROW(readPartitionFile("tmp.partition", NUM_NODES - 1, partition), InvalidInputException);
+  ASSERT_THROW(readPartitionFile("tmp.binary.partition", NUM_NODES + 1, partition), InvalidInputException);
+  ASSERT_THROW(readPartitionFile("tmp.binary.partition", NUM_NODES - 1, partition), InvalidInputException);
+}
+
+TEST_F(APartitionFile, RejectsInvalidEntries) {
+  {
+    std::ofstream out("tmp.partition");
+    out << "1\nabc\n2\n";
+  }
+  std::vector<PartitionID> partition;
+  ASSERT_THROW(readPartitionFile("tmp.partition", 3, partition), InvalidInputException);
+}
+
+TEST_F(APartitionFile, ReportsLineOfInvalidEntry) {
+  {
+    std::ofstream out("tmp.partition");
+    out << "1\n% comment\n2\n3 4\n";
+  }
+  std::vector<PartitionID> partition;
+  try {
+    readPartitionFile("tmp.partition", 3, partition);
+    FAIL() << "Expected InvalidInputException";
+  } catch ( const InvalidInputException& e ) {
+    ASSERT_NE(std::string::npos, std::string(e.what()).find("line 4")) << e.what();
+  }
+}
+
+TEST_F(APartitionFile, RejectsBlankLines) {
+  {
+    std::ofstream out("tmp.partition");
+    out << "1\n\n2\n";
+  }
+  std::vector<PartitionID> partition;
+  ASSERT_THROW(readPartitionFile("tmp.partition", 2, partition), InvalidInputException);
+}
+
 }  // namespace io
 }  // namespace mt_kahypar
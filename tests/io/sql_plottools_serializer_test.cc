@@ -62,7 +62,8 @@ std::set<std::string> excluded_members =
     "community_redistribution", "coarsening_rating", "label_propagation", "lp_execute_sequential", "deterministic_refinement",
     "snapshot_interval", "initial_partitioning_refinement", "initial_partitioning_enabled_ip_algos", "original_num_threads",
     "stable_construction_of_incident_edges", "fm", "global", "flows", "csv_output", "preset_file", "preset_type", "instance_type", "degree_of_parallelism",
-    "mapping_target_graph_file" };
+    "mapping_target_graph_file", "coarsening_snapshot_input_file", "coarsening_snapshot_output_file",
+    "partition_file_format" };
 
 bool is_target_struct(const std::string& line) {
   for ( const std::string& target_struct : target_structs ) {
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <thread>
+
+#include "gmock/gmock.h"
+#include <tbb_kahypar/parallel_for.h>
+
+#include "mt-kahypar/parallel/execution_context.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace parallel {
+
+TEST(AnExecutionContext, ProvidesItsOwnInstancesToTheCallingThread) {
+  ExecutionContext execution_context(2);
+  ASSERT_NE(&execution_context.memoryPool(), &MemoryPool::instance());
+  ASSERT_NE(&execution_context.randomize(), &utils::Randomize::instance());
+  execution_context.execute([&] {
+    ASSERT_EQ(&execution_context.memoryPool(), &MemoryPool::instance());
+    ASSERT_EQ(&execution_context.randomize(), &utils::Randomize::instance());
+  });
+  ASSERT_NE(&execution_context.memoryPool(), &MemoryPool::instance());
+  ASSERT_NE(&execution_context.randomize(), &utils::Randomize::instance());
+}
+
+TEST(AnExecutionContext, ProvidesItsOwnInstancesToWorkerThreads) {
+  ExecutionContext execution_context(2);
+  std::atomic<size_t> num_mismatches(0);
+  execution_context.execute([&] {
+    tbb_kahypar::parallel_for(0, 1000, [&](const int) {
+      if ( &execution_context.memoryPool() != &MemoryPool::instance() ||
+           &execution_context.randomize() != &utils::Randomize::instance() ) {
+        ++num_mismatches;
+      }
+    });
+  });
+  ASSERT_EQ(0, num_mismatches.load());
+}
+
+TEST(AnExecutionContext, RestoresInstancesOfAnEnclosingExecutionContext) {
+  ExecutionContext outer(1);
+  ExecutionContext inner(1);
+  outer.execute([&] {
+    inner.execute([&] {
+      ASSERT_EQ(&inner.randomize(), &utils::Randomize::instance());
+    });
+    ASSERT_EQ(&outer.randomize(), &utils::Randomize::instance());
+  });
+}
+
+TEST(AnExecutionContext, BoundsTheNumberOfThreadsByItsTaskArena) {
+  ExecutionContext execution_context(1);
+  ASSERT_EQ(1, execution_context.execute([] { return ExecutionContext::maxNumThreads(); }));
+  ASSERT_EQ(mt_kahypar::TBBInitializer::instance().total_number_of_threads(), ExecutionContext::maxNumThreads());
+}
+
+TEST(AnExecutionContext, ReturnsTheResultOfTheExecutedFunction) {
+  ExecutionContext execution_context(2);
+  ASSERT_EQ(42, execution_context.execute([] { return 42; }));
+}
+
+TEST(AnExecutionContext, IsSeededIndependentlyFromOtherExecutionContexts) {
+  auto draw = [](ExecutionContext& execution_context) {
+    return execution_context.execute([] {
+      std::vector<int> numbers;
+      for ( int i = 0; i < 100; ++i ) {
+        numbers.push_back(utils::Randomize::instance().getRandomInt(0, 1000000, THREAD_ID));
+      }
+      return numbers;
+    });
+  };
+
+  std::vector<int> numbers_1;
+  std::vector<int> numbers_2;
+  std::thread t1([&] {
+    ExecutionContext execution_context(1, 42);
+    numbers_1 = draw(execution_context);
+  });
+  std::thread t2([&] {
+    ExecutionContext execution_context(1, 42);
+    numbers_2 = draw(execution_context);
+  });
+  t1.join();
+  t2.join();
+  ASSERT_EQ(numbers_1, numbers_2);
+
+  ExecutionContext execution_context(1, 43);
+  ASSERT_NE(numbers_1, draw(execution_context));
+}
+
+}  // namespace parallel
+}  // namespace mt_kahypar
@@ -447,6 +447,23 @@ TEST(AMemoryPool, MemoryPoolIsCorrectlyResetted) {
   MemoryPool::instance().free_memory_chunks();
 }
 
+TEST(AMemoryPool, ZeroInitializesLargeChunksBackedByHugePages) {
+  LargeAllocationPolicy::activate_huge_pages();
+  const size_t num_elements = 3 * LargeAllocationPolicy::HUGE_PAGE_SIZE / sizeof(int) + 17;
+  MemoryPool::instance().register_memory_group("TEST_GROUP_1", 1);
+  MemoryPool::instance().register_memory_chunk("TEST_GROUP_1", "TEST_CHUNK_1", num_elements, sizeof(int));
+  MemoryPool::instance().allocate_memory_chunks();
+
+  const int* data = reinterpret_cast<const int*>(
+    MemoryPool::instance().mem_chunk("TEST_GROUP_1", "TEST_CHUNK_1"));
+  ASSERT_NE(nullptr, data);
+  for ( size_t i = 0; i < num_elements; ++i ) {
+    ASSERT_EQ(0, data[i]);
+  }
+
+  MemoryPool::instance().free_memory_chunks();
+}
+
 
 }  // namespace parallel
 }  // namespace mt_kahypar
@@ -31,6 +31,7 @@
 #include "tests/datastructures/hypergraph_fixtures.h"
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/utilities.h"
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/refinement/i_refiner.h"
 #include "mt-kahypar/partition/coarsening/coarsening_commons.h"
@@ -111,6 +112,31 @@ class ACoarsener : public Test {
     uncoarsener = std::make_unique<Uncoarsener>(hypergraph, context, *uncoarseningData, nullptr);
   }
 
+  void TearDown() override {
+    // Time limit, cancellation flag and progress callback must not leak
+    // into other tests, even if an assertion of this test failed
+    utils::TimeLimit& time_limit = utils::Utilities::instance().getTimeLimit(context.utility_id);
+    time_limit.disable();
+    time_limit.setCancellationFlag(nullptr);
+    utils::Utilities::instance().getProgressReporter(context.utility_id).setCallback(nullptr);
+  }
+
+  void replaceHypergraph(Hypergraph&& hg) {
+    uncoarsener.reset();
+    coarsener.reset();
+    uncoarseningData.reset();
+    hypergraph = std::move(hg);
+    context.setupPartWeights(hypergraph.totalWeight());
+
+    uncoarseningData = std::make_unique<UncoarseningData<TypeTraits>>(
+      PRESET != PresetType::default_preset, hypergraph, context);
+
+    mt_kahypar_hypergraph_t hg_ptr = utils::hypergraph_cast(hypergraph);
+    uncoarsening_data_t* data_ptr = uncoarsening::to_pointer(*uncoarseningData);
+    coarsener = std::make_unique<Coarsener>(hg_ptr, context, data_ptr);
+    uncoarsener = std::make_unique<Uncoarsener>(hypergraph, context, *uncoarseningData, nullptr);
+  }
+
   void assignPartitionIDs(PartitionedHypergraph& phg) {
     for (const HypernodeID& hn : phg.nodes()) {
       PartitionID part_id = 0;
@@ -56,6 +56,40 @@ TEST_F(AMultilevelCoarsener, DecreasesNumberOfHyperedges) {
   decreasesNumberOfHyperedges(3 /* expected number of hyperedges */ );
 }
 
+TEST_F(AMultilevelCoarsener, DecreasesNumberOfPinsWithSmallRatingMap) {
+  context.coarsening.contraction_limit = 4;
+  context.coarsening.rating.use_small_rating_map = true;
+  decreasesNumberOfPins(6 /* expected number of pins */ );
+}
+
+TEST_F(AMultilevelCoarsener, DecreasesNumberOfHyperedgesWithSmallRatingMap) {
+  context.coarsening.contraction_limit = 4;
+  context.coarsening.rating.use_small_rating_map = true;
+  decreasesNumberOfHyperedges(3 /* expected number of hyperedges */ );
+}
+
+TEST_F(AMultilevelCoarsener, ClustersLeavesOfStarWithTwoHopClustering) {
+  using Hypergraph = typename StaticHypergraphTypeTraits::Hypergraph;
+  using HypergraphFactory = typename Hypergraph::Factory;
+  // Star with one hub and 63 leaves. The cluster of the hub can absorb at most
+  // three leaves, all other leaves remain unmatched in the normal clustering pass.
+  vec<vec<HypernodeID>> edges;
+  for ( HypernodeID leaf = 1; leaf < 64; ++leaf ) {
+    edges.push_back({ 0, leaf });
+  }
+  replaceHypergraph(HypergraphFactory::construct(64, 63, edges, nullptr, nullptr, true));
+  context.coarsening.max_allowed_node_weight = 4;
+  context.coarsening.contraction_limit = 4;
+  context.coarsening.use_two_hop_clustering = true;
+  doCoarsening();
+
+  auto& coarsest_hg = utils::cast<Hypergraph>(coarsener->coarsestHypergraph());
+  ASSERT_EQ(16, currentNumNodes(coarsener->coarsestHypergraph()));
+  for ( const HypernodeID& hn : coarsest_hg.nodes() ) {
+    ASSERT_LE(coarsest_hg.nodeWeight(hn), 4);
+  }
+}
+
 TEST_F(AMultilevelCoarsener, RemovesHyperedgesOfSizeOneDuringCoarsening) {
   using Hypergraph = typename StaticHypergraphTypeTraits::Hypergraph;
   context.coarsening.contraction_limit = 4;
@@ -76,6 +110,45 @@ TEST_F(AMultilevelCoarsener, RemovesParallelHyperedgesDuringCoarsening) {
   }
 }
 
+TEST_F(AMultilevelCoarsener, TerminatesCoarseningIfTimeLimitIsExceeded) {
+  context.coarsening.contraction_limit = 4;
+  utils::TimeLimit& time_limit = utils::Utilities::instance().getTimeLimit(context.utility_id);
+  time_limit.start(1e-9);
+  decreasesNumberOfPins(hypergraph.initialNumPins());
+}
+
+TEST_F(AMultilevelCoarsener, TerminatesCoarseningIfCancelled) {
+  context.coarsening.contraction_limit = 4;
+  const int cancellation_flag = 1;
+  utils::TimeLimit& time_limit = utils::Utilities::instance().getTimeLimit(context.utility_id);
+  time_limit.setCancellationFlag(&cancellation_flag);
+  ASSERT_TRUE(time_limit.isCancelled());
+  decreasesNumberOfPins(hypergraph.initialNumPins());
+}
+
+TEST_F(AMultilevelCoarsener, ReportsProgressAfterEachCoarseningPass) {
+  context.coarsening.contraction_limit = 4;
+  std::vector<std::pair<size_t, uint64_t>> reports;
+  utils::ProgressReporter& progress_reporter =
+    utils::Utilities::instance().getProgressReporter(context.utility_id);
+  progress_reporter.setCallback([&](const utils::ProgressReporter::Phase phase,
+                                    const size_t level,
+                                    const uint64_t num_nodes,
+                                    const int64_t objective) {
+    ASSERT_EQ(utils::ProgressReporter::Phase::coarsening, phase);
+    ASSERT_EQ(0, objective);
+    reports.emplace_back(level, num_nodes);
+  });
+  decreasesNumberOfPins(6);
+
+  ASSERT_FALSE(reports.empty());
+  for ( size_t i = 0; i < reports.size(); ++i ) {
+    ASSERT_EQ(i + 1, reports[i].first);
+    ASSERT_LT(reports[i].second, i == 0 ? hypergraph.initialNumNodes() : reports[i - 1].second);
+  }
+  ASSERT_EQ(currentNumNodes(coarsener->coarsestHypergraph()), reports.back().second);
+}
+
 TEST_F(AMultilevelCoarsener, ProjectsPartitionBackToOriginalHypergraph) {
   using PartitionedHypergraph = typename StaticHypergraphTypeTraits::PartitionedHypergraph;
   context.coarsening.contraction_limit = 4;
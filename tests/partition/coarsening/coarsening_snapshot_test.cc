@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <cstdio>
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/multilevel.h"
+#include "mt-kahypar/partition/coarsening/coarsening_snapshot.h"
+#include "mt-kahypar/utils/exception.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+template<typename TypeTraitsT>
+class ACoarseningSnapshot : public Test {
+
+ public:
+  using TypeTraits = TypeTraitsT;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using Snapshot = CoarseningSnapshot<TypeTraits>;
+
+  ACoarseningSnapshot() :
+    hypergraph(),
+    context(),
+    filename("tmp.coarsening.snapshot") {
+    parseIniToContext(context, "../config/default_preset.ini");
+    context.partition.partition_type = PartitionedHypergraph::TYPE;
+    context.partition.mode = Mode::direct;
+    context.partition.preset_type = PresetType::default_preset;
+    context.partition.objective = Hypergraph::is_graph ? Objective::cut : Objective::km1;
+    context.partition.gain_policy = Hypergraph::is_graph ? GainPolicy::cut_for_graphs : GainPolicy::km1;
+    context.partition.epsilon = 0.03;
+    context.partition.k = 4;
+    context.partition.verbose_output = false;
+    context.shared_memory.num_threads = HardwareTopology::instance().num_cpus();
+    if constexpr ( Hypergraph::is_graph ) {
+      context.partition.instance_type = InstanceType::graph;
+      hypergraph = io::readInputFile<Hypergraph>(
+        "../tests/instances/delaunay_n10.graph", FileFormat::Metis, true);
+    } else {
+      context.partition.instance_type = InstanceType::hypergraph;
+      hypergraph = io::readInputFile<Hypergraph>(
+        "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+    }
+    // Small contraction limit such that the test instances are coarsened
+    context.coarsening.contraction_limit_multiplier = 20;
+    context.setupPartWeights(hypergraph.totalWeight());
+    context.setupContractionLimit(hypergraph.totalWeight());
+  }
+
+  ~ACoarseningSnapshot() {
+    std::remove(filename.c_str());
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+  std::string filename;
+};
+
+typedef ::testing::Types<StaticHypergraphTypeTraits
+                         ENABLE_GRAPHS(COMMA StaticGraphTypeTraits)> TestConfigs;
+
+TYPED_TEST_SUITE(ACoarseningSnapshot, TestConfigs);
+
+TYPED_TEST(ACoarseningSnapshot, ReadsTheSameHierarchyThatWasWritten) {
+  using Snapshot = typename TestFixture::Snapshot;
+  auto hierarchy = Multilevel<typename TestFixture::TypeTraits>::coarsen(this->hypergraph, this->context);
+  ASSERT_GT(hierarchy->hierarchy.size(), 0);
+  Snapshot::write(this->filename, this->hypergraph, *hierarchy, this->context);
+  auto snapshot_hierarchy = Snapshot::read(this->filename, this->hypergraph, this->context);
+
+  ASSERT_TRUE(snapshot_hierarchy->is_finalized);
+  ASSERT_EQ(hierarchy->hierarchy.size(), snapshot_hierarchy->hierarchy.size());
+  for ( size_t i = 0; i < hierarchy->hierarchy.size(); ++i ) {
+    const auto& level = hierarchy->hierarchy[i];
+    const auto& snapshot_level = snapshot_hierarchy->hierarchy[i];
+    const auto& contracted_hg = level.contractedHypergraph();
+    const auto& snapshot_hg = snapshot_level.contractedHypergraph();
+    ASSERT_EQ(level.communities(), snapshot_level.communities());
+    ASSERT_EQ(contracted_hg.initialNumNodes(), snapshot_hg.initialNumNodes());
+    ASSERT_EQ(contracted_hg.initialNumEdges(), snapshot_hg.initialNumEdges());
+    ASSERT_EQ(contracted_hg.initialNumPins(), snapshot_hg.initialNumPins());
+    ASSERT_EQ(contracted_hg.totalWeight(), snapshot_hg.totalWeight());
+    ASSERT_DOUBLE_EQ(level.coarseningTime(), snapshot_level.coarseningTime());
+    for ( const HypernodeID& hn : contracted_hg.nodes() ) {
+      ASSERT_EQ(contracted_hg.nodeWeight(hn), snapshot_hg.nodeWeight(hn));
+      ASSERT_EQ(contracted_hg.nodeDegree(hn), snapshot_hg.nodeDegree(hn));
+    }
+  }
+}
+
+TYPED_TEST(ACoarseningSnapshot, PartitionsWithHierarchyOfSnapshotAndDifferentImbalance) {
+  using Snapshot = typename TestFixture::Snapshot;
+  {
+    auto hierarchy = Multilevel<typename TestFixture::TypeTraits>::coarsen(this->hypergraph, this->context);
+    Snapshot::write(this->filename, this->hypergraph, *hierarchy, this->context);
+  }
+
+  // The imbalance factor does not influence coarsening
+  this->context.partition.epsilon = 0.1;
+  this->context.setupPartWeights(this->hypergraph.totalWeight());
+  auto hierarchy = Snapshot::read(this->filename, this->hypergraph, this->context);
+  auto phg = Multilevel<typename TestFixture::TypeTraits>::partition(
+    this->hypergraph, *hierarchy, this->context);
+
+  for ( const HypernodeID& hn : phg.nodes() ) {
+    ASSERT_NE(kInvalidPartition, phg.partID(hn));
+  }
+  ASSERT_TRUE(metrics::isBalanced(phg, this->context));
+}
+
+TYPED_TEST(ACoarseningSnapshot, RejectsSnapshotOfDifferentInput) {
+  using Snapshot = typename TestFixture::Snapshot;
+  auto hierarchy = Multilevel<typename TestFixture::TypeTraits>::coarsen(this->hypergraph, this->context);
+  Snapshot::write(this->filename, this->hypergraph, *hierarchy, this->context);
+  hierarchy.reset();
+
+  this->hypergraph.setNodeWeight(0, this->hypergraph.nodeWeight(0) + 1);
+  ASSERT_THROW(Snapshot::read(this->filename, this->hypergraph, this->context), InvalidInputException);
+}
+
+TYPED_TEST(ACoarseningSnapshot, RejectsSnapshotWithDifferentCoarseningParameters) {
+  using Snapshot = typename TestFixture::Snapshot;
+  auto hierarchy = Multilevel<typename TestFixture::TypeTraits>::coarsen(this->hypergraph, this->context);
+  Snapshot::write(this->filename, this->hypergraph, *hierarchy, this->context);
+  hierarchy.reset();
+
+  // The contraction limit depends on k
+  this->context.partition.k = 8;
+  this->context.setupPartWeights(this->hypergraph.totalWeight());
+  this->context.setupContractionLimit(this->hypergraph.totalWeight());
+  ASSERT_THROW(Snapshot::read(this->filename, this->hypergraph, this->context), InvalidInputException);
+}
+
+TYPED_TEST(ACoarseningSnapshot, RejectsFileThatIsNotASnapshot) {
+  using Snapshot = typename TestFixture::Snapshot;
+  ASSERT_THROW(Snapshot::read("../tests/instances/contracted_ibm01.hgr", this->hypergraph, this->context),
+               InvalidInputException);
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include <random>
+
+#include "mt-kahypar/partition/coarsening/small_rating_map.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class ASmallRatingMap : public Test {
+ public:
+  static constexpr HypernodeID NUM_NODES = 1000;
+
+  ASmallRatingMap() :
+    cluster_weight(NUM_NODES) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<HypernodeWeight> weight_dist(1, 10);
+    for ( HypernodeID hn = 0; hn < NUM_NODES; ++hn ) {
+      cluster_weight[hn] = weight_dist(rng);
+    }
+  }
+
+  // ! Adds num_scores random scores for num_keys different keys
+  template<utils::SIMDInstructionSet instruction_set>
+  void fill(SmallRatingMap& map, const size_t num_scores, const size_t num_keys) {
+    std::mt19937 rng(num_scores);
+    std::uniform_int_distribution<HypernodeID> key_dist(0, NUM_NODES - 1);
+    std::vector<HypernodeID> keys(num_keys);
+    for ( HypernodeID& key : keys ) {
+      key = key_dist(rng);
+    }
+    for ( size_t i = 0; i < num_scores; ++i ) {
+      const HypernodeID key = keys[rng() % num_keys];
+      map.addScore(map.findOrInsert<instruction_set>(key), 1.0 / (1 + rng() % 7));
+    }
+  }
+
+  template<utils::SIMDInstructionSet instruction_set>
+  void verifySameContentAsScalarVersion() {
+    if ( !utils::isSupported(instruction_set) ) {
+      GTEST_SKIP() << "CPU does not support " << instruction_set;
+    }
+    for ( size_t num_keys = 1; num_keys <= SmallRatingMap::CAPACITY; ++num_keys ) {
+      SmallRatingMap expected(utils::SIMDInstructionSet::scalar);
+      SmallRatingMap actual(instruction_set);
+      ASSERT_EQ(instruction_set, actual.instructionSet());
+      fill<utils::SIMDInstructionSet::scalar>(expected, 3 * num_keys, num_keys);
+      fill<instruction_set>(actual, 3 * num_keys, num_keys);
+
+      ASSERT_EQ(expected.size(), actual.size());
+      for ( size_t i = 0; i < expected.size(); ++i ) {
+        ASSERT_EQ(expected.key(i), actual.key(i));
+        ASSERT_EQ(expected.value(i), actual.value(i));
+      }
+    }
+  }
+
+  std::vector<parallel::IntegralAtomicWrapper<HypernodeWeight>> cluster_weight;
+};
+
+TEST_F(ASmallRatingMap, AccumulatesRatingsInInsertionOrder) {
+  SmallRatingMap map;
+  ASSERT_EQ(0, map.findOrInsert(5));
+  map.addScore(0, 1.0);
+  ASSERT_EQ(1, map.findOrInsert(3));
+  map.addScore(1, 2.0);
+  ASSERT_EQ(0, map.findOrInsert(5));
+  map.addScore(0, 0.5);
+  ASSERT_EQ(2, map.findOrInsert(7));
+  map.addScoreToEntries(0b101, 1.0);
+  ASSERT_EQ(3, map.size());
+  ASSERT_EQ(5, map.key(0));
+  ASSERT_EQ(2.5, map.value(0));
+  ASSERT_EQ(3, map.key(1));
+  ASSERT_EQ(2.0, map.value(1));
+  ASSERT_EQ(7, map.key(2));
+  ASSERT_EQ(1.0, map.value(2));
+}
+
+TEST_F(ASmallRatingMap, IsEmptyAfterClear) {
+  SmallRatingMap map;
+  map.addScore(map.findOrInsert(5), 1.0);
+  map.clear();
+  ASSERT_EQ(0, map.size());
+  map.addScore(map.findOrInsert(5), 2.0);
+  ASSERT_EQ(2.0, map.value(0));
+}
+
+TEST_F(ASmallRatingMap, ReturnsFeasibleEntries) {
+  SmallRatingMap map;
+  cluster_weight[1] = 2;
+  cluster_weight[2] = 5;
+  cluster_weight[3] = 3;
+  cluster_weight[4] = 1;
+  for ( const HypernodeID key : { 1, 2, 3, 4 } ) {
+    map.findOrInsert(key);
+  }
+  // Entry 1 is too heavy and entry 3 is the node itself
+  ASSERT_EQ(0b0101, map.feasibleEntries(4, cluster_weight.data(), 3));
+}
+
+TEST_F(ASmallRatingMap, HasSameContentAsScalarVersionWithAVX2) {
+  verifySameContentAsScalarVersion<utils::SIMDInstructionSet::avx2>();
+}
+
+TEST_F(ASmallRatingMap, HasSameContentAsScalarVersionWithAVX512) {
+  verifySameContentAsScalarVersion<utils::SIMDInstructionSet::avx512>();
+}
+
+}  // namespace mt_kahypar
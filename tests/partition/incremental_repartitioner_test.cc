@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include "tests/datastructures/hypergraph_fixtures.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/incremental_repartitioner.h"
+#include "mt-kahypar/utils/exception.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+using Repartitioner = IncrementalRepartitioner<StaticHypergraphTypeTraits>;
+
+class AIncrementalRepartitioner : public ds::HypergraphFixture<ds::StaticHypergraph> {
+ public:
+  AIncrementalRepartitioner() :
+    partitioned_hg(2, hypergraph, parallel_tag_t { }),
+    context() {
+    // Partition: {0, 1, 2} -> 0, {3, 4, 5, 6} -> 1
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      partitioned_hg.setOnlyNodePart(hn, hn < 3 ? 0 : 1);
+    }
+    partitioned_hg.initializePartition();
+
+    context.partition.k = 2;
+    context.partition.epsilon = 0.5;
+    context.partition.objective = Objective::km1;
+    context.partition.preset_type = PresetType::default_preset;
+    context.partition.instance_type = InstanceType::hypergraph;
+    context.partition.partition_type = MULTILEVEL_HYPERGRAPH_PARTITIONING;
+    context.partition.verbose_output = false;
+    context.refinement.label_propagation.algorithm = LabelPropagationAlgorithm::do_nothing;
+    context.refinement.fm.algorithm = FMAlgorithm::do_nothing;
+    context.refinement.rebalancer = RebalancingAlgorithm::do_nothing;
+  }
+
+  StaticPartitionedHypergraph partitioned_hg;
+  Context context;
+};
+
+TEST_F(AIncrementalRepartitioner, MapsRemainingNodesBeforeAddedNodes) {
+  HypergraphDelta delta;
+  delta.removed_nodes = { 1, 5 };
+  delta.added_node_weights = { 1, 1 };
+  const vec<HypernodeID> mapping = Repartitioner::nodeMapping(partitioned_hg, delta);
+  const vec<HypernodeID> expected = { 0, kInvalidHypernode, 1, 2, 3, kInvalidHypernode, 4, 5, 6 };
+  ASSERT_EQ(expected, mapping);
+}
+
+TEST_F(AIncrementalRepartitioner, RemovesNodesAndHyperedges) {
+  HypergraphDelta delta;
+  delta.removed_nodes = { 0 };
+  delta.removed_edges = { 2 };
+  ds::StaticHypergraph updated_hg = Repartitioner::applyDelta(partitioned_hg, delta);
+  ASSERT_EQ(6, updated_hg.initialNumNodes());
+  ASSERT_EQ(3, updated_hg.initialNumEdges());
+  // e_0 = {2}, e_1 = {1, 3, 4} and e_3 = {2, 5, 6} in the original hypergraph
+  verifyPins(updated_hg, { 0, 1, 2 }, { { 1 }, { 0, 2, 3 }, { 1, 4, 5 } });
+}
+
+TEST_F(AIncrementalRepartitioner, AddsNodesAndHyperedges) {
+  HypergraphDelta delta;
+  delta.added_node_weights = { 3 };
+  delta.added_edges = { { 7, 4, 5 } };
+  delta.added_edge_weights = { 2 };
+  ds::StaticHypergraph updated_hg = Repartitioner::applyDelta(partitioned_hg, delta);
+  ASSERT_EQ(8, updated_hg.initialNumNodes());
+  ASSERT_EQ(5, updated_hg.initialNumEdges());
+  ASSERT_EQ(10, updated_hg.totalWeight());
+  ASSERT_EQ(3, updated_hg.nodeWeight(7));
+  ASSERT_EQ(2, updated_hg.edgeWeight(4));
+  verifyPins(updated_hg, { 4 }, { { 4, 5, 7 } });
+}
+
+TEST_F(AIncrementalRepartitioner, ThrowsIfAddedHyperedgeContainsRemovedNode) {
+  HypergraphDelta delta;
+  delta.removed_nodes = { 3 };
+  delta.added_edges = { { 2, 3 } };
+  ASSERT_THROW(Repartitioner::applyDelta(partitioned_hg, delta), InvalidInputException);
+}
+
+TEST_F(AIncrementalRepartitioner, ThrowsIfNodeIsRemovedTwice) {
+  HypergraphDelta delta;
+  delta.removed_nodes = { 2, 5, 2 };
+  ASSERT_THROW(Repartitioner::applyDelta(partitioned_hg, delta), InvalidInputException);
+}
+
+TEST_F(AIncrementalRepartitioner, KeepsBlocksOfRemainingNodesAndPlacesAddedNodesGreedily) {
+  HypergraphDelta delta;
+  delta.removed_nodes = { 6 };
+  delta.added_node_weights = { 1, 1 };
+  delta.added_edges = { { 7, 0 }, { 8, 4, 5 } };
+  ds::StaticHypergraph updated_hg = Repartitioner::applyDelta(partitioned_hg, delta);
+  StaticPartitionedHypergraph updated_phg =
+    Repartitioner::repartition(partitioned_hg, delta, updated_hg, context);
+  ASSERT_EQ(8, updated_phg.initialNumNodes());
+  for ( HypernodeID hn = 0; hn < 6; ++hn ) {
+    ASSERT_EQ(partitioned_hg.partID(hn), updated_phg.partID(hn));
+  }
+  ASSERT_EQ(0, updated_phg.partID(6));
+  ASSERT_EQ(1, updated_phg.partID(7));
+}
+
+TEST_F(AIncrementalRepartitioner, ThrowsIfNumberOfBlocksDoesNotMatch) {
+  HypergraphDelta delta;
+  context.partition.k = 4;
+  ds::StaticHypergraph updated_hg = Repartitioner::applyDelta(partitioned_hg, delta);
+  ASSERT_THROW(Repartitioner::repartition(partitioned_hg, delta, updated_hg, context),
+    InvalidInputException);
+}
+
+}  // namespace mt_kahypar
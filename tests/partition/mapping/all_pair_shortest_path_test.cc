@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/datastructures/static_graph_factory.h"
+#include "mt-kahypar/partition/mapping/all_pair_shortest_path.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+static constexpr HyperedgeWeight kInfinity = std::numeric_limits<HyperedgeWeight>::max() / 3;
+
+vec<HyperedgeWeight> computeDistances(const ds::StaticGraph& graph) {
+  const size_t n = graph.initialNumNodes();
+  vec<HyperedgeWeight> distances(n * n, kInfinity);
+  AllPairShortestPath::compute(graph, distances);
+  return distances;
+}
+
+// Sequential reference implementation
+vec<HyperedgeWeight> floyd(const size_t n,
+                           const vec<std::pair<HypernodeID, HypernodeID>>& edges,
+                           const vec<HyperedgeWeight>& edge_weights) {
+  vec<HyperedgeWeight> distances(n * n, kInfinity);
+  for ( size_t u = 0; u < n; ++u ) {
+    distances[u + u * n] = 0;
+  }
+  for ( size_t i = 0; i < edges.size(); ++i ) {
+    const size_t u = edges[i].first;
+    const size_t v = edges[i].second;
+    distances[u + v * n] = std::min(distances[u + v * n], edge_weights[i]);
+    distances[v + u * n] = std::min(distances[v + u * n], edge_weights[i]);
+  }
+  for ( size_t k = 0; k < n; ++k ) {
+    for ( size_t u = 0; u < n; ++u ) {
+      for ( size_t v = 0; v < n; ++v ) {
+        distances[u + v * n] = std::min(distances[u + v * n],
+          distances[u + k * n] + distances[k + v * n]);
+      }
+    }
+  }
+  return distances;
+}
+} // namespace
+
+TEST(AllPairShortestPath, ComputesDistancesOnSparseGraph) {
+  // 4 x 4 grid (see target graph test)
+  const vec<std::pair<HypernodeID, HypernodeID>> edges =
+    { { 0, 1 }, { 1, 2 }, { 2, 3 },
+      { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 },
+      { 4, 5 }, { 5, 6 }, { 6, 7 },
+      { 4, 8 }, { 5, 9 }, { 6, 10 }, { 7, 11 },
+      { 8, 9 }, { 9, 10 }, { 10, 11 },
+      { 8, 12 }, { 9, 13 }, { 10, 14 }, { 11, 15 },
+      { 12, 13 }, { 13, 14 }, { 14, 15 } };
+  const vec<HyperedgeWeight> edge_weights =
+    { 1, 2, 4, 3, 2, 1, 1, 3, 2, 1, 1, 1, 3, 2, 2, 4, 2, 1, 2, 2, 2, 1, 1, 2 };
+  ds::StaticGraph graph = ds::StaticGraphFactory::construct_from_graph_edges(
+    16, edges.size(), edges, edge_weights.data());
+
+  const vec<HyperedgeWeight> distances = computeDistances(graph);
+  ASSERT_EQ(floyd(16, edges, edge_weights), distances);
+  ASSERT_EQ(9, distances[0 + 15 * 16]);
+}
+
+TEST(AllPairShortestPath, ComputesDistancesOnDenseGraph) {
+  vec<std::pair<HypernodeID, HypernodeID>> edges;
+  vec<HyperedgeWeight> edge_weights;
+  for ( HypernodeID u = 0; u < 8; ++u ) {
+    for ( HypernodeID v = u + 1; v < 8; ++v ) {
+      edges.emplace_back(u, v);
+      edge_weights.push_back(1 + (3 * u + 5 * v) % 7);
+    }
+  }
+  ds::StaticGraph graph = ds::StaticGraphFactory::construct_from_graph_edges(
+    8, edges.size(), edges, edge_weights.data());
+
+  ASSERT_EQ(floyd(8, edges, edge_weights), computeDistances(graph));
+}
+
+TEST(AllPairShortestPath, KeepsDistanceOfDisconnectedNodes) {
+  const vec<std::pair<HypernodeID, HypernodeID>> edges = { { 0, 1 }, { 2, 3 } };
+  const vec<HyperedgeWeight> edge_weights = { 2, 3 };
+  ds::StaticGraph graph = ds::StaticGraphFactory::construct_from_graph_edges(
+    4, edges.size(), edges, edge_weights.data());
+
+  const vec<HyperedgeWeight> distances = computeDistances(graph);
+  ASSERT_EQ(2, distances[0 + 1 * 4]);
+  ASSERT_EQ(3, distances[3 + 2 * 4]);
+  ASSERT_EQ(kInfinity, distances[0 + 2 * 4]);
+  ASSERT_EQ(kInfinity, distances[3 + 1 * 4]);
+}
+
+}  // namespace mt_kahypar
@@ -290,4 +290,63 @@ TEST_F(ATargetGraph, InsertsIntoCacheConcurrentlyForNonPrecomputedSets) {
 }
 
 
+class ALargeTargetGraph : public Test {
+
+ public:
+  ALargeTargetGraph() :
+    graph(nullptr) {
+    // Target Graph: Ring with 128 nodes and unit edge weights
+    vec<std::pair<HypernodeID, HypernodeID>> edges;
+    for ( HypernodeID u = 0; u < 128; ++u ) {
+      edges.emplace_back(u, (u + 1) % 128);
+    }
+    graph = std::make_unique<TargetGraph>(
+      ds::StaticGraphFactory::construct_from_graph_edges(128, 128, edges));
+  }
+
+  HyperedgeWeight distance(const vec<PartitionID>& connectivity_set) {
+    ds::Bitset bitset(graph->numBlocks());
+    for ( const PartitionID block : connectivity_set ) {
+      bitset.set(block);
+    }
+    ds::StaticBitset con_set(bitset.numBlocks(), bitset.data());
+    return graph->distance(con_set);
+  }
+
+  std::unique_ptr<TargetGraph> graph;
+};
+
+TEST_F(ALargeTargetGraph, ReducesMaximumPrecomputedConnectivity) {
+  ASSERT_EQ(4, TargetGraph::maxFeasibleConnectivity(16, 4));
+  ASSERT_EQ(4, TargetGraph::maxFeasibleConnectivity(64, 4));
+  ASSERT_EQ(3, TargetGraph::maxFeasibleConnectivity(128, 4));
+  graph->precomputeDistances(4);
+  ASSERT_EQ(3, graph->maxPrecomputedConnectivity());
+}
+
+TEST_F(ALargeTargetGraph, ComputesDistanceOfPrecomputedSets) {
+  graph->precomputeDistances(4);
+  ASSERT_EQ(64, distance({ 0, 64 }));
+  ASSERT_EQ(1, distance({ 127, 0 }));
+  ASSERT_EQ(80, distance({ 0, 40, 80 }));
+  ASSERT_EQ(3, distance({ 100, 101, 103 }));
+}
+
+TEST_F(ALargeTargetGraph, ComputesDistanceOfNonPrecomputedSetsWithBlocksLargerThan64) {
+  graph->precomputeDistances(4);
+  ASSERT_EQ(64, distance({ 0, 64, 65, 66 }));
+  ASSERT_EQ(3, distance({ 0, 1, 2, 3 }));
+  ASSERT_EQ(27, distance({ 100, 110, 120, 127 }));
+  // Cached distances
+  ASSERT_EQ(64, distance({ 0, 64, 65, 66 }));
+  ASSERT_EQ(3, distance({ 0, 1, 2, 3 }));
+  ASSERT_EQ(27, distance({ 100, 110, 120, 127 }));
+}
+
+TEST_F(ALargeTargetGraph, ComputesDistanceOfLargeConnectivitySets) {
+  graph->precomputeDistances(4);
+  ASSERT_EQ(90, distance({ 0, 10, 20, 30, 40, 50, 60, 70, 80, 90 }));
+  ASSERT_EQ(9, distance({ 120, 121, 122, 123, 124, 125, 126, 127, 0, 1 }));
+}
+
 }  // namespace mt_kahypar
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/memory_budget.h"
+#include "mt-kahypar/utils/exception.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class AMemoryBudget : public Test {
+ public:
+  AMemoryBudget() :
+    hypergraph(io::readInputFile<ds::StaticHypergraph>(
+      "../tests/instances/ibm01.hgr", FileFormat::hMetis, true)),
+    instance(mt_kahypar_hypergraph_t {
+      reinterpret_cast<mt_kahypar_hypergraph_s*>(&hypergraph), ds::StaticHypergraph::TYPE }),
+    context() {
+    context.partition.k = 1024;
+    context.partition.epsilon = 0.03;
+    context.partition.objective = Objective::km1;
+    context.partition.preset_type = PresetType::default_preset;
+    context.partition.instance_type = InstanceType::hypergraph;
+    context.partition.partition_type = MULTILEVEL_HYPERGRAPH_PARTITIONING;
+    context.partition.verbose_output = false;
+    context.shared_memory.num_threads = 4;
+    context.preprocessing.use_community_detection = true;
+    context.preprocessing.community_detection.low_memory_contraction = false;
+    context.refinement.fm.algorithm = FMAlgorithm::kway_fm;
+    context.refinement.flows.algorithm = FlowAlgorithm::flow_cutter;
+  }
+
+  // ! Estimated peak memory consumption in MB (rounded up)
+  size_t estimate(const Context& c) const {
+    utils::MemoryTreeNode estimate("Estimated Peak Memory");
+    return (estimate_peak_memory(instance, c, estimate) + 999999) / 1000000;
+  }
+
+  ds::StaticHypergraph hypergraph;
+  mt_kahypar_hypergraph_t instance;
+  Context context;
+};
+
+TEST_F(AMemoryBudget, IncreasesEstimateWithNumberOfBlocks) {
+  Context small_k(context);
+  small_k.partition.k = 2;
+  ASSERT_LT(estimate(small_k), estimate(context));
+}
+
+TEST_F(AMemoryBudget, DoesNotChangeContextWithoutBudget) {
+  context.partition.max_memory = 0;
+  apply_memory_budget(instance, context);
+  ASSERT_FALSE(context.preprocessing.community_detection.low_memory_contraction);
+  ASSERT_EQ(FlowAlgorithm::flow_cutter, context.refinement.flows.algorithm);
+  ASSERT_EQ(FMAlgorithm::kway_fm, context.refinement.fm.algorithm);
+}
+
+TEST_F(AMemoryBudget, DoesNotChangeContextIfEstimateFitsIntoBudget) {
+  context.partition.max_memory = estimate(context);
+  apply_memory_budget(instance, context);
+  ASSERT_FALSE(context.preprocessing.community_detection.low_memory_contraction);
+  ASSERT_EQ(FlowAlgorithm::flow_cutter, context.refinement.flows.algorithm);
+  ASSERT_EQ(FMAlgorithm::kway_fm, context.refinement.fm.algorithm);
+  ASSERT_EQ(MULTILEVEL_HYPERGRAPH_PARTITIONING, context.partition.partition_type);
+}
+
+TEST_F(AMemoryBudget, UsesLowMemoryContractionFirst) {
+  // Community detection dominates the peak memory consumption for small k
+  context.partition.k = 2;
+  context.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+  Context low_memory(context);
+  low_memory.preprocessing.community_detection.low_memory_contraction = true;
+  ASSERT_LT(estimate(low_memory), estimate(context));
+
+  context.partition.max_memory = estimate(low_memory);
+  apply_memory_budget(instance, context);
+  ASSERT_TRUE(context.preprocessing.community_detection.low_memory_contraction);
+  ASSERT_EQ(FMAlgorithm::kway_fm, context.refinement.fm.algorithm);
+  ASSERT_EQ(MULTILEVEL_HYPERGRAPH_PARTITIONING, context.partition.partition_type);
+}
+
+TEST_F(AMemoryBudget, DisablesFlowsBeforeFM) {
+  context.partition.k = 2;
+  Context without_flows(context);
+  without_flows.preprocessing.community_detection.low_memory_contraction = true;
+  without_flows.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+  Context with_flows(without_flows);
+  with_flows.refinement.flows.algorithm = FlowAlgorithm::flow_cutter;
+  ASSERT_LT(estimate(without_flows), estimate(with_flows));
+
+  context.partition.max_memory = estimate(without_flows);
+  apply_memory_budget(instance, context);
+  ASSERT_EQ(FlowAlgorithm::do_nothing, context.refinement.flows.algorithm);
+  ASSERT_EQ(FMAlgorithm::kway_fm, context.refinement.fm.algorithm);
+}
+
+TEST_F(AMemoryBudget, DisablesFMIfGainCacheDoesNotFitIntoBudget) {
+  // Already uses the sparse connectivity information
+  context.partition.preset_type = PresetType::large_k;
+  Context without_fm(context);
+  without_fm.preprocessing.community_detection.low_memory_contraction = true;
+  without_fm.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+  without_fm.refinement.fm.algorithm = FMAlgorithm::do_nothing;
+  Context with_fm(without_fm);
+  with_fm.refinement.fm.algorithm = FMAlgorithm::kway_fm;
+  ASSERT_LT(estimate(without_fm), estimate(with_fm));
+
+  context.partition.max_memory = estimate(without_fm);
+  apply_memory_budget(instance, context);
+  ASSERT_TRUE(context.preprocessing.community_detection.low_memory_contraction);
+  ASSERT_EQ(FlowAlgorithm::do_nothing, context.refinement.flows.algorithm);
+  ASSERT_EQ(FMAlgorithm::do_nothing, context.refinement.fm.algorithm);
+}
+
+#ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+TEST_F(AMemoryBudget, UsesSparseConnectivityInformationBeforeDisablingFM) {
+  Context sparse(context);
+  sparse.preprocessing.community_detection.low_memory_contraction = true;
+  sparse.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+  sparse.partition.partition_type = LARGE_K_PARTITIONING;
+  Context dense(sparse);
+  dense.partition.partition_type = MULTILEVEL_HYPERGRAPH_PARTITIONING;
+  ASSERT_LT(estimate(sparse), estimate(dense));
+
+  context.partition.max_memory = estimate(sparse);
+  apply_memory_budget(instance, context);
+  ASSERT_EQ(LARGE_K_PARTITIONING, context.partition.partition_type);
+  ASSERT_EQ(FMAlgorithm::kway_fm, context.refinement.fm.algorithm);
+}
+#endif
+
+TEST_F(AMemoryBudget, ThrowsIfBudgetCannotBeMet) {
+  context.partition.max_memory = 1;
+  ASSERT_THROW(apply_memory_budget(instance, context), SystemException);
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/preprocessing/node_reordering.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+template <typename TypeTraitsT, NodeOrdering ordering>
+struct TestConfig {
+  using TypeTraits = TypeTraitsT;
+  static constexpr NodeOrdering ORDERING = ordering;
+};
+
+template<typename Config>
+class ANodeReordering : public Test {
+
+ public:
+  using TypeTraits = typename Config::TypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+
+  ANodeReordering() :
+    hypergraph(),
+    original_hg(),
+    context() {
+    if constexpr ( Hypergraph::is_graph ) {
+      hypergraph = io::readInputFile<Hypergraph>(
+        "../tests/instances/delaunay_n10.graph", FileFormat::Metis, true);
+      original_hg = io::readInputFile<Hypergraph>(
+        "../tests/instances/delaunay_n10.graph", FileFormat::Metis, true);
+    } else {
+      hypergraph = io::readInputFile<Hypergraph>(
+        "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+      original_hg = io::readInputFile<Hypergraph>(
+        "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+    }
+    // Communities of consecutive node IDs in reverse order
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      hypergraph.setCommunityID(hn, (hypergraph.initialNumNodes() - hn - 1) / 16);
+    }
+    context.partition.k = 4;
+    context.partition.objective = Hypergraph::is_graph ? Objective::cut : Objective::km1;
+    context.preprocessing.node_ordering = Config::ORDERING;
+  }
+
+  Hypergraph hypergraph;
+  Hypergraph original_hg;
+  Context context;
+};
+
+typedef ::testing::Types<TestConfig<StaticHypergraphTypeTraits, NodeOrdering::community>,
+                         TestConfig<StaticHypergraphTypeTraits, NodeOrdering::bfs>,
+                         TestConfig<StaticHypergraphTypeTraits, NodeOrdering::degree>
+                         ENABLE_GRAPHS(COMMA TestConfig<StaticGraphTypeTraits COMMA NodeOrdering::community>)
+                         ENABLE_GRAPHS(COMMA TestConfig<StaticGraphTypeTraits COMMA NodeOrdering::bfs>)
+                         ENABLE_GRAPHS(COMMA TestConfig<StaticGraphTypeTraits COMMA NodeOrdering::degree>) > TestConfigs;
+
+TYPED_TEST_SUITE(ANodeReordering, TestConfigs);
+
+TYPED_TEST(ANodeReordering, PreservesStructureOfHypergraph) {
+  NodeReordering<typename TestFixture::TypeTraits> node_reordering(this->context);
+  node_reordering.reorder(this->hypergraph);
+  ASSERT_TRUE(node_reordering.isReordered());
+
+  ASSERT_EQ(this->original_hg.initialNumNodes(), this->hypergraph.initialNumNodes());
+  ASSERT_EQ(this->original_hg.initialNumEdges(), this->hypergraph.initialNumEdges());
+  ASSERT_EQ(this->original_hg.initialNumPins(), this->hypergraph.initialNumPins());
+  ASSERT_EQ(this->original_hg.totalWeight(), this->hypergraph.totalWeight());
+  vec<bool> is_used(this->hypergraph.initialNumNodes(), false);
+  for ( const HypernodeID& hn : this->original_hg.nodes() ) {
+    const HypernodeID reordered_hn = node_reordering.reorderedID(hn);
+    ASSERT_FALSE(is_used[reordered_hn]);
+    is_used[reordered_hn] = true;
+    ASSERT_EQ(this->original_hg.nodeWeight(hn), this->hypergraph.nodeWeight(reordered_hn));
+    ASSERT_EQ(this->original_hg.nodeDegree(hn), this->hypergraph.nodeDegree(reordered_hn));
+    ASSERT_EQ((this->hypergraph.initialNumNodes() - hn - 1) / 16,
+              this->hypergraph.communityID(reordered_hn));
+  }
+}
+
+TYPED_TEST(ANodeReordering, MapsPartitionBackToOriginalNodeIDs) {
+  using PartitionedHypergraph = typename TestFixture::PartitionedHypergraph;
+  NodeReordering<typename TestFixture::TypeTraits> node_reordering(this->context);
+  node_reordering.reorder(this->hypergraph);
+
+  PartitionedHypergraph phg(this->context.partition.k, this->hypergraph, parallel_tag_t { });
+  for ( const HypernodeID& hn : this->hypergraph.nodes() ) {
+    phg.setOnlyNodePart(hn, hn % this->context.partition.k);
+  }
+  phg.initializePartition();
+  const HyperedgeWeight objective = metrics::quality(phg, this->context);
+  vec<PartitionID> expected_part(this->original_hg.initialNumNodes());
+  for ( const HypernodeID& hn : this->original_hg.nodes() ) {
+    expected_part[hn] = phg.partID(node_reordering.reorderedID(hn));
+  }
+
+  PartitionedHypergraph original_phg = node_reordering.restoreOriginalOrder(phg, this->hypergraph);
+  ASSERT_FALSE(node_reordering.isReordered());
+  ASSERT_EQ(&this->hypergraph, &original_phg.hypergraph());
+  for ( const HypernodeID& hn : this->original_hg.nodes() ) {
+    ASSERT_EQ(expected_part[hn], original_phg.partID(hn));
+    ASSERT_EQ(this->original_hg.nodeDegree(hn), this->hypergraph.nodeDegree(hn));
+  }
+  ASSERT_EQ(objective, metrics::quality(original_phg, this->context));
+}
+
+}  // namespace mt_kahypar
@@ -42,7 +42,7 @@ namespace {
   using Hypergraph = typename StaticHypergraphTypeTraits::Hypergraph;
   using PartitionedHypergraph = typename StaticHypergraphTypeTraits::PartitionedHypergraph;
   using BlockPriorityQueue = ds::ExclusiveHandleHeap< ds::MaxHeap<Gain, PartitionID> >;
-  using VertexPriorityQueue = ds::MaxHeap<Gain, HypernodeID>;    // these need external handles
+  using VertexPriorityQueue = ds::AdaptiveMaxQueue<Gain, HypernodeID>;    // these need external handles
 }
 
 
@@ -106,4 +106,60 @@ TYPED_TEST(AFMStrategy, FindNextMove) {
   ASSERT_TRUE(std::is_sorted(gains_cached.begin(), gains_cached.end(), std::greater<Gain>()));
 }
 
+TYPED_TEST(AFMStrategy, FindNextMoveWithBucketQueues) {
+  PartitionID k = 8;
+  Context context;
+  context.partition.k = k;
+  context.partition.epsilon = 0.03;
+  Hypergraph hg = io::readInputFile<Hypergraph>(
+    "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+  context.setupPartWeights(hg.totalWeight());
+  PartitionedHypergraph phg = PartitionedHypergraph(k, hg);
+  for (PartitionID i = 0; i < k; ++i) {
+    context.partition.max_part_weights[i] = std::numeric_limits<HypernodeWeight>::max();
+  }
+
+  std::mt19937 rng(420);
+  std::uniform_int_distribution<PartitionID> distr(0, k - 1);
+  for (HypernodeID u : hg.nodes()) {
+    phg.setOnlyNodePart(u, distr(rng));
+  }
+  phg.initializePartition();
+  Km1GainCache gain_cache;
+  gain_cache.initializeGainCache(phg);
+
+  Gain max_weighted_degree = 0;
+  for (HypernodeID u : hg.nodes()) {
+    Gain weighted_degree = 0;
+    for (HyperedgeID he : hg.incidentEdges(u)) {
+      weighted_degree += hg.edgeWeight(he);
+    }
+    max_weighted_degree = std::max(max_weighted_degree, weighted_degree);
+  }
+
+  context.refinement.fm.algorithm = FMAlgorithm::kway_fm;
+
+  FMSharedData sd(hg.initialNumNodes(), false);
+  BlockPriorityQueue blockPQ(k);
+  vec<VertexPriorityQueue> vertexPQs(k, VertexPriorityQueue(sd.vertexPQHandles.data(), sd.numberOfNodes));
+  vec<Gain> gains_heap = this->insertAndExtractAllMoves(phg, context, gain_cache, sd, blockPQ, vertexPQs);
+
+  // Bucket queues covering all gains
+  for (VertexPriorityQueue& pq : vertexPQs) {
+    pq.setMaxKey(max_weighted_degree);
+    ASSERT_TRUE(pq.usesBuckets());
+  }
+  vec<Gain> gains_buckets = this->insertAndExtractAllMoves(phg, context, gain_cache, sd, blockPQ, vertexPQs);
+  ASSERT_TRUE(std::is_sorted(gains_buckets.begin(), gains_buckets.end(), std::greater<Gain>()));
+  ASSERT_EQ(gains_heap.size(), gains_buckets.size());
+
+  // Bucket queues that are too small fall back to binary heaps
+  for (VertexPriorityQueue& pq : vertexPQs) {
+    pq.setMaxKey(1);
+  }
+  vec<Gain> gains_fallback = this->insertAndExtractAllMoves(phg, context, gain_cache, sd, blockPQ, vertexPQs);
+  ASSERT_TRUE(std::is_sorted(gains_fallback.begin(), gains_fallback.end(), std::greater<Gain>()));
+  ASSERT_EQ(gains_heap.size(), gains_fallback.size());
+}
+
 }
@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <set>
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/refinement/gains/gain_cache_table.h"
+#include "mt-kahypar/partition/refinement/gains/km1/km1_gain_cache.h"
+#include "mt-kahypar/partition/refinement/gains/cut/cut_gain_cache.h"
+#include "mt-kahypar/partition/refinement/gains/soed/soed_gain_cache.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using Hypergraph = typename StaticHypergraphTypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename StaticHypergraphTypeTraits::PartitionedHypergraph;
+  using HypergraphFactory = typename Hypergraph::Factory;
+}
+
+template<typename GainCache>
+class AGainCacheTable : public Test {
+ public:
+  static constexpr PartitionID k = 3;
+
+  AGainCacheTable() :
+    hypergraph(),
+    partitioned_hg(),
+    gain_cache() {
+    // Net { 0, 1 } is too heavy for 16-bit entries
+    const vec<HyperedgeWeight> edge_weights = { 20000, 1, 1, 1, 1, 1, 1 };
+    hypergraph = HypergraphFactory::construct(10, 7,
+      { { 0, 1 }, { 0, 2, 3 }, { 1, 4, 5 }, { 2, 3, 6 },
+        { 4, 5, 7 }, { 6, 7, 8, 9 }, { 3, 8 } }, edge_weights.data());
+    partitioned_hg = PartitionedHypergraph(k, hypergraph, parallel_tag_t { });
+    const vec<PartitionID> partition = { 0, 1, 0, 2, 1, 1, 2, 0, 2, 1 };
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      partitioned_hg.setOnlyNodePart(hn, partition[hn]);
+    }
+    partitioned_hg.initializePartition();
+  }
+
+  void moveNode(const HypernodeID hn, const PartitionID from, const PartitionID to) {
+    partitioned_hg.changeNodePart(gain_cache, hn, from, to);
+    gain_cache.recomputeInvalidTerms(partitioned_hg, hn);
+  }
+
+  void verifyGainCacheEntries() {
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      const PartitionID from = partitioned_hg.partID(hn);
+      ASSERT_EQ(gain_cache.recomputePenaltyTerm(partitioned_hg, hn),
+                gain_cache.penaltyTerm(hn, from)) << V(hn);
+      for ( PartitionID to = 0; to < k; ++to ) {
+        ASSERT_EQ(gain_cache.recomputeBenefitTerm(partitioned_hg, hn, to),
+                  gain_cache.benefitTerm(hn, to)) << V(hn) << V(to);
+      }
+    }
+  }
+
+  Hypergraph hypergraph;
+  PartitionedHypergraph partitioned_hg;
+  GainCache gain_cache;
+};
+
+using GainCacheTypes = ::testing::Types<Km1GainCache, CutGainCache ENABLE_SOED(COMMA SoedGainCache)>;
+TYPED_TEST_SUITE(AGainCacheTable, GainCacheTypes);
+
+TYPED_TEST(AGainCacheTable, HasCorrectInitialEntries) {
+  this->gain_cache.initializeGainCache(this->partitioned_hg);
+  this->verifyGainCacheEntries();
+}
+
+TYPED_TEST(AGainCacheTable, HasCorrectEntriesAfterMovingHeavyAndLightNodes) {
+  this->gain_cache.initializeGainCache(this->partitioned_hg);
+  this->moveNode(0, 0, 1);
+  this->verifyGainCacheEntries();
+  this->moveNode(3, 2, 0);
+  this->verifyGainCacheEntries();
+  this->moveNode(1, 1, 2);
+  this->verifyGainCacheEntries();
+  this->moveNode(8, 2, 1);
+  this->verifyGainCacheEntries();
+}
+
+TYPED_TEST(AGainCacheTable, HasCorrectEntriesAfterReinitialization) {
+  this->gain_cache.initializeGainCache(this->partitioned_hg);
+  this->moveNode(0, 0, 2);
+  this->moveNode(5, 1, 0);
+  this->gain_cache.reset();
+  this->gain_cache.initializeGainCache(this->partitioned_hg);
+  this->verifyGainCacheEntries();
+}
+
+template<typename GainCache>
+class ASparseGainCacheTable : public AGainCacheTable<GainCache> {
+ public:
+  ASparseGainCacheTable() :
+    AGainCacheTable<GainCache>() {
+    Context context;
+    context.refinement.sparse_gain_cache = true;
+    this->gain_cache = GainCache(context);
+  }
+
+  void verifyAdjacentBlocks() {
+    for ( const HypernodeID& hn : this->hypergraph.nodes() ) {
+      std::set<PartitionID> adjacent_blocks;
+      for ( const PartitionID& block : this->gain_cache.adjacentBlocks(hn) ) {
+        ASSERT_TRUE(adjacent_blocks.insert(block).second) << V(hn) << V(block);
+      }
+      for ( PartitionID to = 0; to < AGainCacheTable<GainCache>::k; ++to ) {
+        const bool has_benefit = this->gain_cache.recomputeBenefitTerm(this->partitioned_hg, hn, to) != 0;
+        ASSERT_EQ(has_benefit, adjacent_blocks.count(to) > 0) << V(hn) << V(to);
+        ASSERT_EQ(has_benefit, this->gain_cache.blockIsAdjacent(hn, to)) << V(hn) << V(to);
+      }
+    }
+  }
+};
+
+TYPED_TEST_SUITE(ASparseGainCacheTable, GainCacheTypes);
+
+TYPED_TEST(ASparseGainCacheTable, HasCorrectInitialEntries) {
+  this->gain_cache.initializeGainCache(this->partitioned_hg);
+  this->verifyGainCacheEntries();
+  this->verifyAdjacentBlocks();
+}
+
+TYPED_TEST(ASparseGainCacheTable, HasCorrectEntriesAfterMoves) {
+  this->gain_cache.initializeGainCache(this->partitioned_hg);
+  this->moveNode(0, 0, 1);
+  this->verifyGainCacheEntries();
+  this->verifyAdjacentBlocks();
+  this->moveNode(3, 2, 0);
+  this->verifyGainCacheEntries();
+  this->verifyAdjacentBlocks();
+  this->moveNode(6, 2, 1);
+  this->moveNode(8, 2, 1);
+  this->verifyGainCacheEntries();
+  this->verifyAdjacentBlocks();
+}
+
+TYPED_TEST(ASparseGainCacheTable, HasCorrectEntriesAfterReinitialization) {
+  this->gain_cache.initializeGainCache(this->partitioned_hg);
+  this->moveNode(0, 0, 2);
+  this->moveNode(5, 1, 0);
+  this->gain_cache.reset();
+  this->gain_cache.initializeGainCache(this->partitioned_hg);
+  this->verifyGainCacheEntries();
+  this->verifyAdjacentBlocks();
+}
+
+TEST(AGainCacheTable, StoresEntriesOfHeavyNodesInSideTable) {
+  const vec<HyperedgeWeight> edge_weights = { 20000, 1, 1, 1, 1, 1, 1 };
+  Hypergraph hypergraph = HypergraphFactory::construct(10, 7,
+    { { 0, 1 }, { 0, 2, 3 }, { 1, 4, 5 }, { 2, 3, 6 },
+      { 4, 5, 7 }, { 6, 7, 8, 9 }, { 3, 8 } }, edge_weights.data());
+  PartitionedHypergraph partitioned_hg(3, hypergraph, parallel_tag_t { });
+
+  GainCacheTable table;
+  table.prepare(partitioned_hg, 4, 1);
+  ASSERT_TRUE(table.isCompact());
+  ASSERT_EQ(UL(2), table.numSpilledNodes());
+  ASSERT_EQ(UL(40), table.size());
+
+  table.entry(0, 1).store(25000);
+  table.entry(2, 1).store(300);
+  table.entry(0, 1).fetch_add(5000);
+  table.entry(2, 1).fetch_sub(100);
+  ASSERT_EQ(30000, table.load(0, 1));
+  ASSERT_EQ(200, table.load(2, 1));
+}
+
+TEST(AGainCacheTable, UsesWideEntriesIfManyNodesAreHeavy) {
+  const vec<HyperedgeWeight> edge_weights = { 20000, 20000, 1 };
+  Hypergraph hypergraph = HypergraphFactory::construct(6, 3,
+    { { 0, 1 }, { 2, 3 }, { 4, 5 } }, edge_weights.data());
+  PartitionedHypergraph partitioned_hg(3, hypergraph, parallel_tag_t { });
+
+  GainCacheTable table;
+  table.prepare(partitioned_hg, 4, 1);
+  ASSERT_FALSE(table.isCompact());
+  ASSERT_EQ(UL(0), table.numSpilledNodes());
+  table.entry(4, 3).store(100000);
+  ASSERT_EQ(100000, table.load(4, 3));
+}
+
+TEST(AGainCacheTable, StoresSparseEntriesInOverflowSlabs) {
+  Hypergraph hypergraph = HypergraphFactory::construct(2, 1, { { 0, 1 } });
+  PartitionedHypergraph partitioned_hg(32, hypergraph, parallel_tag_t { });
+
+  GainCacheTable table(true);
+  table.prepare(partitioned_hg, 33, 1);
+  ASSERT_TRUE(table.isSparse());
+  for ( PartitionID block = 0; block < 32; block += 2 ) {
+    table.entry(0, block + 1).store(block + 1);
+  }
+  table.entry(0, 5).fetch_sub(5);
+  table.entry(0, 0).store(42);
+
+  std::vector<PartitionID> adjacent_blocks;
+  for ( const PartitionID& block : table.adjacentBlocks(0) ) {
+    adjacent_blocks.push_back(block);
+  }
+  ASSERT_EQ(UL(15), adjacent_blocks.size());
+  ASSERT_EQ(0, adjacent_blocks.front());
+  ASSERT_EQ(6, adjacent_blocks[2]);
+  ASSERT_EQ(30, adjacent_blocks.back());
+  ASSERT_EQ(42, table.load(0, 0));
+  ASSERT_EQ(31, table.load(0, 31));
+  ASSERT_EQ(0, table.load(0, 32));
+  ASSERT_FALSE(table.blockIsAdjacent(0, 4));
+  ASSERT_TRUE(table.blockIsAdjacent(0, 20));
+  ASSERT_EQ(0, std::distance(table.adjacentBlocks(1).begin(), table.adjacentBlocks(1).end()));
+
+  // Reinitialization drops all benefit terms
+  table.prepare(partitioned_hg, 33, 1);
+  ASSERT_EQ(0, table.load(0, 31));
+  ASSERT_FALSE(table.blockIsAdjacent(0, 20));
+}
+
+}  // namespace mt_kahypar
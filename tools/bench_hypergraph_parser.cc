@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <boost_kahypar/program_options.hpp>
+#include <tbb_kahypar/global_control.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/utils/exception.h"
+
+using namespace mt_kahypar;
+namespace po = boost_kahypar::program_options;
+
+// Microbenchmark for the hMetis and METIS parsers. Reports the time to read
+// the input file into the flat arrays that are passed to the factories.
+int main(int argc, char* argv[]) {
+  std::string input_filename;
+  std::string input_file_format = "hmetis";
+  size_t num_threads = std::thread::hardware_concurrency();
+  size_t repetitions = 5;
+
+  po::options_description options("Options");
+  options.add_options()
+    ("input,i",
+    po::value<std::string>(&input_filename)->value_name("<string>")->required(),
+    "Input (hyper)graph filename")
+    ("input-file-format,f",
+    po::value<std::string>(&input_file_format)->value_name("<string>"),
+    "Input file format: \n"
+    " - hmetis : hMETIS hypergraph file format (default)\n"
+    " - metis : METIS graph file format")
+    ("threads,t",
+    po::value<size_t>(&num_threads)->value_name("<size_t>"),
+    "Number of threads (default: all available cores)")
+    ("repetitions,r",
+    po::value<size_t>(&repetitions)->value_name("<size_t>"),
+    "Number of repetitions (default: 5)");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  if ( input_file_format != "hmetis" && input_file_format != "metis" ) {
+    throw InvalidInputException("Unknown input file format: " + input_file_format);
+  }
+
+  tbb_kahypar::global_control gc(tbb_kahypar::global_control::max_allowed_parallelism, num_threads);
+
+  double min_time = std::numeric_limits<double>::max();
+  double total_time = 0.0;
+  size_t num_pins = 0;
+  for ( size_t i = 0; i < repetitions; ++i ) {
+    HyperedgeID num_edges = 0;
+    HypernodeID num_nodes = 0;
+    HyperedgeID num_removed_single_pin_hyperedges = 0;
+    vec<size_t> hyperedge_indices;
+    vec<HypernodeID> pins;
+    io::EdgeVector edges;
+    vec<HyperedgeWeight> hyperedges_weight;
+    vec<HypernodeWeight> hypernodes_weight;
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    if ( input_file_format == "hmetis" ) {
+      io::readHypergraphFile(input_filename, num_edges, num_nodes, num_removed_single_pin_hyperedges,
+                             hyperedge_indices, pins, hyperedges_weight, hypernodes_weight);
+      num_pins = pins.size();
+    } else {
+      io::readGraphFile(input_filename, num_edges, num_nodes, edges, hyperedges_weight, hypernodes_weight);
+      num_pins = 2 * edges.size();
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    const double time = std::chrono::duration<double>(end - start).count();
+    min_time = std::min(min_time, time);
+    total_time += time;
+    std::cout << "Repetition " << (i + 1) << ": " << time << " s" << std::endl;
+  }
+
+  if ( repetitions > 0 ) {
+    std::cout << "RESULT file=" << input_filename
+              << " threads=" << num_threads
+              << " pins=" << num_pins
+              << " min_time=" << min_time
+              << " avg_time=" << (total_time / repetitions)
+              << " pins_per_second=" << (num_pins / min_time) << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <boost_kahypar/program_options.hpp>
+#include <tbb_kahypar/global_control.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
+
+using namespace mt_kahypar;
+namespace po = boost_kahypar::program_options;
+
+using Hypergraph = ds::StaticHypergraph;
+
+// Greedily matches each unmatched vertex with the first unmatched pin of
+// its incident nets (nets larger than max_net_size are skipped)
+parallel::scalable_vector<HypernodeID> computeMatching(const Hypergraph& hg,
+                                                       const HypernodeID max_net_size) {
+  parallel::scalable_vector<HypernodeID> communities(hg.initialNumNodes(), kInvalidHypernode);
+  for ( const HypernodeID& u : hg.nodes() ) {
+    if ( communities[u] == kInvalidHypernode ) {
+      communities[u] = u;
+      bool matched = false;
+      for ( const HyperedgeID& he : hg.incidentEdges(u) ) {
+        if ( hg.edgeSize(he) <= max_net_size ) {
+          for ( const HypernodeID& v : hg.pins(he) ) {
+            if ( communities[v] == kInvalidHypernode ) {
+              communities[v] = u;
+              matched = true;
+              break;
+            }
+          }
+        }
+        if ( matched ) {
+          break;
+        }
+      }
+    }
+  }
+  return communities;
+}
+
+// Microbenchmark for the detection of identical nets during contraction. Builds a
+// multilevel hierarchy with a greedy matching and contracts each level with the
+// bucket map and the sort-based detection. The variants are executed alternately
+// and the minimum time over all repetitions is reported per level and in total.
+int main(int argc, char* argv[]) {
+  std::string input_filename;
+  size_t num_threads = std::thread::hardware_concurrency();
+  size_t repetitions = 5;
+  size_t max_levels = 10;
+  HypernodeID max_net_size = 1000;
+
+  po::options_description options("Options");
+  options.add_options()
+    ("input,i",
+    po::value<std::string>(&input_filename)->value_name("<string>")->required(),
+    "Input hypergraph filename (hMetis format)")
+    ("threads,t",
+    po::value<size_t>(&num_threads)->value_name("<size_t>"),
+    "Number of threads (default: all available cores)")
+    ("repetitions,r",
+    po::value<size_t>(&repetitions)->value_name("<size_t>"),
+    "Number of repetitions per level (default: 5)")
+    ("levels,l",
+    po::value<size_t>(&max_levels)->value_name("<size_t>"),
+    "Maximum number of levels (default: 10)")
+    ("max-net-size",
+    po::value<HypernodeID>(&max_net_size)->value_name("<uint32_t>"),
+    "Nets larger than this are ignored by the matching (default: 1000)");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  tbb_kahypar::global_control gc(tbb_kahypar::global_control::max_allowed_parallelism, num_threads);
+
+  mt_kahypar_hypergraph_t hypergraph = io::readInputFile(input_filename,
+    PresetType::default_preset, InstanceType::hypergraph, FileFormat::hMetis);
+  Hypergraph& input_hg = utils::cast<Hypergraph>(hypergraph);
+
+  const std::vector<IdenticalNetDetection> variants =
+    { IdenticalNetDetection::bucket_map, IdenticalNetDetection::parallel_sort };
+  std::vector<double> total_time(variants.size(), 0.0);
+  std::vector<Hypergraph> hierarchy;
+  for ( size_t level = 0; level < max_levels; ++level ) {
+    Hypergraph& hg = hierarchy.empty() ? input_hg : hierarchy.back();
+    const parallel::scalable_vector<HypernodeID> matching = computeMatching(hg, max_net_size);
+
+    std::vector<double> min_time(variants.size(), std::numeric_limits<double>::max());
+    std::vector<Hypergraph> contracted_hg(variants.size());
+    for ( size_t i = 0; i < repetitions; ++i ) {
+      for ( size_t v = 0; v < variants.size(); ++v ) {
+        parallel::scalable_vector<HypernodeID> communities = matching;
+        const auto start = std::chrono::high_resolution_clock::now();
+        contracted_hg[v] = hg.contract(communities, false, variants[v]);
+        const auto end = std::chrono::high_resolution_clock::now();
+        min_time[v] = std::min(min_time[v], std::chrono::duration<double>(end - start).count());
+      }
+    }
+
+    for ( size_t v = 0; v < variants.size(); ++v ) {
+      if ( contracted_hg[v].initialNumEdges() != contracted_hg[0].initialNumEdges() ||
+           contracted_hg[v].initialNumPins() != contracted_hg[0].initialNumPins() ) {
+        std::cerr << "Contracted hypergraphs differ on level " << level << std::endl;
+        std::exit(1);
+      }
+      total_time[v] += min_time[v];
+      std::cout << "LEVEL file=" << input_filename
+                << " threads=" << num_threads
+                << " level=" << level
+                << " num_nodes=" << hg.initialNumNodes()
+                << " num_edges=" << hg.initialNumEdges()
+                << " num_removed_edges=" << (hg.initialNumEdges() - contracted_hg[v].initialNumEdges())
+                << " detection=" << variants[v]
+                << " min_time=" << min_time[v]
+                << " speedup=" << (min_time[0] / min_time[v]) << std::endl;
+    }
+
+    const bool converged = contracted_hg[0].initialNumNodes() == hg.initialNumNodes();
+    hierarchy.emplace_back(std::move(contracted_hg[0]));
+    if ( converged || hierarchy.back().initialNumEdges() == 0 ) {
+      break;
+    }
+  }
+
+  for ( size_t v = 0; v < variants.size(); ++v ) {
+    std::cout << "RESULT file=" << input_filename
+              << " threads=" << num_threads
+              << " levels=" << hierarchy.size()
+              << " detection=" << variants[v]
+              << " total_time=" << total_time[v]
+              << " speedup=" << (total_time[0] / total_time[v]) << std::endl;
+  }
+
+  utils::delete_hypergraph(hypergraph);
+  return 0;
+}
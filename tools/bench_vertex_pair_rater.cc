@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <boost_kahypar/program_options.hpp>
+#include <tbb_kahypar/global_control.h>
+#include <tbb_kahypar/parallel_for.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/partition/coarsening/multilevel_vertex_pair_rater.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_score_policy.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
+#include "mt-kahypar/utils/simd.h"
+
+using namespace mt_kahypar;
+namespace po = boost_kahypar::program_options;
+
+using Hypergraph = ds::StaticHypergraph;
+using Rater = MultilevelVertexPairRater<HeavyEdgeScore, NoWeightPenalty, BestRatingPreferringUnmatched>;
+using AtomicWeight = parallel::IntegralAtomicWrapper<HypernodeWeight>;
+
+// Microbenchmark for the rating step of the multilevel coarsener. Rates all nodes
+// of the input hypergraph (first level of the hierarchy, every node is its own cluster)
+// with the sparse rating maps and with the small rating map for each supported
+// instruction set. The sum of the best ratings is reported as checksum (note that
+// the sparse rating maps deduplicate the pins of a hyperedge with a bloom filter,
+// which can skip a few pins due to false positives).
+int main(int argc, char* argv[]) {
+  std::string input_filename;
+  size_t num_threads = std::thread::hardware_concurrency();
+  size_t repetitions = 5;
+
+  po::options_description options("Options");
+  options.add_options()
+    ("input,i",
+    po::value<std::string>(&input_filename)->value_name("<string>")->required(),
+    "Input hypergraph filename (hMetis format)")
+    ("threads,t",
+    po::value<size_t>(&num_threads)->value_name("<size_t>"),
+    "Number of threads (default: all available cores)")
+    ("repetitions,r",
+    po::value<size_t>(&repetitions)->value_name("<size_t>"),
+    "Number of repetitions (default: 5)");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  tbb_kahypar::global_control gc(tbb_kahypar::global_control::max_allowed_parallelism, num_threads);
+
+  // Coarsening parameters of the default preset
+  Context context;
+  context.partition.ignore_hyperedge_size_threshold = 1000;
+  context.coarsening.vertex_degree_sampling_threshold = 200000;
+  context.coarsening.use_adaptive_edge_size = true;
+
+  mt_kahypar_hypergraph_t hypergraph = io::readInputFile(input_filename,
+    PresetType::default_preset, InstanceType::hypergraph, FileFormat::hMetis);
+  Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
+  const HypernodeID num_nodes = hg.initialNumNodes();
+  const HypernodeWeight max_allowed_node_weight = std::max(hg.totalWeight() / 160, 1);
+
+  vec<HypernodeID> cluster_ids(num_nodes);
+  vec<AtomicWeight> cluster_weight(num_nodes);
+  for ( const HypernodeID& hn : hg.nodes() ) {
+    cluster_ids[hn] = hn;
+    cluster_weight[hn] = hg.nodeWeight(hn);
+  }
+  const ds::FixedVertexSupport<Hypergraph> fixed_vertices = hg.copyOfFixedVertexSupport();
+
+  struct Variant {
+    std::string name;
+    Context context;
+    std::unique_ptr<Rater> rater;
+    double min_time;
+    double checksum;
+  };
+  // Note that the raters store a reference to the context of their variant
+  std::vector<std::unique_ptr<Variant>> variants;
+  auto add_variant = [&](const std::string& name,
+                         const bool use_small_rating_map,
+                         const utils::SIMDInstructionSet instruction_set) {
+    variants.emplace_back(std::make_unique<Variant>());
+    Variant& variant = *variants.back();
+    variant.name = name;
+    variant.context = context;
+    variant.context.coarsening.rating.use_small_rating_map = use_small_rating_map;
+    variant.rater = std::make_unique<Rater>(num_nodes, hg.maxEdgeSize(), variant.context, instruction_set);
+    variant.min_time = std::numeric_limits<double>::max();
+    variant.checksum = 0.0;
+  };
+
+  add_variant("sparse_map", false, utils::SIMDInstructionSet::scalar);
+  for ( const utils::SIMDInstructionSet instruction_set : { utils::SIMDInstructionSet::scalar,
+                                                            utils::SIMDInstructionSet::avx2,
+                                                            utils::SIMDInstructionSet::avx512 } ) {
+    if ( utils::isSupported(instruction_set) ) {
+      std::stringstream name;
+      name << "small_map_" << instruction_set;
+      add_variant(name.str(), true, instruction_set);
+    }
+  }
+
+  // The variants are executed alternately to reduce the impact of
+  // frequency scaling and other noise on the measurements
+  for ( size_t i = 0; i < repetitions; ++i ) {
+    for ( std::unique_ptr<Variant>& variant : variants ) {
+      tbb_kahypar::enumerable_thread_specific<double> local_checksum(0.0);
+      const auto start = std::chrono::high_resolution_clock::now();
+      tbb_kahypar::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+        const auto rating = variant->rater->template rate<false>(hg, hn, cluster_ids,
+          cluster_weight, fixed_vertices, max_allowed_node_weight);
+        if ( rating.valid ) {
+          local_checksum.local() += rating.value;
+        }
+      });
+      const auto end = std::chrono::high_resolution_clock::now();
+      variant->min_time = std::min(variant->min_time, std::chrono::duration<double>(end - start).count());
+      variant->checksum = local_checksum.combine(std::plus<double>());
+    }
+  }
+
+  for ( const std::unique_ptr<Variant>& variant : variants ) {
+    std::cout << "RESULT file=" << input_filename
+              << " threads=" << num_threads
+              << " rating_map=" << variant->name
+              << " min_time=" << variant->min_time
+              << " nodes_per_second=" << (num_nodes / variant->min_time)
+              << " speedup=" << (variants[0]->min_time / variant->min_time)
+              << " checksum=" << variant->checksum << std::endl;
+  }
+
+  utils::delete_hypergraph(hypergraph);
+  return 0;
+}
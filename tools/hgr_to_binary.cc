@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <boost_kahypar/program_options.hpp>
+
+#include <iostream>
+#include <string>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/utils/exception.h"
+
+using namespace mt_kahypar;
+namespace po = boost_kahypar::program_options;
+
+int main(int argc, char* argv[]) {
+  std::string input_filename;
+  std::string binary_filename;
+  std::string fixed_vertex_filename;
+  std::string input_file_format = "hmetis";
+
+  po::options_description options("Options");
+  options.add_options()
+    ("input,i",
+    po::value<std::string>(&input_filename)->value_name("<string>")->required(),
+    "Input (hyper)graph filename")
+    ("input-file-format,f",
+    po::value<std::string>(&input_file_format)->value_name("<string>"),
+    "Input file format: \n"
+    " - hmetis : hMETIS hypergraph file format (default)\n"
+    " - metis : METIS graph file format")
+    ("output,o",
+    po::value<std::string>(&binary_filename)->value_name("<string>")->required(),
+    "Output filename of the binary CSR file")
+    ("fixed,x",
+    po::value<std::string>(&fixed_vertex_filename)->value_name("<string>"),
+    "Fixed vertex filename (optional, stored in the binary file)");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  HyperedgeID num_edges = 0;
+  HypernodeID num_nodes = 0;
+  HyperedgeID num_removed_single_pin_hyperedges = 0;
+  vec<size_t> hyperedge_indices;
+  vec<HypernodeID> pins;
+  vec<HyperedgeWeight> hyperedges_weight;
+  vec<HypernodeWeight> hypernodes_weight;
+  bool is_graph = false;
+  if ( input_file_format == "hmetis" ) {
+    io::readHypergraphFile(input_filename, num_edges, num_nodes, num_removed_single_pin_hyperedges,
+                           hyperedge_indices, pins, hyperedges_weight, hypernodes_weight);
+  } else if ( input_file_format == "metis" ) {
+    io::EdgeVector edges;
+    io::readGraphFile(input_filename, num_edges, num_nodes, edges, hyperedges_weight, hypernodes_weight);
+    ALWAYS_ASSERT(edges.size() == num_edges);
+    // Convert to adjacency array
+    hyperedge_indices.resize(num_edges + 1);
+    pins.resize(2 * static_cast<size_t>(num_edges));
+    for ( HyperedgeID e = 0; e < num_edges; ++e ) {
+      hyperedge_indices[e] = 2 * static_cast<size_t>(e);
+      pins[2 * static_cast<size_t>(e)] = edges[e].first;
+      pins[2 * static_cast<size_t>(e) + 1] = edges[e].second;
+    }
+    hyperedge_indices[num_edges] = pins.size();
+    is_graph = true;
+  } else {
+    throw InvalidInputException("Unknown input file format: " + input_file_format);
+  }
+  ALWAYS_ASSERT(hyperedge_indices.size() == static_cast<size_t>(num_edges) + 1);
+
+  std::vector<PartitionID> fixed_vertices;
+  if ( !fixed_vertex_filename.empty() ) {
+    io::readPartitionFile(fixed_vertex_filename, num_nodes, fixed_vertices);
+  }
+
+  io::writeBinaryHypergraphFile(binary_filename, num_nodes, num_edges,
+    hyperedge_indices.data(), pins.data(),
+    hyperedges_weight.empty() ? nullptr : hyperedges_weight.data(),
+    hypernodes_weight.empty() ? nullptr : hypernodes_weight.data(),
+    fixed_vertices.empty() ? nullptr : fixed_vertices.data(),
+    num_removed_single_pin_hyperedges, is_graph);
+
+  std::cout << "Wrote " << num_nodes << " nodes, " << num_edges << " edges and "
+            << pins.size() << " pins to " << binary_filename << std::endl;
+  return 0;
+}